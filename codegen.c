@@ -9,10 +9,38 @@
 
 // 関数呼び出しの引数に用いるレジスタ
 static char* MREGS[] = {"rdi", "rsi", "rdx", "rcx", "r8", "r9"};
+static char* MREGS32[] = {"edi", "esi", "edx", "ecx", "r8d", "r9d"};
+static char* MREGS8[] = {"dil", "sil", "dl", "cl", "r8b", "r9b"};
+// レジスタに割り当てた変数に用いるレジスタ(Var.regで番号を指定)
+// 1からNCALLEE_REGSまではcallee-saved, それ以降は葉関数でだけ使うcaller-savedレジスタ
+static char* VREGS[] = {NULL, "rbx", "r12", "r13", "r14", "r15", "r10", "r11", "rsi", "rcx", "r8", "r9"};
 // スタックの深さ
 static int stackpos = 0;
 // 関数の戻り先のラベル
 static char *label;
+// 生成中の関数
+static Function *current;
+// 生成中の関数が退避したcallee-savedレジスタの数
+static int nsaved;
+// フレームポインタを使わず、フレーム上の変数をrsp相対で参照するかどうか
+static bool frameless;
+// フレームポインタを使わないとき、退避したレジスタより下に確保したフレームの大きさ
+static int frame_extra;
+// プロローグ直後のstackpos(このときrspは16バイト境界に揃っている)
+static int frame_base;
+// 末尾呼び出しをジャンプにできるかどうか(フレーム上の変数のアドレスが外に出ない)
+static bool tail_ok;
+// 末尾のreturnの値として生成中のインライン展開のラベル
+static char *tail_label;
+// コード生成中の翻訳単位
+static Code *unit;
+// 生成中の文式({ ... })の入れ子の深さ
+static int stmt_expr_depth;
+// breakの飛び先のラベルと、そこでのスタックの深さ
+static char *break_label;
+static int break_depth;
+// 生成中の関数のswitch文の通し番号
+static int nswitches;
 
 // 制御構文のラベルの番号づけ
 int count(void) {
@@ -22,47 +50,536 @@ int count(void) {
 
 // raxレジスタからRSPへのプッシュのコード生成
 static void push() {
-    printf("    push rax\n");
+    emit("    push rax\n");
     stackpos += 8;
 }
 // RSPからのポップのコード生成
 static void pop(char *reg) {
-    printf("    pop %s\n", reg);
+    emit("    pop %s\n", reg);
     stackpos -= 8;
     assert(stackpos >= 0);
 }
+// 型の大きさに応じたメモリオペランドの幅指定を返す。
+static char *ptr_size(Type *type) {
+    if (type == NULL) return "QWORD";
+    switch (type->ty) {
+        case CHAR:
+            return "BYTE";
+        case INT:
+            return "DWORD";
+    }
+    return "QWORD";
+}
+
+// 型の大きさに応じてr8, r32, r64のいずれかのレジスタ名を返す。
+static char *reg_part(Type *type, char *r8, char *r32, char *r64) {
+    if (type == NULL) return r64;
+    switch (type->ty) {
+        case CHAR:
+            return r8;
+        case INT:
+            return r32;
+    }
+    return r64;
+}
+
+// メモリオペランドから型に応じて64ビットのレジスタregへロードする。配列型はアドレスを求める。
+// char, intは64ビットに符号拡張して読み込む。
+static void load_reg(Type *type, char *reg, char *mem) {
+    if (type->ty == ARRAY) {
+        emit("    lea %s, %s\n", reg, mem);
+    } else if (type->ty == CHAR) {
+        emit("    movsx %s, BYTE PTR %s\n", reg, mem);
+    } else if (type->ty == INT) {
+        emit("    movsxd %s, DWORD PTR %s\n", reg, mem);
+    } else {
+        emit("    mov %s, QWORD PTR %s\n", reg, mem);
+    }
+}
+
+// メモリオペランドから型に応じてraxへロードする。
+static void load_mem(Type *type, char *mem) {
+    load_reg(type, "rax", mem);
+}
+
+// raxをメモリオペランドへ型の大きさだけストアする。
+static void store_mem(Type *type, char *mem) {
+    emit("    mov %s PTR %s, %s\n", ptr_size(type), mem, reg_part(type, "al", "eax", "rax"));
+}
+
 // raxが指す場所へ値をロードする。
 static void load(Type *type){
     if (type->ty == ARRAY) {
         return;
-    } else if(type->ty == CHAR){
-        printf("    movsx rax, BYTE PTR [rax]\n");
-        return;
     }
-    printf("    mov rax, [rax]\n");
+    load_mem(type, "[rax]");
 }
 // スタックトップが指すアドレスへraxをストアする。
 static void store(Type *type) {
     pop("rdi");
-    if (type != NULL && type->ty == CHAR) { // TODO DEREF 正しく型が設定できていない
-        printf("    mov [rdi], al\n");
-        return;
+    store_mem(type, "[rdi]");
+}
+
+// レジスタに割り当てた変数へraxの値を書き込む。char, intは符号拡張して保持する。
+static void store_reg(Var *var) {
+    char *reg = VREGS[var->reg];
+    switch (var->type->ty) {
+        case CHAR:
+            emit("    movsx %s, al\n", reg);
+            return;
+        case INT:
+            emit("    movsxd %s, eax\n", reg);
+            return;
     }
-    printf("    mov [rdi], rax\n");
+    emit("    mov %s, rax\n", reg);
+}
+
+// フレームの基点(rbpの指す位置)からdisp離れた位置のメモリオペランドを返す。
+// indexがあればそのレジスタをscale倍して加える。
+// フレームポインタを使わないときはrsp相対にするので、出力する直前のstackposで求めること。
+static char *frame_ref(int disp, char *index, int scale) {
+    char *buf = calloc(1, 64);
+    char *base = "rbp";
+    if (frameless) {
+        base = "rsp";
+        disp += frame_extra + stackpos;
+    }
+    char d[16] = "";
+    if (disp) sprintf(d, "%+d", disp);
+    if (index) {
+        sprintf(buf, "[%s+%s*%d%s]", base, index, scale, d);
+    } else {
+        sprintf(buf, "[%s%s]", base, d);
+    }
+    return buf;
+}
+
+// 関数がこの翻訳単位で定義されているかどうか
+static bool defined(char *name) {
+    for (int i = 0; i < unit->n; i++) {
+        if (unit->function[i]->name && !strcmp(unit->function[i]->name, name)) return true;
+    }
+    return false;
 }
 
 static void gen_lval(Node *node);
 static void gen(Node *node);
+static void gen_void(Node *node);
 static void gen_stmt(Node *node);
 
+static char *gen_mem(Node *node);
+
+// 計算に使うレジスタを経由せず、直接引数レジスタに置ける引数かどうか
+static bool is_simple_arg(Node *node) {
+    switch (node->kind) {
+        case ND_NUM:
+            return true;
+        case ND_LVAR:
+            if (node->var->reg) return true;
+            return optimizing(P_ADDRMODE);
+        case ND_GVAR:
+        case ND_STR:
+            return optimizing(P_ADDRMODE);
+        case ND_ADDR:
+            // アドレスを取られた変数はレジスタに割り当てられない
+            return optimizing(P_ADDRMODE) && (node->right->kind == ND_LVAR || node->right->kind == ND_GVAR);
+    }
+    return false;
+}
+
+// is_simple_argを満たす引数を引数レジスタregへ置く。
+static void gen_simple_arg(Node *node, char *reg) {
+    switch (node->kind) {
+        case ND_NUM:
+            emit("    mov %s, %d\n", reg, node->val);
+            return;
+        case ND_ADDR:
+            emit("    lea %s, %s\n", reg, gen_mem(node->right));
+            return;
+        case ND_LVAR:
+            if (node->var->reg) {
+                emit("    mov %s, %s\n", reg, VREGS[node->var->reg]);
+                return;
+            }
+    }
+    load_reg(node->type, reg, gen_mem(node));
+}
+
+// 転送先か転送元がメモリオペランドかどうか
+static bool is_mem(char *s) {
+    return strchr(s, '[') != NULL;
+}
+
+// 並列代入 dst[i] = src[i] (i < n) を出力する。転送先はレジスタかメモリで、転送元は即値でもよい。
+// 他の代入の転送元を上書きしない代入から順に出力し、循環が残ればxchgで解く。
+// メモリを含む循環は1つの値をraxに退避して解き、メモリ間の転送はraxかr11を経由する。
+void parallel_move(char **dst, char **src, int n) {
+    bool *done = calloc(n + 1, sizeof(bool));
+    for (int left = n; left > 0; ) {
+        bool progress = false;
+        for (int i = 0; i < n; i++) {
+            if (done[i]) continue;
+            bool blocked = false;
+            for (int j = 0; j < n; j++) {
+                if (!done[j] && j != i && !strcmp(src[j], dst[i])) blocked = true;
+            }
+            if (blocked) continue;
+            if (is_mem(dst[i]) && is_mem(src[i])) {
+                // raxに退避した値がまだ読まれていなければr11を経由する
+                char *tmp = "rax";
+                for (int j = 0; j < n; j++) {
+                    if (!done[j] && !strcmp(src[j], "rax")) tmp = "r11";
+                }
+                emit("    mov %s, %s\n", tmp, src[i]);
+                emit("    mov %s, %s\n", dst[i], tmp);
+            } else if (strcmp(dst[i], src[i]) != 0) {
+                emit("    mov %s, %s\n", dst[i], src[i]);
+            }
+            done[i] = true;
+            left--;
+            progress = true;
+        }
+        if (progress) continue;
+        // 循環: 1つをxchgで入れ替え、入れ替えた値を読む代入の転送元を付け替える
+        for (int i = 0; i < n; i++) {
+            if (done[i]) continue;
+            if (is_mem(dst[i]) || is_mem(src[i])) {
+                emit("    mov rax, %s\n", dst[i]);
+                for (int j = 0; j < n; j++) {
+                    if (!done[j] && !strcmp(src[j], dst[i])) src[j] = "rax";
+                }
+                break;
+            }
+            emit("    xchg %s, %s\n", dst[i], src[i]);
+            for (int j = 0; j < n; j++) {
+                if (!done[j] && j != i && !strcmp(src[j], dst[i])) src[j] = src[i];
+            }
+            done[i] = true;
+            left--;
+            break;
+        }
+    }
+    free(done);
+}
+
+// 関数呼び出しのレジスタで渡す引数(先頭の6個まで)を計算して引数レジスタに置く。
+// 定数や変数はそのまま引数レジスタへ読み込む。それ以外の式は関数呼び出しを含むものから
+// 先に計算し、後の計算で壊されない引数レジスタかr10, r11に置くか、スタックに積んでおく。
+// 最後に一時的な置き場所から引数レジスタへの並列代入を行う。
+static void gen_args(Node *node) {
+    int n = node->nparams < 6 ? node->nparams : 6;
+    if (!optimizing(P_ARGREGS)) {
+        for (int i = 0; i < n; i++) {
+            gen(node->params[i]);
+            push();
+        }
+        for (int i = n - 1; i >= 0; i--) {
+            pop(MREGS[i]);
+        }
+        return;
+    }
+    // 計算する順: 関数呼び出しを含む引数, その他の式
+    int order[6], ncomplex = 0;
+    for (int pass = 0; pass < 2; pass++) {
+        for (int i = 0; i < n; i++) {
+            Node *arg = node->params[i];
+            if (is_simple_arg(arg) || has_call(arg) != (pass == 0)) continue;
+            order[ncomplex++] = i;
+        }
+    }
+    char *dst[6], *src[6];
+    int nmove = 0, npushed = 0, pushed[6];
+    char *holds[] = {"r10", "r11"};
+    int nholds = 0;
+    for (int k = 0; k < ncomplex; k++) {
+        int i = order[k];
+        gen(node->params[i]);
+        if (k == ncomplex - 1) {
+            dst[nmove] = MREGS[i];
+            src[nmove++] = "rax";
+        } else if (has_call(node->params[order[k + 1]])) {
+            // 後で関数を呼ぶので全てのcaller-savedレジスタが壊れる
+            push();
+            pushed[npushed++] = i;
+        } else if (strcmp(MREGS[i], "rdi") != 0 && strcmp(MREGS[i], "rdx") != 0) {
+            // 式の計算はrax, rdi, rdxしか使わないので、それ以外の引数レジスタには直接置ける
+            emit("    mov %s, rax\n", MREGS[i]);
+        } else if (nholds < 2) {
+            emit("    mov %s, rax\n", holds[nholds]);
+            dst[nmove] = MREGS[i];
+            src[nmove++] = holds[nholds++];
+        } else {
+            push();
+            pushed[npushed++] = i;
+        }
+    }
+    for (int k = npushed - 1; k >= 0; k--) {
+        pop(MREGS[pushed[k]]);
+    }
+    parallel_move(dst, src, nmove);
+    for (int i = 0; i < n; i++) {
+        if (is_simple_arg(node->params[i])) gen_simple_arg(node->params[i], MREGS[i]);
+    }
+}
+
+// 関数呼び出し。7個目以降の引数は右から順にスタックに積み、
+// call命令の時点でrspが16バイト境界に揃うよう、必要ならその前に8バイト空ける。
+static void gen_call(Node *node) {
+    int nstack = node->nparams > 6 ? node->nparams - 6 : 0;
+    int pad = (stackpos - frame_base + nstack * 8) % 16;
+    if (pad) {
+        emit("    sub rsp, %d\n", pad);
+        stackpos += pad;
+    }
+    for (int i = node->nparams - 1; i >= 6; i--) {
+        if (optimizing(P_ARGREGS) && node->params[i]->kind == ND_NUM) {
+            emit("    push %d\n", node->params[i]->val);
+            stackpos += 8;
+            continue;
+        }
+        gen(node->params[i]);
+        push();
+    }
+    gen_args(node);
+    emit("    call %s\n", node->name);
+    if (pad + nstack * 8) {
+        emit("    add rsp, %d\n", pad + nstack * 8);
+        stackpos -= pad + nstack * 8;
+    }
+    // 翻訳単位外の関数はintを返すものとし、上位ビットを符号拡張する
+    if (!defined(node->name)) {
+        emit("    movsxd rax, eax\n");
+    }
+}
+
+// 比較演算の条件コード(jcc, setccの接尾辞)を返す。
+// whenが偽のときは条件を反転したものを返す。
+static char *cond_code(NodeKind kind, bool when) {
+    switch (kind) {
+        case ND_EQ:
+            return when ? "e" : "ne";
+        case ND_NE:
+            return when ? "ne" : "e";
+        case ND_GT:
+            return when ? "g" : "le";
+        case ND_GE:
+            return when ? "ge" : "l";
+        case ND_LT:
+            return when ? "l" : "ge";
+        case ND_LE:
+            return when ? "le" : "g";
+    }
+    error("比較演算ではありません。");
+    return NULL;
+}
+
+// 二項演算の左辺をrax, 右辺をrdiに計算する。
+static void gen_operands(Node *node) {
+    gen(node->right); //rdi
+    push();
+    gen(node->left); //rax
+    pop("rdi");
+}
+
+// 左右を入れ替えたときの比較演算の種類を返す。
+static NodeKind mirror(NodeKind kind) {
+    switch (kind) {
+        case ND_GT:
+            return ND_LT;
+        case ND_GE:
+            return ND_LE;
+        case ND_LT:
+            return ND_GT;
+        case ND_LE:
+            return ND_GE;
+    }
+    return kind;
+}
+
+// 右辺を即値にできる二項演算なら、右辺が定数になる形のノードを返す。
+// 左辺が定数なら、交換可能な演算と比較に限り左右を入れ替える。
+// Node.valはintなので定数は常にimm32に収まる。
+static Node *imm_form(Node *node) {
+    if (!optimizing(P_IMM)) return NULL;
+    if (node->right->kind == ND_NUM) return node;
+    if (node->left->kind != ND_NUM) return NULL;
+    switch (node->kind) {
+        case ND_ADD:
+        case ND_MUL:
+        case ND_EQ:
+        case ND_NE:
+        case ND_GT:
+        case ND_GE:
+        case ND_LT:
+        case ND_LE: {
+            Node *ret = calloc(1, sizeof(Node));
+            *ret = *node;
+            ret->kind = mirror(node->kind);
+            ret->left = node->right;
+            ret->right = node->left;
+            return ret;
+        }
+    }
+    return NULL;
+}
+
+// 比較演算のcmp命令までを出力し、条件コードの決定に使う演算の種類を返す。
+static NodeKind gen_cmp(Node *node) {
+    Node *imm = imm_form(node);
+    if (imm) {
+        gen(imm->left);
+        emit("    cmp rax, %d\n", imm->right->val);
+        return imm->kind;
+    }
+    gen_operands(node);
+    emit("    cmp rax, rdi\n");
+    return node->kind;
+}
+
+// メモリオペランド [base + index*scale + disp] の構成要素
+typedef struct Addr Addr;
+struct Addr {
+    bool frame;     // ベースがrbpかどうか
+    char *sym;      // ベースがrip相対のシンボルのときの名前
+    char *reg;      // ベースがレジスタ変数のときのレジスタ名
+    Node *base;     // ベースを計算する式(frame, symでない場合)
+    Node *index;    // インデックスを計算する式(NULLならインデックスなし)
+    int scale;
+    int disp;
+};
+
+static void match_ptr(Node *node, Addr *a);
+
+// 左辺値のアドレスをAddrに分解する。
+static void match_lval(Node *node, Addr *a) {
+    switch (node->kind) {
+        case ND_LVAR:
+            if (node->var->reg) error("レジスタ変数のアドレスは取れません。");
+            a->frame = true;
+            a->disp -= node->var->offset;
+            return;
+        case ND_GVAR:
+        case ND_STR:
+            a->sym = node->name;
+            return;
+        case ND_DEREF:
+            match_ptr(node->right, a);
+            return;
+    }
+    error("左辺値ではありません。");
+}
+
+// ポインタの値(配列型の場合はそのアドレス)を求める式をAddrに分解する。
+static void match_ptr(Node *node, Addr *a) {
+    if (isarray(node->type) && node->kind != ND_ADD) {
+        match_lval(node, a);
+        return;
+    }
+    if (node->kind == ND_ADD && !iscint(node->type)) {
+        Node *rhs = node->right;
+        if (rhs->kind == ND_NUM) {
+            match_ptr(node->left, a);
+            a->disp += rhs->val;
+            return;
+        }
+        Addr b = *a;
+        match_ptr(node->left, &b);
+        if (b.index == NULL) {
+            // インデックスの倍率は1, 2, 4, 8のいずれか
+            b.scale = 1;
+            if (rhs->kind == ND_SHL && rhs->right->val <= 3) {
+                b.scale = 1 << rhs->right->val;
+                rhs = rhs->left;
+            }
+            // a[i+c] の定数部分は変位にまとめる
+            if (rhs->kind == ND_ADD && iscint(rhs->type) && rhs->right->kind == ND_NUM) {
+                b.disp += rhs->right->val * b.scale;
+                rhs = rhs->left;
+            }
+            b.index = rhs;
+            *a = b;
+            return;
+        }
+    }
+    if (node->kind == ND_LVAR && node->var->reg) {
+        a->reg = VREGS[node->var->reg];
+        return;
+    }
+    a->base = node;
+}
+
+// Addrのレジスタ部分を計算するコードを出力し、メモリオペランドの文字列を返す。
+// 使うレジスタはraxとrdiのみ。
+static char *gen_addr(Addr *a) {
+    char *buf = calloc(1, 64);
+    char disp[16] = "";
+    if (a->disp) sprintf(disp, "%+d", a->disp);
+    if (a->index == NULL) {
+        if (a->frame) {
+            return frame_ref(a->disp, NULL, 0);
+        } else if (a->sym) {
+            sprintf(buf, "[rip+%s%s]", a->sym, disp);
+        } else if (a->reg) {
+            sprintf(buf, "[%s%s]", a->reg, disp);
+        } else {
+            gen(a->base);
+            sprintf(buf, "[rax%s]", disp);
+        }
+        return buf;
+    }
+    if (a->frame) {
+        gen(a->index);
+        return frame_ref(a->disp, "rax", a->scale);
+    }
+    if (a->reg) {
+        gen(a->index);
+        sprintf(buf, "[%s+rax*%d%s]", a->reg, a->scale, disp);
+        return buf;
+    }
+    // rip相対にはインデックスを付けられないのでベースをraxに置く
+    gen(a->index);
+    push();
+    if (a->sym) {
+        emit("    lea rax, [rip+%s]\n", a->sym);
+    } else {
+        gen(a->base);
+    }
+    pop("rdi");
+    sprintf(buf, "[rax+rdi*%d%s]", a->scale, disp);
+    return buf;
+}
+
+// 左辺値のメモリオペランドを求める。
+static char *gen_mem(Node *node) {
+    Addr a = {0};
+    match_lval(node, &a);
+    return gen_addr(&a);
+}
+
+// 左辺値がレジスタの計算なしに表せる(rbp相対、rip相対かレジスタ変数がベース)かどうか
+static bool is_direct(Node *node) {
+    Addr a = {0};
+    match_lval(node, &a);
+    return a.index == NULL && a.base == NULL;
+}
+
 // 式を左辺値として計算する。
 // ノードが変数を指す場合、変数のアドレスを計算し、スタックにプッシュする。
 // それ以外の場合、エラーを表示する。
 void gen_lval(Node *node){
+    if (optimizing(P_ADDRMODE)) {
+        emit("    lea rax, %s\n", gen_mem(node));
+        return;
+    }
     switch (node->kind) {
         case ND_LVAR:
-            printf("    mov rax, rbp\n");
-            printf("    sub rax, %d\n", node->offset);
+            if (node->var->reg) error("レジスタ変数のアドレスは取れません。");
+            if (frameless) {
+                emit("    lea rax, %s\n", frame_ref(-node->var->offset, NULL, 0));
+                return;
+            }
+            emit("    mov rax, rbp\n");
+            emit("    sub rax, %d\n", node->var->offset);
             return;
             
         case ND_DEREF:
@@ -70,26 +587,215 @@ void gen_lval(Node *node){
             return;
             
         case ND_GVAR:
-            printf("    lea rax, [rip+%s]\n", node->name);
+            emit("    lea rax, [rip+%s]\n", node->name);
             return;
             
         case ND_STR:
-            printf("    lea rax, [rip+%s]\n", node->name);
+            emit("    lea rax, [rip+%s]\n", node->name);
             return;
     }
     error("左辺値ではありません。");
 }
 
+// 32ビット符号付き除算の魔法数と追加のシフト量を求める(Hacker's Delight 10-1)。
+// dは2 <= |d| < 2^31とする。
+static void magic(int d, long *m, int *shift) {
+    const unsigned two31 = 0x80000000;
+    unsigned ad = d < 0 ? -(unsigned) d : d;
+    unsigned t = two31 + ((unsigned) d >> 31);
+    unsigned anc = t - 1 - t % ad;
+    unsigned q1 = two31 / anc, r1 = two31 - q1 * anc;
+    unsigned q2 = two31 / ad, r2 = two31 - q2 * ad;
+    unsigned delta;
+    int p = 31;
+    do {
+        p++;
+        q1 *= 2;
+        r1 *= 2;
+        if (r1 >= anc) {
+            q1++;
+            r1 -= anc;
+        }
+        q2 *= 2;
+        r2 *= 2;
+        if (r2 >= ad) {
+            q2++;
+            r2 -= ad;
+        }
+        delta = ad - r2;
+    } while (q1 < delta || (q1 == delta && r1 == 0));
+    int mag = (int) (q2 + 1);
+    *m = d < 0 ? -mag : mag;
+    *shift = p - 32;
+}
+
+// raxの値(符号拡張済みのint)を定数dで割った商をraxに求める。
+// tmpのレジスタを作業用に使う。
+void gen_quotient(int d, char *tmp) {
+    int k = ilog2(d < 0 ? -d : d);
+    if (k > 0) {
+        // 2^kによる除算: 負数は2^k-1を足してから算術シフトし、0方向に丸める
+        emit("    mov %s, rax\n", tmp);
+        emit("    sar %s, 63\n", tmp);
+        emit("    shr %s, %d\n", tmp, 64 - k);
+        emit("    add rax, %s\n", tmp);
+        emit("    sar rax, %d\n", k);
+        if (d < 0) emit("    neg rax\n");
+        return;
+    }
+    // 乗算の上位32ビットを取り、補正とシフトの後に負なら1を足す
+    long m;
+    int shift;
+    magic(d, &m, &shift);
+    emit("    mov %s, rax\n", tmp);
+    emit("    imul rax, rax, %ld\n", m);
+    emit("    sar rax, 32\n");
+    if (d > 0 && m < 0) emit("    add rax, %s\n", tmp);
+    if (d < 0 && m > 0) emit("    sub rax, %s\n", tmp);
+    if (shift > 0) emit("    sar rax, %d\n", shift);
+    emit("    mov %s, rax\n", tmp);
+    emit("    shr %s, 63\n", tmp);
+    emit("    add rax, %s\n", tmp);
+}
+
+// intの定数による除算・剰余をidivを使わずに生成する。扱えなければfalseを返す。
+static bool gen_divconst(Node *node) {
+    int d = node->right->val;
+    // 0による除算とINT_MINはidivに任せる
+    if (d == 0 || d == -2147483647 - 1) return false;
+    gen(node->left);
+    if (node->kind == ND_MOD && (d == 1 || d == -1)) {
+        emit("    xor eax, eax\n");
+    } else if (d == -1) {
+        emit("    neg eax\n");
+        emit("    movsxd rax, eax\n");
+    } else if (node->kind == ND_DIV) {
+        if (d != 1) gen_quotient(d, "rdi");
+    } else {
+        // x % d = x - (x / d) * d
+        emit("    mov rdx, rax\n");
+        gen_quotient(d, "rdi");
+        emit("    imul rax, rax, %d\n", d);
+        emit("    sub rdx, rax\n");
+        emit("    mov rax, rdx\n");
+    }
+    return true;
+}
+
+// 条件によらずフラグを変えずにレジスタへ読み込める値かどうか
+static bool is_plain(Node *node) {
+    return node->kind == ND_NUM || (node->kind == ND_LVAR && !isarray(node->type));
+}
+
+static void load_plain(Node *node, char *reg) {
+    if (node->kind == ND_NUM) {
+        emit("    mov %s, %d\n", reg, node->val);
+    } else if (node->var->reg) {
+        emit("    mov %s, %s\n", reg, VREGS[node->var->reg]);
+    } else {
+        load_reg(node->type, reg, gen_mem(node));
+    }
+}
+
+// 値を置いたレジスタ
+enum { IN_NONE, IN_RAX, IN_RDI };
+
+// 条件の判定で値がraxかrdiに残っていればそれを、なければIN_NONEを返す。
+static int held(Node *node, Node *rax, Node *rdi) {
+    if (same_node(node, rax)) return IN_RAX;
+    if (rdi && same_node(node, rdi)) return IN_RDI;
+    return IN_NONE;
+}
+
+// 条件で値を選ぶ式(ifconv.c)のコード生成。両方の値を計算してからcmovで選ぶ。
+// 比較の被演算子と同じ値はcmpに使ったレジスタのものを使い、定数や変数は判定の後で
+// フラグを変えずに読み込む。それ以外の値は判定の前に計算してスタックに積む。
+static void gen_select(Node *node) {
+    Node *cond = node->left, *a = node->right->left, *b = node->right->right;
+    Node *rax = cond, *rdi = NULL;
+    Node *imm = NULL;
+    bool cmp = false;
+    switch (cond->kind) {
+        case ND_EQ:
+        case ND_NE:
+        case ND_GT:
+        case ND_GE:
+        case ND_LT:
+        case ND_LE:
+            cmp = true;
+            imm = imm_form(cond);
+            rax = imm ? imm->left : cond->left;
+            rdi = imm ? NULL : cond->right;
+    }
+    int ra = held(a, rax, rdi), rb = held(b, rax, rdi);
+    bool ready = (ra || is_plain(a)) && (rb || is_plain(b));
+    if (!ready) {
+        gen(b);
+        push();
+        gen(a);
+        push();
+    }
+    char *cc = "ne", *inv = "e";
+    if (cmp) {
+        NodeKind kind = gen_cmp(cond);
+        cc = cond_code(kind, true);
+        inv = cond_code(kind, false);
+    } else {
+        gen(cond);
+        emit("    test rax, rax\n");
+    }
+    if (!ready) {
+        pop("rdi");
+        pop("rax");
+        emit("    cmov%s rax, rdi\n", cc);
+        return;
+    }
+    // 真のときの値がraxにあれば、偽のときの値をrdiに置いて条件が偽なら移す
+    if (ra == IN_RAX) {
+        if (rb == IN_RAX) return;
+        if (rb == IN_NONE) load_plain(b, "rdi");
+        emit("    cmov%s rax, rdi\n", inv);
+        return;
+    }
+    if (rb == IN_RDI) {
+        if (ra == IN_RDI) {
+            emit("    mov rax, rdi\n");
+            return;
+        }
+        emit("    mov rax, rdi\n");
+    } else if (rb == IN_NONE) {
+        if (ra == IN_NONE) load_plain(a, "rdi");
+        load_plain(b, "rax");
+        emit("    cmov%s rax, rdi\n", cc);
+        return;
+    }
+    // 偽のときの値がraxにある
+    if (ra == IN_NONE) load_plain(a, "rdi");
+    emit("    cmov%s rax, rdi\n", cc);
+}
+
 void gen(Node *node){
     switch (node->kind) {
         case ND_NUM:
-            printf("    mov rax, %d\n",node->val);
+            emit("    mov rax, %d\n",node->val);
             return;
         case ND_LVAR:
+            if (node->var->reg) {
+                emit("    mov rax, %s\n", VREGS[node->var->reg]);
+                return;
+            }
+            if (optimizing(P_ADDRMODE)) {
+                load_mem(node->type, gen_mem(node));
+                return;
+            }
             gen_lval(node);
             load(node->type);
             return;
         case ND_GVAR:
+            if (optimizing(P_ADDRMODE)) {
+                load_mem(node->type, gen_mem(node));
+                return;
+            }
             gen_lval(node);
             load(node->type);
             return;
@@ -97,28 +803,32 @@ void gen(Node *node){
             gen_lval(node->right);
             return;
         case ND_DEREF:
+            if (optimizing(P_ADDRMODE)) {
+                load_mem(node->type, gen_mem(node));
+                return;
+            }
             gen(node->right);
             load(node->type);
             return;
         case ND_ASGMT:
+            if (node->left->kind == ND_LVAR && node->left->var->reg) {
+                gen(node->right);
+                store_reg(node->left->var);
+                return;
+            }
+            if (optimizing(P_ADDRMODE) && is_direct(node->left)) {
+                gen(node->right);
+                store_mem(node->left->type, gen_mem(node->left));
+                return;
+            }
             gen_lval(node->left); //rdi
             push();
             gen(node->right); //rax
             store(node->left->type);
             return;
-        case ND_FUNCCALL: {
-            Node **params = node->params;
-            int ireg = node->nparams;
-            for (int i = 0; i < ireg; i++) {
-                gen(params[i]);
-                push();
-            }
-            for (int i = ireg - 1; i >= 0; i--) {
-                pop(MREGS[i]);
-            }
-            printf("    call %s\n", node->name);
+        case ND_FUNCCALL:
+            gen_call(node);
             return;
-        }
         case ND_STR: {
             gen_lval(node);
             return;
@@ -126,74 +836,738 @@ void gen(Node *node){
         case ND_NULL:
             return;
         case ND_BLOCK:
+            // 文式の最後の文の値が式の値になる
+            stmt_expr_depth++;
             gen_stmt(node);
+            stmt_expr_depth--;
+            // インライン展開した関数の本体ならreturnの飛び先を置く
+            if (node->name) emit(".%s.return:\n", node->name);
+            return;
+        case ND_SELECT:
+            gen_select(node);
+            return;
+        case ND_NEG:
+            gen(node->right);
+            emit("    neg rax\n");
+            return;
+        case ND_SHL:
+            gen(node->left);
+            emit("    shl rax, %d\n", node->right->val);
             return;
+        case ND_MUL:
+            // x*3, x*5, x*9はleaで計算する
+            if (optimizing(P_ADDRMODE) && node->right->kind == ND_NUM) {
+                int v = node->right->val;
+                if (v == 3 || v == 5 || v == 9) {
+                    gen(node->left);
+                    emit("    lea rax, [rax+rax*%d]\n", v - 1);
+                    return;
+                }
+            }
+            break;
+        case ND_DIV:
+        case ND_MOD:
+            if (optimizing(P_DIVCONST) && iscint(node->type) && node->right->kind == ND_NUM
+                && gen_divconst(node)) {
+                return;
+            }
+            break;
     }
-    gen(node->right); //rdi
-    push();
-    gen(node->left); //rax
-    pop("rdi");
+    Node *imm = imm_form(node);
+    if (imm) {
+        int val = imm->right->val;
+        switch (imm->kind) {
+            case ND_ADD:
+                gen(imm->left);
+                emit("    add rax, %d\n", val);
+                return;
+            case ND_SUB:
+                gen(imm->left);
+                emit("    sub rax, %d\n", val);
+                return;
+            case ND_MUL:
+                gen(imm->left);
+                emit("    imul rax, rax, %d\n", val);
+                return;
+        }
+    }
+    switch (node->kind) {
+        case ND_EQ:
+        case ND_NE:
+        case ND_GT:
+        case ND_GE:
+        case ND_LT:
+        case ND_LE:
+            emit("    set%s al\n", cond_code(gen_cmp(node), true));
+            emit("    movzb rax, al\n");
+            return;
+    }
+    gen_operands(node);
     switch (node->kind) {
         case ND_ADD:
-            printf("    add rax, rdi\n");
+            emit("    add rax, rdi\n");
             return;
         case ND_SUB:
-            printf("    sub rax, rdi\n");
+            emit("    sub rax, rdi\n");
             return;
         case ND_MUL:
-            printf("    imul rax, rdi\n");
+            emit("    imul rax, rdi\n");
             return;
         case ND_DIV:
-            printf("    cqo\n");
-            printf("    idiv rdi\n");
+            // intの除算は32ビットで行う
+            if (iscint(node->type)) {
+                emit("    cdq\n");
+                emit("    idiv edi\n");
+                emit("    movsxd rax, eax\n");
+                return;
+            }
+            emit("    cqo\n");
+            emit("    idiv rdi\n");
+            return;
+        case ND_MOD:
+            if (iscint(node->type)) {
+                emit("    cdq\n");
+                emit("    idiv edi\n");
+                emit("    movsxd rax, edx\n");
+                return;
+            }
+            emit("    cqo\n");
+            emit("    idiv rdi\n");
+            emit("    mov rax, rdx\n");
+            return;
+    }
+    error("不正な式です。");
+}
+
+// 条件式condの真偽がwhenと一致するときlabelへ分岐する。
+// 比較演算はフラグから直接分岐し、0/1の値を作らない。
+static void gen_branch(Node *cond, bool when, char *label) {
+    if (optimizing(P_CMPBR)) {
+        switch (cond->kind) {
+            case ND_NUM:
+                if ((cond->val != 0) == when) emit("    jmp %s\n", label);
+                return;
+            case ND_EQ:
+            case ND_NE:
+            case ND_GT:
+            case ND_GE:
+            case ND_LT:
+            case ND_LE:
+                emit("    j%s %s\n", cond_code(gen_cmp(cond), when), label);
+                return;
+        }
+        gen(cond);
+        emit("    test rax, rax\n");
+        emit("    %s %s\n", when ? "jne" : "je", label);
+        return;
+    }
+    gen(cond);
+    emit("    cmp rax, 0\n");
+    emit("    %s %s\n", when ? "jne" : "je", label);
+}
+
+// lhs = lhs + e, lhs = e + lhs, lhs = lhs - e のメモリにある左辺値を、アドレスを1度だけ計算して
+// メモリを直接書き換える命令(add, sub, inc, dec)で更新する。生成したら真を返す。
+// 書き込む幅は左辺値の型の大きさで、下位ビットは計算してからストアするのと変わらない。
+static bool gen_rmw(Node *node) {
+    Node *lhs = node->left, *rhs = node->right;
+    if (lhs->kind != ND_LVAR && lhs->kind != ND_GVAR && lhs->kind != ND_DEREF) return false;
+    if ((lhs->kind == ND_LVAR && lhs->var->reg) || !is_pure(lhs)) return false;
+    if (rhs->kind != ND_ADD && rhs->kind != ND_SUB) return false;
+    if (!(iscint(lhs->type) && iscint(rhs->type)) && !(isptr(lhs->type) && isptr(rhs->type))) return false;
+    Node *e;
+    if (same_node(rhs->left, lhs)) {
+        e = rhs->right;
+    } else if (rhs->kind == ND_ADD && same_node(rhs->right, lhs)) {
+        e = rhs->left;
+    } else {
+        return false;
+    }
+    if (!is_pure(e)) return false;
+    char *op = rhs->kind == ND_ADD ? "add" : "sub";
+    char *size = ptr_size(lhs->type);
+    if (e->kind == ND_NUM && optimizing(P_IMM)) {
+        int val = lhs->type->ty == CHAR ? (signed char) e->val : e->val;
+        char *mem = gen_mem(lhs);
+        if (val == 1 || val == -1) {
+            emit("    %s %s PTR %s\n", (val == 1) == (rhs->kind == ND_ADD) ? "inc" : "dec", size, mem);
+        } else {
+            emit("    %s %s PTR %s, %d\n", op, size, mem, val);
+        }
+        return true;
+    }
+    gen(e);
+    if (is_direct(lhs)) {
+        emit("    %s %s PTR %s, %s\n", op, size, gen_mem(lhs), reg_part(lhs->type, "al", "eax", "rax"));
+        return true;
+    }
+    // アドレスの計算はraxとrdiを使うので、値はrdxに移す
+    push();
+    char *mem = gen_mem(lhs);
+    pop("rdx");
+    emit("    %s %s PTR %s, %s\n", op, size, mem, reg_part(lhs->type, "dl", "edx", "rdx"));
+    return true;
+}
+
+// 値を使わない式のコード生成。定数の代入はraxを経由せず即値でストアする。
+static void gen_void(Node *node) {
+    // レジスタに置いたポインタを定数だけ進める
+    if (node->kind == ND_ASGMT && node->left->kind == ND_LVAR && node->left->var->reg
+        && isptr(node->left->type) && node->right->kind == ND_ADD && optimizing(P_IMM)) {
+        Node *rhs = node->right;
+        if (rhs->left->kind == ND_LVAR && rhs->left->var == node->left->var && rhs->right->kind == ND_NUM) {
+            emit("    add %s, %d\n", VREGS[node->left->var->reg], rhs->right->val);
+            return;
+        }
+    }
+    if (node->kind == ND_ASGMT && optimizing(P_RMW) && gen_rmw(node)) return;
+    if (node->kind == ND_ASGMT && node->right->kind == ND_NUM && optimizing(P_IMM)) {
+        Node *lhs = node->left;
+        int val = node->right->val;
+        if (lhs->type->ty == CHAR) val = (signed char) val;
+        if (lhs->kind == ND_LVAR && lhs->var->reg) {
+            emit("    mov %s, %d\n", VREGS[lhs->var->reg], val);
+            return;
+        }
+        if (optimizing(P_ADDRMODE)) {
+            char *mem = gen_mem(lhs);
+            emit("    mov %s PTR %s, %d\n", ptr_size(lhs->type), mem, val);
+            return;
+        }
+    }
+    gen(node);
+}
+
+// ループ先頭のラベルを-falign-loopsに従って揃える。
+static void align_loop(void) {
+    if (align_loops > 1) emit("    .p2align %d\n", ilog2(align_loops));
+}
+
+// for, whileループのコード生成。条件の無いループはcondをNULLとする。
+// 回転が有効なときは入口で一度だけ条件を判定し、本体の末尾で条件が真なら
+// 先頭へ戻るdo-while形式にして、1回の繰り返しの分岐を1つにする。
+static void gen_loop(int c, Node *cond, Node *body, Node *step) {
+    char begin[32], end[32];
+    sprintf(begin, ".Lbegin%d", c);
+    sprintf(end, ".Lend%d", c);
+    char *saved_label = break_label;
+    int saved_depth = break_depth;
+    break_label = end;
+    break_depth = stackpos;
+    if (optimizing(P_ROTATE)) {
+        if (cond != NULL) gen_branch(cond, false, end);
+        align_loop();
+        emit("%s:\n", begin);
+        gen_stmt(body);
+        if (step != NULL) gen_void(step);
+        if (cond != NULL) gen_branch(cond, true, begin);
+        else emit("    jmp %s\n", begin);
+        emit("%s:\n", end);
+    } else {
+        align_loop();
+        emit("%s:\n", begin);
+        // condが偽であれば.Lendラベルへジャンプ
+        if (cond != NULL) gen_branch(cond, false, end);
+        gen_stmt(body);
+        if (step != NULL) gen_void(step);
+        emit("    jmp %s\n", begin);
+        emit("%s:\n", end);
+    }
+    break_label = saved_label;
+    break_depth = saved_depth;
+}
+
+// ベクトル化したループの要素の大きさ(1か4)と誘導変数
+static int vec_size;
+static Var *vec_iv;
+// xmm8から順に全要素に広げて置いたループ不変式
+static Node *vec_invs[5];
+static int vec_ninvs;
+
+// 式が変数を参照するかどうか
+static bool uses_var(Node *node, Var *var) {
+    if (node == NULL) return false;
+    if (node->kind == ND_LVAR && node->var == var) return true;
+    return uses_var(node->left, var) || uses_var(node->right, var);
+}
+
+// ループ不変式を置いたxmmレジスタの番号を返す。初めての式ならraxで計算して全要素に広げる。
+static int vec_inv(Node *node) {
+    for (int i = 0; i < vec_ninvs; i++) {
+        if (same_node(vec_invs[i], node)) return 8 + i;
+    }
+    int r = 8 + vec_ninvs;
+    vec_invs[vec_ninvs++] = node;
+    gen(node);
+    emit("    movd xmm%d, eax\n", r);
+    if (vec_size == 1) {
+        emit("    punpcklbw xmm%d, xmm%d\n", r, r);
+        emit("    pshuflw xmm%d, xmm%d, 0\n", r, r);
+    }
+    emit("    pshufd xmm%d, xmm%d, 0\n", r, r);
+    return r;
+}
+
+// 要素ごとの式のループ不変な部分を、ループに入る前にxmmレジスタへ広げておく。
+static void vec_prepare(Node *node) {
+    if (!uses_var(node, vec_iv)) {
+        vec_inv(node);
+        return;
+    }
+    if (node->kind == ND_DEREF) return;
+    if (node->kind == ND_SHL) {
+        // シフト量は命令の即値にする
+        vec_prepare(node->left);
+        return;
+    }
+    if (node->left) vec_prepare(node->left);
+    if (node->right) vec_prepare(node->right);
+}
+
+// 要素ごとの式を16バイト分まとめてxmm<d>に計算する。d+1, d+2は作業に使う。
+// 比較の結果は真の要素が全ビット1, 偽の要素が0になる。
+static void gen_vec(Node *node, int d) {
+    char *t = vec_size == 1 ? "b" : "d";
+    int a = d, b = d + 1;
+    if (!uses_var(node, vec_iv)) {
+        emit("    movdqa xmm%d, xmm%d\n", d, vec_inv(node));
+        return;
+    }
+    switch (node->kind) {
+        case ND_DEREF:
+            emit("    movdqu xmm%d, XMMWORD PTR %s\n", d, gen_mem(node));
+            return;
+        case ND_NEG:
+            gen_vec(node->right, b);
+            emit("    pxor xmm%d, xmm%d\n", a, a);
+            emit("    psub%s xmm%d, xmm%d\n", t, a, b);
+            return;
+        case ND_SHL:
+            gen_vec(node->left, a);
+            emit("    pslld xmm%d, %d\n", a, node->right->val);
+            return;
+    }
+    gen_vec(node->left, a);
+    gen_vec(node->right, b);
+    switch (node->kind) {
+        case ND_ADD:
+            emit("    padd%s xmm%d, xmm%d\n", t, a, b);
+            return;
+        case ND_SUB:
+            emit("    psub%s xmm%d, xmm%d\n", t, a, b);
+            return;
+        case ND_MUL:
+            // SSE2には32ビットの要素ごとの乗算がないので、偶数番目と奇数番目の要素に分けて掛ける
+            emit("    movdqa xmm%d, xmm%d\n", d + 2, a);
+            emit("    pmuludq xmm%d, xmm%d\n", d + 2, b);
+            emit("    psrlq xmm%d, 32\n", a);
+            emit("    psrlq xmm%d, 32\n", b);
+            emit("    pmuludq xmm%d, xmm%d\n", a, b);
+            emit("    pshufd xmm%d, xmm%d, 8\n", d + 2, d + 2);
+            emit("    pshufd xmm%d, xmm%d, 8\n", a, a);
+            emit("    punpckldq xmm%d, xmm%d\n", d + 2, a);
+            emit("    movdqa xmm%d, xmm%d\n", a, d + 2);
             return;
         case ND_EQ:
-            printf("    cmp rax, rdi\n");
-            printf("    sete al\n");
-            printf("    movzb rax, al\n");
+            emit("    pcmpeq%s xmm%d, xmm%d\n", t, a, b);
             return;
         case ND_NE:
-            printf("    cmp rax, rdi\n");
-            printf("    setne al\n");
-            printf("    movzb rax, al\n");
+            emit("    pcmpeq%s xmm%d, xmm%d\n", t, a, b);
+            emit("    pcmpeqd xmm%d, xmm%d\n", b, b);
+            emit("    pxor xmm%d, xmm%d\n", a, b);
+            return;
+        case ND_GT:
+            emit("    pcmpgt%s xmm%d, xmm%d\n", t, a, b);
+            return;
+        case ND_LT:
+            emit("    pcmpgt%s xmm%d, xmm%d\n", t, b, a);
+            emit("    movdqa xmm%d, xmm%d\n", a, b);
             return;
         case ND_GE:
+            emit("    pcmpgt%s xmm%d, xmm%d\n", t, b, a);
+            emit("    pcmpeqd xmm%d, xmm%d\n", a, a);
+            emit("    pxor xmm%d, xmm%d\n", a, b);
+            return;
         case ND_LE:
-            printf("    cmp rax, rdi\n");
-            printf("    setle al\n");
-            printf("    movzb rax, al\n");
+            emit("    pcmpgt%s xmm%d, xmm%d\n", t, a, b);
+            emit("    pcmpeqd xmm%d, xmm%d\n", b, b);
+            emit("    pxor xmm%d, xmm%d\n", a, b);
             return;
-        case ND_GT:
+    }
+    error("ベクトル化できない式です。");
+}
+
+static bool is_vec_cmp(Node *node) {
+    switch (node->kind) {
+        case ND_EQ:
+        case ND_NE:
         case ND_LT:
-            printf("    cmp rax, rdi\n");
-            printf("    setl al\n");
-            printf("    movzb rax, al\n");
+        case ND_LE:
+        case ND_GT:
+        case ND_GE:
+            return true;
+    }
+    return false;
+}
+
+// 残りの要素が1ブロック分あるか(i + lanes - 1が条件を満たすか)を調べ、whenに一致すればlabelへ飛ぶ。
+static void gen_vec_check(Node *node, bool when, char *label) {
+    Node *cond = node->cond;
+    bool iv_left = cond->kind == ND_LT || cond->kind == ND_LE;
+    bool strict = cond->kind == ND_LT || cond->kind == ND_GT;
+    gen(iv_left ? cond->right : cond->left);
+    emit("    mov rdi, rax\n");
+    gen(node->left);
+    emit("    add rax, %d\n", 16 / vec_size - 1);
+    emit("    cmp rax, rdi\n");
+    if (when) emit("    %s %s\n", strict ? "jl" : "jle", label);
+    else emit("    %s %s\n", strict ? "jge" : "jg", label);
+}
+
+// ベクトル化したループのコード生成。
+// 16バイトずつ処理できる間だけ回り、残りは後に続く元のループが処理する。
+// 総和はxmm14に集め、1バイトの要素の総和はpsadbwで8要素ずつ64ビットに足し込む。
+static void gen_vloop(Node *node) {
+    int c = count();
+    char begin[32], end[32];
+    sprintf(begin, ".Lvbegin%d", c);
+    sprintf(end, ".Lvend%d", c);
+    vec_size = node->val;
+    vec_iv = node->left->var;
+    vec_ninvs = 0;
+    int lanes = 16 / vec_size;
+
+    // 書き込み先と読み込み元が1ブロック未満の距離で後ろに重なるなら元のループに任せる
+    for (int i = 0; i < node->nparams; i += 2) {
+        gen(node->params[i]);
+        push();
+        gen(node->params[i + 1]);
+        pop("rdi");
+        emit("    sub rdi, rax\n");
+        emit("    sub rdi, 1\n");
+        emit("    cmp rdi, 15\n");
+        emit("    jb %s\n", end);
+    }
+    Node *expr = node->ireg == VEC_MAP ? node->body->right : node->body;
+    vec_prepare(expr);
+    bool cmp = is_vec_cmp(expr);
+    if (node->ireg == VEC_REDUCE) {
+        emit("    pxor xmm14, xmm14\n");
+        if (vec_size == 1 && !cmp) {
+            // 符号付きの要素を0x80との排他的論理和で128だけずらし、8要素ごとに1024を引く
+            emit("    mov eax, -2139062144\n");
+            emit("    movd xmm15, eax\n");
+            emit("    pshufd xmm15, xmm15, 0\n");
+            emit("    mov eax, 1024\n");
+            emit("    movq xmm13, rax\n");
+            emit("    punpcklqdq xmm13, xmm13\n");
+        }
+    }
+    gen_vec_check(node, false, end);
+    align_loop();
+    emit("%s:\n", begin);
+    gen_vec(expr, 0);
+    switch (node->ireg) {
+        case VEC_MAP:
+            if (cmp) {
+                // 比較の結果を0か1にする
+                emit("    pxor xmm1, xmm1\n");
+                emit("    psub%s xmm1, xmm0\n", vec_size == 1 ? "b" : "d");
+                emit("    movdqa xmm0, xmm1\n");
+            }
+            emit("    movdqu XMMWORD PTR %s, xmm0\n", gen_mem(node->body->left));
+            break;
+        case VEC_REDUCE:
+            if (vec_size == 4) {
+                emit("    %s xmm14, xmm0\n", cmp ? "psubd" : "paddd");
+            } else if (cmp) {
+                emit("    pxor xmm1, xmm1\n");
+                emit("    psubb xmm1, xmm0\n");
+                emit("    pxor xmm0, xmm0\n");
+                emit("    psadbw xmm1, xmm0\n");
+                emit("    paddq xmm14, xmm1\n");
+            } else {
+                emit("    pxor xmm0, xmm15\n");
+                emit("    pxor xmm1, xmm1\n");
+                emit("    psadbw xmm0, xmm1\n");
+                emit("    paddq xmm14, xmm0\n");
+                emit("    psubq xmm14, xmm13\n");
+            }
+            break;
+        case VEC_SCAN:
+            if (cmp) {
+                emit("    pmovmskb eax, xmm0\n");
+                emit("    test eax, eax\n");
+                emit("    jne %s\n", end);
+            } else {
+                // 0でない要素があるか
+                emit("    pxor xmm1, xmm1\n");
+                emit("    pcmpeq%s xmm0, xmm1\n", vec_size == 1 ? "b" : "d");
+                emit("    pmovmskb eax, xmm0\n");
+                emit("    cmp eax, 65535\n");
+                emit("    jne %s\n", end);
+            }
+            break;
+    }
+    if (vec_iv->reg) {
+        emit("    add %s, %d\n", VREGS[vec_iv->reg], lanes);
+    } else {
+        emit("    add DWORD PTR %s, %d\n", gen_mem(node->left), lanes);
+    }
+    gen_vec_check(node, true, begin);
+    emit("%s:\n", end);
+    if (node->ireg != VEC_REDUCE) return;
+    // 要素ごとの部分和を合計して変数に足す
+    emit("    pshufd xmm0, xmm14, 78\n");
+    if (vec_size == 4) {
+        emit("    paddd xmm14, xmm0\n");
+        emit("    pshufd xmm0, xmm14, 177\n");
+        emit("    paddd xmm14, xmm0\n");
+        emit("    movd eax, xmm14\n");
+    } else {
+        emit("    paddq xmm14, xmm0\n");
+        emit("    movq rax, xmm14\n");
+    }
+    Var *acc = node->right->var;
+    if (acc->reg) {
+        emit("    add rax, %s\n", VREGS[acc->reg]);
+        store_reg(acc);
+    } else {
+        emit("    add DWORD PTR %s, eax\n", gen_mem(node->right));
+    }
+}
+
+static void store_params(Function *func);
+static void gen_epilogue(void);
+
+static void find_addr(Node *node, int depth, void *arg) {
+    if (node->kind == ND_ADDR && node->right->kind == ND_LVAR) *(bool *) arg = true;
+}
+
+// ローカル変数のアドレスが関数の外に渡りうるかどうか
+static bool frame_escapes(Function *func) {
+    bool found = false;
+    for (int i = 0; i < func->nvars; i++) {
+        if (func->vars[i]->type->ty == ARRAY) return true;
+    }
+    for (Node *node = func->code; node != NULL; node = node->next) {
+        walk(node, 0, find_addr, &found);
+    }
+    return found;
+}
+
+// return f(...)をジャンプにできるかどうか。
+// 呼び出し先は翻訳単位内の関数に限る(外部の関数は戻り値の上位ビットを補う必要がある)。
+static bool is_tail_call(Node *node) {
+    return tail_ok && node->kind == ND_FUNCCALL && node->nparams <= 6 && defined(node->name);
+}
+
+// 末尾呼び出し: 自己再帰なら仮引数を置き換えて関数の先頭へ、
+// それ以外はフレームを破棄してから呼び出し先へジャンプする。
+static void gen_tail_call(Node *node) {
+    gen_args(node);
+    if (!strcmp(node->name, current->name)) {
+        store_params(current);
+        emit("    jmp .%s.entry\n", current->name);
+        return;
+    }
+    int depth = stackpos;
+    gen_epilogue();
+    stackpos = depth;
+    emit("    jmp %s\n", node->name);
+}
+
+// 比較の連鎖で分岐するcaseの数の上限
+#define SWITCH_LINEAR 3
+// ジャンプテーブルにするcaseの数の下限と、値の範囲に対するcaseの数の密度の下限(1/SWITCH_DENSITY)
+#define SWITCH_TABLE 4
+#define SWITCH_DENSITY 3
+
+typedef struct Cases Cases;
+struct Cases {
+    Node **cases;   // defaultを除くcaseラベル
+    int n;
+    Node *dflt;
+    char dflt_label[32];    // defaultラベルがなければswitch文の末尾
+    int ntables;
+    int nsplits;
+};
+
+// switch文の本体のcaseラベルを集め、ラベルの番号を付ける。入れ子のswitch文の中は除く。
+static void collect_cases(Node *node, Cases *c) {
+    if (node == NULL) return;
+    switch (node->kind) {
+        case ND_SWITCH:
+            return;
+        case ND_CASE:
+            node->label = count();
+            if (node->is_default) {
+                c->dflt = node;
+            } else {
+                c->cases = realloc(c->cases, (c->n + 1) * sizeof(Node *));
+                c->cases[c->n++] = node;
+            }
+            break;
+        case ND_BLOCK:
+            for (Node *p = node->right; p != NULL; p = p->next) {
+                collect_cases(p, c);
+            }
             return;
     }
-    error("不正な式です。");
+    collect_cases(node->cond, c);
+    collect_cases(node->body, c);
+    collect_cases(node->els, c);
+    collect_cases(node->initialization, c);
+    collect_cases(node->step, c);
+    collect_cases(node->left, c);
+    collect_cases(node->right, c);
+    for (int i = 0; i < node->nparams; i++) {
+        collect_cases(node->params[i], c);
+    }
+}
+
+static int compare_cases(const void *a, const void *b) {
+    int x = (*(Node **) a)->val, y = (*(Node **) b)->val;
+    return x < y ? -1 : x > y;
+}
+
+// 値の範囲に対してcaseが十分に密かどうか
+static bool dense(Cases *c, int lo, int hi) {
+    long range = (long) c->cases[hi - 1]->val - c->cases[lo]->val + 1;
+    return hi - lo >= SWITCH_TABLE && range <= (long) (hi - lo) * SWITCH_DENSITY;
+}
+
+// eaxの値でc->cases[lo..hi)のどれかへ分岐し、どれでもなければdefaultへ分岐する。
+// 少なければ比較の連鎖、密ならジャンプテーブル、それ以外は中央の値で二分する。rdxを作業用に使う。
+static void gen_dispatch(Cases *c, int lo, int hi) {
+    if (hi - lo <= SWITCH_LINEAR || !optimizing(P_SWITCH)) {
+        for (int i = lo; i < hi; i++) {
+            emit("    cmp eax, %d\n", c->cases[i]->val);
+            emit("    je .Lcase%d\n", c->cases[i]->label);
+        }
+        emit("    jmp %s\n", c->dflt_label);
+        return;
+    }
+    if (dense(c, lo, hi)) {
+        // 表の各要素は表の先頭からcaseラベルまでの距離(位置独立)
+        int t = count();
+        int min = c->cases[lo]->val, max = c->cases[hi - 1]->val;
+        if (min) emit("    sub eax, %d\n", min);
+        emit("    cmp eax, %u\n", (unsigned) max - (unsigned) min);
+        emit("    ja %s\n", c->dflt_label);
+        emit("    lea rdx, [rip+.Ltable%d]\n", t);
+        emit("    movsxd rax, DWORD PTR [rdx+rax*4]\n");
+        emit("    add rax, rdx\n");
+        emit("    jmp rax\n");
+        emit("    .section .rodata\n");
+        emit("    .p2align 2\n");
+        emit(".Ltable%d:\n", t);
+        for (int i = lo, v = min; i < hi; v++) {
+            if (c->cases[i]->val == v) {
+                emit("    .long .Lcase%d-.Ltable%d\n", c->cases[i++]->label, t);
+            } else {
+                emit("    .long %s-.Ltable%d\n", c->dflt_label, t);
+            }
+        }
+        emit("    .text\n");
+        c->ntables++;
+        return;
+    }
+    int mid = (lo + hi) / 2;
+    int b = count();
+    emit("    cmp eax, %d\n", c->cases[mid]->val);
+    emit("    je .Lcase%d\n", c->cases[mid]->label);
+    emit("    jg .Lsplit%d\n", b);
+    c->nsplits++;
+    gen_dispatch(c, lo, mid);
+    emit(".Lsplit%d:\n", b);
+    gen_dispatch(c, mid + 1, hi);
+}
+
+// switch文の本体のcaseラベルを集めてラベルの番号を付け、defaultを除いて値の順に並べる。
+// caseの数を返す。
+int switch_cases(Node *body, Node ***cases, Node **dflt) {
+    Cases c = {0};
+    collect_cases(body, &c);
+    qsort(c.cases, c.n, sizeof(Node *), compare_cases);
+    *cases = c.cases;
+    *dflt = c.dflt;
+    return c.n;
+}
+
+// eaxの値でcaseラベル(.Lcase<番号>)へ分岐し、どれでもなければdflt_labelへ分岐する。
+void gen_case_dispatch(Function *fn, Node **cases, int n, char *dflt_label) {
+    Cases cs = {cases, n};
+    strcpy(cs.dflt_label, dflt_label);
+    gen_dispatch(&cs, 0, n);
+    nswitches++;
+    if (n <= SWITCH_LINEAR || !optimizing(P_SWITCH)) {
+        opt_report(P_SWITCH, "%s: switch %d: %d cases, compare chain", fn->name, nswitches, n);
+    } else {
+        opt_report(P_SWITCH, "%s: switch %d: %d cases, %d jump tables, %d binary splits", fn->name,
+                   nswitches, n, cs.ntables, cs.nsplits);
+    }
+}
+
+// switch文のコード生成。条件の値で分岐してから本体を生成し、caseラベルは本体の中で出力する。
+static void gen_switch(Node *node) {
+    int c = count();
+    char end[32], dflt_label[32];
+    sprintf(end, ".Lend%d", c);
+    Node **cases, *dflt;
+    int n = switch_cases(node->body, &cases, &dflt);
+    if (dflt) sprintf(dflt_label, ".Lcase%d", dflt->label);
+    else strcpy(dflt_label, end);
+    gen(node->cond);
+    gen_case_dispatch(current, cases, n, dflt_label);
+    free(cases);
+
+    char *saved_label = break_label;
+    int saved_depth = break_depth;
+    break_label = end;
+    break_depth = stackpos;
+    gen_stmt(node->body);
+    break_label = saved_label;
+    break_depth = saved_depth;
+    emit("%s:\n", end);
 }
 
 void gen_stmt(Node *node) {
     switch (node->kind) {
-        case ND_RETURN:
+        case ND_RETURN: {
+            // 関数の末尾にあるreturnか(インライン展開した本体なら、展開箇所が末尾にあるか)
+            bool tail = node->name ? tail_label && !strcmp(node->name, tail_label) : stmt_expr_depth == 0;
+            if (tail && is_tail_call(node->right)) {
+                gen_tail_call(node->right);
+                return;
+            }
+            char *saved = tail_label;
+            if (tail && node->right->kind == ND_BLOCK) tail_label = node->right->name;
             gen(node->right);
-            printf("    jmp .%s.return\n", label);
+            tail_label = saved;
+            // rbpを使わないときは文式の中で積んだ分をここで戻す
+            if (frameless && node->name == NULL && stackpos > nsaved * 8) {
+                emit("    add rsp, %d\n", stackpos - nsaved * 8);
+            }
+            // インライン展開した本体のreturnは展開箇所の末尾へ飛ぶ
+            emit("    jmp .%s.return\n", node->name ? node->name : label);
             return;
+        }
         case ND_IF: {
             int c = count();
-            gen(node->cond);
-            // condの結果を0と比較し、0であればLelseラベルへジャンプ
-            printf("    cmp rax, 0\n");
-            printf("    je .Lelse%d\n", c);
+            char buf[32];
+            // condが偽であればLelseラベルへジャンプ
+            sprintf(buf, ".Lelse%d", c);
+            gen_branch(node->cond, false, buf);
             // bodyのコード生成
             gen_stmt(node->body);
-            printf("    jmp .Lend%d\n", c);
+            emit("    jmp .Lend%d\n", c);
             // elsのコード生成
-            printf(".Lelse%d:\n", c);
+            emit(".Lelse%d:\n", c);
             if (node->els != NULL) {
                 gen_stmt(node->els);
             }
-            printf(".Lend%d:\n", c);
+            emit(".Lend%d:\n", c);
             return;
         }
         case ND_FOR: {
@@ -201,36 +1575,29 @@ void gen_stmt(Node *node) {
             if (node->initialization != NULL) {
                 gen_stmt(node->initialization);
             }
-            printf(".Lbegin%d:\n", c);
-            
-            if (node->cond != NULL) {
-                gen(node->cond);
-                // condの結果を0と比較し、0でなければ.Lendラベルへジャンプ
-                printf("    cmp rax, 0\n");
-                printf("    je .Lend%d\n", c);
-            }
-            gen_stmt(node->body);
-            if (node->step != NULL) {
-                gen(node->step);
-            }
-            printf("    jmp .Lbegin%d\n", c);
-            printf(".Lend%d:\n", c);
+            gen_loop(c, node->cond, node->body, node->step);
             return;
         }
         case ND_WHILE: {
             int c = count();
-            printf(".Lbegin%d:\n", c);
-            gen(node->cond);
-            // condの結果を0と比較し、0でなければ.L3ラベルへジャンプ
-            printf("    cmp rax, 0\n");
-            printf("    je .Lend%d\n", c);
-            
-            gen_stmt(node->body);
-            printf("    jmp .Lbegin%d\n", c);
-            printf(".Lend%d:\n", c);
-            
+            gen_loop(c, node->cond, node->body, NULL);
             return;
         }
+        case ND_VLOOP:
+            gen_vloop(node);
+            return;
+        case ND_SWITCH:
+            gen_switch(node);
+            return;
+        case ND_CASE:
+            emit(".Lcase%d:\n", node->label);
+            gen_stmt(node->body);
+            return;
+        case ND_BREAK:
+            // 文式の中で積んだ分を戻してから抜ける
+            if (stackpos > break_depth) emit("    add rsp, %d\n", stackpos - break_depth);
+            emit("    jmp %s\n", break_label);
+            return;
         case ND_BLOCK: {
             node = node->right;
             while (node != NULL) {
@@ -240,7 +1607,12 @@ void gen_stmt(Node *node) {
             return;
         }
         case ND_EXPR_STMT:{
-            gen(node->right);
+            // 文式の中で文の列の最後にある文は値が使われうる
+            if (stmt_expr_depth == 0 || node->next != NULL) {
+                gen_void(node->right);
+            } else {
+                gen(node->right);
+            }
             return;
         }
     }
@@ -250,11 +1622,11 @@ void gen_stmt(Node *node) {
 void glblgen(Var *globals) {
     if(globals == NULL) return;
     glblgen(globals->next);
-    if (globals->generated) return;
+    if (globals->generated || globals->dead) return;
     globals->generated = true;
-    printf(".data\n");
-    printf(".global %s\n",globals->str);
-    printf("%s:\n", globals->str);
+    emit(".data\n");
+    if (!globals->is_static) emit(".global %s\n",globals->str);
+    emit("%s:\n", globals->str);
     Type *type = globals->type;
     int size;
     if (type->ty == INT) {
@@ -273,15 +1645,15 @@ void glblgen(Var *globals) {
             size *= 8;
         }
     }
-    printf(".zero %d\n", size);
+    emit(".zero %d\n", size);
 }
 // TODO 長い文字列対応
 void gen_const_str0() {
     Var *p = strings->entry;
     if (p) {
         do {
-            printf(".LC%d:\n", p->offset);
-            printf("    .string \"%s\"\n", p->str);
+            emit(".LC%d:\n", p->offset);
+            emit("    .string \"%s\"\n", p->str);
         } while ((p = p->next) != NULL);
     }
 }
@@ -289,45 +1661,198 @@ void gen_const_str0() {
 void gen_const_str() {
     Var *p = strings->entry;
     if (p) {
-        printf(".data\n");
+        emit(".data\n");
         do {
             char *c = p->name;
             int len = p->type->size;
-            printf(".global %s\n", p->str);
-            printf("%s:\n", p->str);
+            emit(".global %s\n", p->str);
+            emit("%s:\n", p->str);
             for (int i = 0; i < len - 1; i++) {
-                printf("    .byte %d\n", c[i]);
+                emit("    .byte %d\n", c[i]);
             }
-            printf("    .byte %d\n", 0);
+            emit("    .byte %d\n", 0);
         } while ((p = p->next) != NULL);
     }
 }
 
+// 型の境界調整の大きさ
+int align_of(Type *type) {
+    if (type->ty == ARRAY) return align_of(type->ptr_to);
+    return type->size ? type->size : 1;
+}
+
+// 生存区間の重ならない変数と重ならない、varを置ける最も浅いオフセットを返す。
+static int free_slot(Function *func, Var *var, int base, int *start, int *end) {
+    int size = var->type->size, align = align_of(var->type);
+    int offset = roundup(base + size, align);
+    bool moved = true;
+    while (moved) {
+        moved = false;
+        for (int i = 0; i < func->nvars; i++) {
+            Var *v = func->vars[i];
+            // 参照されない変数はどこに置いてもよい
+            if (v == var || v->reg || v->offset <= 0 || start[i] < 0 || start[var->index] < 0) continue;
+            if (start[i] > end[var->index] || end[i] < start[var->index]) continue;
+            // [offset - size, offset) と [v->offset - v->size, v->offset) が重なれば深い方へずらす
+            if (offset - size < v->offset && v->offset - v->type->size < offset) {
+                offset = roundup(v->offset + size, align);
+                moved = true;
+            }
+        }
+    }
+    return offset;
+}
+
+// ローカル変数のRBPからのオフセットを決め、フレームの大きさを返す。
+// baseはフレームの先頭に確保済みの大きさで、レジスタに割り当てた変数には領域を割り当てない。
+// 境界調整の大きい変数から順に詰めて置く。
+// -fstack-reuseでは生存区間の重ならない変数(別々のブロックの配列など)に同じ領域を使う。
+// 7個目以降の仮引数は呼び出し側が積んだ位置(戻り番地の上)をそのまま使う。
+static int layout(Function *func, int base) {
+    int size = base;
+    for (int i = 6; i < func->nparams; i++) {
+        func->params[i]->offset = -((frameless ? 8 : 16) + (i - 6) * 8);
+    }
+    int *start = NULL, *end = NULL;
+    if (optimizing(P_STACKREUSE)) {
+        start = calloc(func->nvars + 1, sizeof(int));
+        end = calloc(func->nvars + 1, sizeof(int));
+        live_ranges(func, start, end);
+    }
+    int unshared = base;
+    for (int align = 8; align >= 1; align /= 2) {
+        for (int i = 0; i < func->nvars; i++) {
+            Var *var = func->vars[i];
+            if (var->reg || align_of(var->type) != align || var->offset < 0) continue;
+            unshared = roundup(unshared + var->type->size, align);
+            if (start == NULL) {
+                var->offset = size = unshared;
+            } else {
+                var->offset = free_slot(func, var, base, start, end);
+                if (var->offset > size) size = var->offset;
+            }
+        }
+    }
+    if (start) {
+        if (size < unshared) opt_report(P_STACKREUSE, "%s: %d -> %d bytes", func->name, unshared, size);
+        free(start);
+        free(end);
+    }
+    return size;
+}
+
+// 関数で使うcallee-savedレジスタの数を返す。
+static int saved_regs(Function *func) {
+    int n = 0;
+    for (int i = 0; i < func->nvars; i++) {
+        int reg = func->vars[i]->reg;
+        if (reg <= NCALLEE_REGS && reg > n) n = reg;
+    }
+    return n;
+}
+
+// スタック上に置く変数の数を返す。
+static int on_stack(Function *func) {
+    int n = 0;
+    for (int i = 0; i < func->nvars; i++) {
+        if (!func->vars[i]->reg) n++;
+    }
+    return n;
+}
+
+// 引数レジスタの値を仮引数の変数に格納する。
+static void store_params(Function *func) {
+    for (int j = 0; j < func->nparams; j++) {
+        int index = func->nparams - j - 1;
+        Var *param = func->params[index];
+        if (index >= 6) {
+            // スタックで渡された仮引数はレジスタに割り当てたときだけ読み込む
+            if (param->reg) load_reg(param->type, VREGS[param->reg], frame_ref(-param->offset, NULL, 0));
+            continue;
+        }
+        char *src = reg_part(param->type, MREGS8[index], MREGS32[index], MREGS[index]);
+        if (param->reg) {
+            // 呼び出し側は上位ビットを保証しないので符号拡張する
+            char *op = param->type->ty == CHAR ? "movsx" : param->type->ty == INT ? "movsxd" : "mov";
+            emit("    %s %s, %s\n", op, VREGS[param->reg], src);
+            continue;
+        }
+        emit("    mov %s PTR %s, %s\n", ptr_size(param->type), frame_ref(-param->offset, NULL, 0), src);
+    }
+}
+
+// callee-savedレジスタを復元してフレームを破棄する(retは含まない)。
+static void gen_epilogue(void) {
+    if (frameless) {
+        if (frame_extra) emit("    add rsp, %d\n", frame_extra);
+        for (int r = nsaved; r >= 1; r--) {
+            pop(VREGS[r]);
+        }
+        return;
+    }
+    if (nsaved) {
+        emit("    lea rsp, [rbp-%d]\n", nsaved * 8);
+        for (int r = nsaved; r >= 1; r--) {
+            emit("    pop %s\n", VREGS[r]);
+            stackpos -= 8;
+        }
+    } else {
+        emit("    mov rsp, rbp\n");
+    }
+    pop("rbp");
+}
+
 void codegen(Code *prog) {
-    printf(".intel_syntax noprefix\n");
+    unit = prog;
+    emit(".intel_syntax noprefix\n");
     // 文字列リテラルのコード生成
     gen_const_str();
     for (int i = prog->n - 1; i >= 0; i--) {
         Function *func = prog->function[i];
         // (TODO) グローバル変数のコード生成
         glblgen(func->globals);
+        // 参照されないstaticな関数は出力しない
+        if (func->dead) continue;
+        nsaved = 0;
+        nswitches = 0;
+        // SSA形式に変換した関数は三番地コードから命令を選択する(isel.c)
+        if (func->blocks) {
+            gen_ir(func);
+            flush();
+            continue;
+        }
         // 関数のコード生成
         if (func->name) {
-            printf(".global %s\n", func->name);
-            printf(".text\n");
-            printf("%s:\n", func->name);
-            printf("    mov rax, rbp\n");
-            push();
-            printf("    mov rbp, rsp\n");
-            
-            for (int j = 0; j < func->nparams; j++) {
-                int index = func->nparams - j - 1;
-                printf("    mov rax, rbp\n");
-                printf("    sub rax, %d\n", (index + 1)*8);
-                printf("    mov [rax], %s\n", MREGS[index]);
+            if (!func->is_static) emit(".global %s\n", func->name);
+            emit(".text\n");
+            emit("%s:\n", func->name);
+            // スタック上に変数を持たない葉関数と-fomit-frame-pointerではrbpを使わない
+            bool leaf = is_leaf(func);
+            frameless = optimizing(P_OMITFP) || (optimizing(P_LEAFFRAME) && leaf && on_stack(func) == 0);
+            if (!frameless) {
+                emit("    push rbp\n");
+                stackpos += 8;
+                emit("    mov rbp, rsp\n");
+            }
+            // callee-savedレジスタの退避。ローカル変数はその下に置く
+            nsaved = saved_regs(func);
+            for (int r = 1; r <= nsaved; r++) {
+                emit("    push %s\n", VREGS[r]);
+                stackpos += 8;
             }
-            // TODO ローカル変数領域の確保
-            printf("    sub rsp, %d\n", func->stack_size);
+            func->stack_size = layout(func, nsaved * 8);
+            // ローカル変数領域の確保(関数呼び出しのためRSPを16バイト境界に揃える)
+            // rbpを使わないときは戻り番地の分だけずれるので8を足して揃える
+            frame_base = stackpos;
+            int frame = roundup(func->stack_size, 16);
+            if (frameless) frame = leaf ? roundup(func->stack_size, 8) : roundup(func->stack_size + 8, 16) - 8;
+            frame_extra = frame - nsaved * 8;
+            if (frame_extra) emit("    sub rsp, %d\n", frame_extra);
+            store_params(func);
+            current = func;
+            tail_ok = optimizing(P_TAILCALL) && !frame_escapes(func);
+            // 自己末尾再帰の飛び先
+            if (tail_ok) emit(".%s.entry:\n", func->name);
         }
         
         // コードの本体部分の出力
@@ -337,10 +1862,13 @@ void codegen(Code *prog) {
         }
         //エピローグ
         if (func->name) {
-            printf(".%s.return:\n", label);
-            printf("    mov rsp, rbp\n");
-            pop("rbp");
-            printf("    ret\n");
+            emit(".%s.return:\n", label);
+            gen_epilogue();
+            emit("    ret\n");
         }
+        // 関数ごとに命令列を最適化して出力する
+        flush();
     }
+    flush();
+    peephole_report();
 }
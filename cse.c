@@ -0,0 +1,324 @@
+//
+//  cse.c
+//  tinycc
+//
+//  Created by sanluisrey on 2026/10/19.
+//
+
+#include "tinycc.h"
+
+// 基本ブロック内の共通部分式の除去
+//
+// 分岐もループも含まない文の並びを基本ブロックとし、その中で2回以上現れる副作用のない式
+// (アドレス計算、ロード、算術演算)を一時変数に一度だけ計算して使い回す。
+// 対象にする文は、副作用のない値をすべて計算してから1つだけ書き込みや呼び出しを行うもの
+// (代入、関数呼び出し、副作用のない式)に限る。こうした文では式を文の前に計算しても値は変わらない。
+//
+// 別名の扱いは保守的に行う:
+// アドレスを取られていないローカル変数はその変数への代入だけが値を変える。
+// それ以外のメモリ(*p, 配列の要素, グローバル変数, アドレスを取られた変数)は
+// ポインタ経由の書き込み、それらへの代入、関数呼び出しのどれでも値が変わりうるとみなす。
+
+#define MAX_STMTS 64
+#define MAX_EXPRS 256
+
+// 文の書き込みの種類
+enum {
+    KILL_NONE,  // 書き込みなし
+    KILL_VAR,   // アドレスを取られていないローカル変数への代入
+    KILL_MEM,   // メモリへの書き込みまたは関数呼び出し
+};
+
+typedef struct Stmt Stmt;
+struct Stmt {
+    Node **link;    // 文を指すポインタ(前の文のnextかブロックの先頭)
+    Node **reads[8];  // 書き込みより前に計算する式
+    int nreads;
+    int kill;
+    Var *var;       // KILL_VARのときの変数
+};
+
+typedef struct Occur Occur;
+struct Occur {
+    Node **ref;     // 式を指すポインタ
+    int stmt;       // 式を含む文の番号
+    int size;       // 式のノード数
+};
+
+static int ntemps;
+static int nreplaced;
+
+// 式がメモリを読むかどうか(配列やアドレスは値を読まない)
+static bool reads_mem(Node *node) {
+    if (node == NULL) return false;
+    switch (node->kind) {
+        case ND_DEREF:
+        case ND_GVAR:
+            if (is_scalar(node->type)) return true;
+            break;
+        case ND_LVAR:
+            return node->var->escaped && is_scalar(node->type);
+        case ND_ADDR:
+            // &*pのpは読むが、&xや&a[i]の要素は読まない
+            if (node->right->kind == ND_DEREF) return reads_mem(node->right->right);
+            return false;
+    }
+    return reads_mem(node->left) || reads_mem(node->right);
+}
+
+// 式が変数varを読むかどうか
+static bool reads_var(Node *node, Var *var) {
+    if (node == NULL) return false;
+    if (node->kind == ND_LVAR) return node->var == var;
+    return reads_var(node->left, var) || reads_var(node->right, var);
+}
+
+// 文の書き込みが式の値を変えうるかどうか
+static bool kills(Stmt *s, Node *node) {
+    switch (s->kill) {
+        case KILL_VAR:
+            return reads_var(node, s->var);
+        case KILL_MEM:
+            return reads_mem(node);
+    }
+    return false;
+}
+
+// 代入先への書き込みの種類を決める。
+static void set_kill(Stmt *s, Node *lhs) {
+    if (lhs->kind == ND_LVAR && !lhs->var->escaped) {
+        s->kill = KILL_VAR;
+        s->var = lhs->var;
+    } else {
+        s->kill = KILL_MEM;
+    }
+}
+
+// 文を読み取りと書き込みに分解する。対象にできない文なら偽を返す。
+static bool classify(Node *node, Stmt *s) {
+    s->nreads = 0;
+    s->kill = KILL_NONE;
+    if (node->kind == ND_RETURN || node->kind == ND_IF) {
+        Node **e = node->kind == ND_RETURN ? &node->right : &node->cond;
+        if (!is_pure(*e)) return false;
+        s->reads[s->nreads++] = e;
+        return true;
+    }
+    if (node->kind != ND_EXPR_STMT) return false;
+    Node *e = node->right;
+    if (is_pure(e)) {
+        s->reads[s->nreads++] = &node->right;
+        return true;
+    }
+    if (e->kind == ND_ASGMT) {
+        Node *lhs = e->left;
+        if (!is_pure(lhs) || !is_pure(e->right)) return false;
+        if (lhs->kind == ND_DEREF) s->reads[s->nreads++] = &lhs->right;
+        s->reads[s->nreads++] = &e->right;
+        set_kill(s, lhs);
+        return true;
+    }
+    if (e->kind == ND_FUNCCALL) {
+        if (e->nparams > 8) return false;
+        for (int i = 0; i < e->nparams; i++) {
+            if (!is_pure(e->params[i])) return false;
+            s->reads[s->nreads++] = &e->params[i];
+        }
+        s->kill = KILL_MEM;
+        return true;
+    }
+    return false;
+}
+
+static bool is_leaf_node(Node *node) {
+    return node->kind == ND_NUM || (node->kind == ND_LVAR && !reads_mem(node));
+}
+
+// アドレッシングモードや即値に畳み込まれ、一時変数にしても得にならない式かどうか
+// (i << 2, i + 1 など)
+static bool cheap(Node *node) {
+    switch (node->kind) {
+        case ND_SHL:
+            return is_leaf_node(node->left);
+        case ND_ADD:
+        case ND_SUB:
+            return iscint(node->type) && is_leaf_node(node->left) && node->right->kind == ND_NUM;
+    }
+    return false;
+}
+
+// 一時変数に置き換える価値のある式の候補を集める。
+static int collect(Node **ref, int stmt, Occur *occ, int n) {
+    Node *node = *ref;
+    if (node == NULL) return n;
+    switch (node->kind) {
+        case ND_ADDR:
+            // &a[i]の要素は読まないので、アドレス計算の部分だけを候補にする
+            if (node->right->kind == ND_DEREF) return collect(&node->right->right, stmt, occ, n);
+            return n;
+        case ND_GVAR:
+        case ND_LVAR:
+            // メモリにある変数のロード
+            if (reads_mem(node) && n < MAX_EXPRS) occ[n++] = (Occur) {ref, stmt, 1};
+            return n;
+        case ND_ADD:
+        case ND_SUB:
+        case ND_MUL:
+        case ND_DIV:
+        case ND_MOD:
+        case ND_SHL:
+        case ND_NEG:
+        case ND_DEREF:
+            n = collect(&node->left, stmt, occ, n);
+            n = collect(&node->right, stmt, occ, n);
+            // 配列の先頭からのアドレス計算はポインタとして扱う
+            bool addr = node->kind != ND_DEREF && isarray(node->type);
+            if ((is_scalar(node->type) || addr) && !cheap(node) && n < MAX_EXPRS) {
+                int size = 0;
+                for (int i = 0; i < n; i++) {
+                    // 部分式は直前に集めてあるので、その大きさを足していく
+                    if (occ[i].stmt == stmt && (occ[i].ref == &node->left || occ[i].ref == &node->right)) {
+                        size += occ[i].size;
+                    }
+                }
+                occ[n++] = (Occur) {ref, stmt, size + 1};
+            }
+            return n;
+    }
+    n = collect(&node->left, stmt, occ, n);
+    return collect(&node->right, stmt, occ, n);
+}
+
+// 基本ブロック中の最も大きい共通部分式を1つ一時変数に置き換える。置き換えたら真を返す。
+static bool eliminate(Function *fn, Stmt *stmts, int nstmts) {
+    static Occur occ[MAX_EXPRS];
+    int n = 0;
+    for (int i = 0; i < nstmts; i++) {
+        for (int j = 0; j < stmts[i].nreads; j++) {
+            n = collect(stmts[i].reads[j], i, occ, n);
+        }
+    }
+    int best = -1, best_size = 0;
+    for (int i = 0; i < n; i++) {
+        if (occ[i].size <= best_size) continue;
+        for (int j = i + 1; j < n; j++) {
+            if (!same_node(*occ[i].ref, *occ[j].ref)) continue;
+            bool valid = true;
+            for (int k = occ[i].stmt; k < occ[j].stmt; k++) {
+                if (kills(&stmts[k], *occ[i].ref)) valid = false;
+            }
+            if (valid) {
+                best = i;
+                best_size = occ[i].size;
+                break;
+            }
+        }
+    }
+    if (best < 0) return false;
+
+    // 最初に現れる文の前で一時変数に計算しておく
+    Node *expr = *occ[best].ref;
+    Var *tmp = new_temp(fn, "cse", expr->type);
+    ntemps++;
+
+    for (int j = n - 1; j > best; j--) {
+        if (!same_node(*occ[j].ref, expr)) continue;
+        bool valid = true;
+        for (int k = occ[best].stmt; k < occ[j].stmt; k++) {
+            if (kills(&stmts[k], expr)) valid = false;
+        }
+        if (valid) {
+            *occ[j].ref = new_node_var(tmp);
+            nreplaced++;
+        }
+    }
+    *occ[best].ref = new_node_var(tmp);
+
+    Node *asgmt = calloc(1, sizeof(Node));
+    asgmt->kind = ND_ASGMT;
+    asgmt->type = tmp->type;
+    asgmt->left = new_node_var(tmp);
+    asgmt->right = expr;
+    Node *stmt = calloc(1, sizeof(Node));
+    stmt->kind = ND_EXPR_STMT;
+    stmt->right = asgmt;
+    Node **link = stmts[occ[best].stmt].link;
+    stmt->next = *link;
+    *link = stmt;
+    return true;
+}
+
+static void cse_list(Function *fn, Node **link);
+
+// 文の中に入れ子になった文の並びを処理する。
+static void cse_nested(Function *fn, Node *node) {
+    if (node == NULL) return;
+    switch (node->kind) {
+        case ND_BLOCK:
+            cse_list(fn, &node->right);
+            return;
+        case ND_IF:
+            cse_nested(fn, node->body);
+            cse_nested(fn, node->els);
+            return;
+        case ND_FOR:
+        case ND_WHILE:
+        case ND_SWITCH:
+        case ND_CASE:
+            cse_nested(fn, node->body);
+            return;
+    }
+    // 文式やインライン展開した本体
+    cse_nested(fn, node->left);
+    cse_nested(fn, node->right);
+    for (int i = 0; i < node->nparams; i++) {
+        cse_nested(fn, node->params[i]);
+    }
+}
+
+// 文の並びを基本ブロックに分けて処理する。
+static void cse_list(Function *fn, Node **link) {
+    static Stmt stmts[MAX_STMTS];
+    while (*link) {
+        // 基本ブロックを集める(returnとifの条件はブロックの最後に含める)
+        int n = 0;
+        Node **p = link;
+        bool changed = true;
+        while (changed) {
+            n = 0;
+            for (p = link; *p && n < MAX_STMTS; p = &(*p)->next) {
+                Stmt *s = &stmts[n];
+                if (!classify(*p, s)) break;
+                s->link = p;
+                n++;
+                if ((*p)->kind == ND_RETURN || (*p)->kind == ND_IF) {
+                    p = &(*p)->next;
+                    break;
+                }
+            }
+            changed = n > 0 && eliminate(fn, stmts, n);
+        }
+        if (n == 0) {
+            // 対象にできない文: 中の文の並びを処理して次へ
+            cse_nested(fn, *link);
+            link = &(*link)->next;
+            continue;
+        }
+        // ifの本体と関数呼び出しの引数などの中を処理する
+        for (Node **q = link; q != p; q = &(*q)->next) {
+            cse_nested(fn, *q);
+        }
+        link = p;
+    }
+}
+
+// 関数本体の基本ブロックごとに共通部分式を除去する。
+void cse(Function *fn) {
+    mark_escaped(fn);
+    nreplaced = 0;
+    int before = ntemps;
+    cse_list(fn, &fn->code);
+    if (ntemps > before) {
+        opt_report(P_CSE, "%s: %d common subexpressions, %d uses replaced", fn->name, ntemps - before, nreplaced);
+    }
+}
@@ -0,0 +1,403 @@
+//
+//  dce.c
+//  tinycc
+//
+//  Created by sanluisrey on 2026/10/19.
+//
+
+#include "tinycc.h"
+
+// 不要なコードの除去
+//
+// 関数ごとに次の文を取り除く。
+//   到達しない文: return, break(と両方の分岐がそれで終わるif)より後ろの同じ並びの文(caseラベルの前まで)
+//   定数の条件の分岐: if (0)の本体、if (1)のelse、while (0)とfor (; 0;)のループ
+//   副作用のない式文: 文式の値になる最後の文は残す
+//   無駄な代入: 後で読まれることのないローカル変数への代入(右辺に副作用があれば右辺は残す)
+//
+// 代入が無駄かどうかは文の並びを後ろから辿る生存変数解析で調べる。ループは生存変数が
+// 変わらなくなるまで繰り返し解析する。breakの後ではループやswitch文の後で生きている変数が生きていて、
+// switch文の前ではどれかのcaseラベルで生きている変数が生きている。
+// 対象はアドレスを取られていないスカラーのローカル変数に限る。
+// 文式の中は、文式の後で全変数が生きているものとして同じ解析を行う。
+//
+// 翻訳単位全体では、外部から呼ばれない関数から辿れないstaticな関数と変数を出力しない。
+
+typedef struct DCE DCE;
+struct DCE {
+    Function *fn;
+    bool *brk;          // breakの飛び先で生きている変数
+    bool *cases;        // 解析中のswitch文のcaseラベルで生きている変数
+    bool has_default;
+    int nunreachable;
+    int nstores;
+    int nexprs;
+};
+
+// 解析の対象にする変数かどうか
+static bool tracked(Var *var) {
+    return !var->escaped && !isarray(var->type);
+}
+
+static bool *new_set(DCE *d) {
+    return calloc(d->fn->nvars + 1, sizeof(bool));
+}
+
+static bool *copy_set(DCE *d, bool *set) {
+    bool *ret = new_set(d);
+    memcpy(ret, set, d->fn->nvars * sizeof(bool));
+    return ret;
+}
+
+// set |= other。変わったら真を返す。
+static bool union_set(DCE *d, bool *set, bool *other) {
+    bool changed = false;
+    for (int i = 0; i < d->fn->nvars; i++) {
+        if (other[i] && !set[i]) set[i] = changed = true;
+    }
+    return changed;
+}
+
+static void fill_set(DCE *d, bool *set) {
+    for (int i = 0; i < d->fn->nvars; i++) {
+        set[i] = true;
+    }
+}
+
+// 式が読む変数をliveに加える。代入先の変数は読まない。
+static void add_uses(Node *node, bool *live) {
+    if (node == NULL) return;
+    switch (node->kind) {
+        case ND_LVAR:
+            if (tracked(node->var)) live[node->var->index] = true;
+            return;
+        case ND_ASGMT:
+            if (node->left->kind != ND_LVAR) add_uses(node->left, live);
+            add_uses(node->right, live);
+            return;
+        case ND_BLOCK:
+            for (Node *p = node->right; p != NULL; p = p->next) {
+                add_uses(p, live);
+            }
+            return;
+    }
+    add_uses(node->left, live);
+    add_uses(node->right, live);
+    add_uses(node->cond, live);
+    add_uses(node->body, live);
+    add_uses(node->els, live);
+    add_uses(node->initialization, live);
+    add_uses(node->step, live);
+    for (int i = 0; i < node->nparams; i++) {
+        add_uses(node->params[i], live);
+    }
+}
+
+// 文が次の文へ進むことがないかどうか
+static bool no_fallthrough(Node *node) {
+    switch (node->kind) {
+        case ND_RETURN:
+        case ND_BREAK:
+            return true;
+        case ND_BLOCK: {
+            // caseラベルからは途中に入れる
+            bool ret = false;
+            for (Node *p = node->right; p != NULL; p = p->next) {
+                if (has_case(p)) ret = false;
+                if (no_fallthrough(p)) ret = true;
+            }
+            return ret;
+        }
+        case ND_IF:
+            return node->els && no_fallthrough(node->body) && no_fallthrough(node->els);
+        case ND_CASE:
+            return no_fallthrough(node->body);
+    }
+    return false;
+}
+
+static void prune_list(DCE *d, Node **link, bool tail);
+static void prune_expr(DCE *d, Node *node);
+
+// 定数の条件の分岐を畳み、入れ子の文の並びを処理する。文を置き換えたら*refを書き換える。
+static void prune_stmt(DCE *d, Node **ref, bool tail) {
+    Node *node = *ref;
+    Node *next = node->next;
+    switch (node->kind) {
+        case ND_IF:
+            if (node->cond->kind == ND_NUM && !has_case(node)) {
+                Node *taken = node->cond->val ? node->body : node->els;
+                d->nunreachable++;
+                if (taken == NULL) taken = new_node_expr(new_node_null());
+                taken->next = next;
+                *ref = taken;
+                prune_stmt(d, ref, tail);
+                return;
+            }
+            prune_expr(d, node->cond);
+            prune_stmt(d, &node->body, tail);
+            if (node->els) prune_stmt(d, &node->els, tail);
+            return;
+        case ND_FOR:
+        case ND_WHILE:
+            if (node->cond && node->cond->kind == ND_NUM && node->cond->val == 0 && !has_case(node->body)) {
+                Node *init = node->initialization ? node->initialization : new_node_expr(new_node_null());
+                d->nunreachable++;
+                init->next = next;
+                *ref = init;
+                return;
+            }
+            if (node->initialization) prune_stmt(d, &node->initialization, false);
+            prune_expr(d, node->cond);
+            prune_expr(d, node->step);
+            prune_stmt(d, &node->body, false);
+            return;
+        case ND_SWITCH:
+            prune_expr(d, node->cond);
+            prune_stmt(d, &node->body, false);
+            return;
+        case ND_CASE:
+            prune_stmt(d, &node->body, false);
+            return;
+        case ND_BLOCK:
+            prune_list(d, &node->right, tail);
+            return;
+        case ND_EXPR_STMT:
+        case ND_RETURN:
+            prune_expr(d, node->right);
+            return;
+    }
+}
+
+// 式の中の文式を処理する。
+static void prune_expr(DCE *d, Node *node) {
+    if (node == NULL) return;
+    if (node->kind == ND_BLOCK) {
+        // 文式の最後の文は値として使われる
+        prune_list(d, &node->right, true);
+        return;
+    }
+    prune_expr(d, node->left);
+    prune_expr(d, node->right);
+    for (int i = 0; i < node->nparams; i++) {
+        prune_expr(d, node->params[i]);
+    }
+}
+
+// 文の並びから到達しない文、空文、副作用のない式文を取り除く。
+// tailが真なら最後の文の値が使われる。
+static void prune_list(DCE *d, Node **link, bool tail) {
+    while (*link) {
+        Node *node = *link;
+        bool last = node->next == NULL;
+        prune_stmt(d, link, tail && last);
+        node = *link;
+        bool useless = node->kind == ND_NULL
+            || (node->kind == ND_EXPR_STMT && is_pure(node->right));
+        if (useless && !(tail && node->next == NULL)) {
+            if (node->kind == ND_EXPR_STMT && node->right->kind != ND_NULL) d->nexprs++;
+            *link = node->next;
+            continue;
+        }
+        if (no_fallthrough(node)) {
+            while (node->next && !has_case(node->next)) {
+                d->nunreachable++;
+                node->next = node->next->next;
+            }
+        }
+        link = &node->next;
+    }
+}
+
+static void live_list(DCE *d, Node **link, bool *live, bool tail, bool apply);
+static void live_exprs(DCE *d, Node *node);
+
+// 文の前で生きている変数を求める。liveには文の後で生きている変数を渡す。
+// applyが真なら無駄な代入を取り除く。
+static void live_stmt(DCE *d, Node **ref, bool *live, bool tail, bool apply) {
+    Node *node = *ref;
+    switch (node->kind) {
+        case ND_EXPR_STMT: {
+            Node *e = node->right;
+            // 後で読まれない変数への代入は右辺だけにする
+            while (apply && !tail && e->kind == ND_ASGMT && e->left->kind == ND_LVAR
+                   && tracked(e->left->var) && !live[e->left->var->index]) {
+                d->nstores++;
+                e = node->right = e->right;
+                // 右辺に副作用がなければ空文にして後で取り除く
+                if (is_pure(e)) e = node->right = new_node_null();
+            }
+            if (e->kind == ND_ASGMT && e->left->kind == ND_LVAR && tracked(e->left->var)) {
+                live[e->left->var->index] = false;
+            }
+            add_uses(e, live);
+            if (apply) live_exprs(d, e);
+            return;
+        }
+        case ND_RETURN:
+            // インライン展開した本体のreturnは文式の末尾へ飛ぶ
+            if (node->name) fill_set(d, live);
+            else memset(live, 0, d->fn->nvars * sizeof(bool));
+            add_uses(node->right, live);
+            if (apply) live_exprs(d, node->right);
+            return;
+        case ND_IF: {
+            bool *els = copy_set(d, live);
+            live_stmt(d, &node->body, live, tail, apply);
+            if (node->els) live_stmt(d, &node->els, els, tail, apply);
+            union_set(d, live, els);
+            add_uses(node->cond, live);
+            if (apply) live_exprs(d, node->cond);
+            return;
+        }
+        case ND_BREAK:
+            memcpy(live, d->brk, d->fn->nvars * sizeof(bool));
+            return;
+        case ND_CASE:
+            live_stmt(d, &node->body, live, false, apply);
+            union_set(d, d->cases, live);
+            if (node->is_default) d->has_default = true;
+            return;
+        case ND_SWITCH: {
+            bool *brk = d->brk, *cases = d->cases;
+            bool has_default = d->has_default;
+            d->brk = copy_set(d, live);
+            d->cases = new_set(d);
+            d->has_default = false;
+            bool *t = copy_set(d, live);
+            live_stmt(d, &node->body, t, false, apply);
+            // defaultラベルがなければ本体を飛ばして後ろへ進みうる
+            if (!d->has_default) union_set(d, d->cases, live);
+            memcpy(live, d->cases, d->fn->nvars * sizeof(bool));
+            d->brk = brk;
+            d->cases = cases;
+            d->has_default = has_default;
+            add_uses(node->cond, live);
+            if (apply) live_exprs(d, node->cond);
+            return;
+        }
+        case ND_FOR:
+        case ND_WHILE: {
+            // 条件の前で生きている変数が変わらなくなるまで繰り返す
+            bool *exit = copy_set(d, live);
+            bool *brk = d->brk;
+            d->brk = exit;
+            bool *head = copy_set(d, live);
+            add_uses(node->cond, head);
+            for (;;) {
+                bool *t = copy_set(d, head);
+                add_uses(node->step, t);
+                live_stmt(d, &node->body, t, false, false);
+                if (!union_set(d, head, t)) break;
+            }
+            if (apply) {
+                bool *t = copy_set(d, head);
+                add_uses(node->step, t);
+                live_stmt(d, &node->body, t, false, true);
+                live_exprs(d, node->cond);
+                live_exprs(d, node->step);
+            }
+            d->brk = brk;
+            memcpy(live, head, d->fn->nvars * sizeof(bool));
+            union_set(d, live, exit);
+            if (node->initialization) live_stmt(d, &node->initialization, live, false, apply);
+            return;
+        }
+        case ND_BLOCK:
+            live_list(d, &node->right, live, tail, apply);
+            return;
+    }
+    // ND_VLOOPなど: 参照する変数をすべて生きているとする
+    add_uses(node, live);
+}
+
+// 式の中の文式の無駄な代入を取り除く。文式の後では全変数が生きているものとする。
+static void live_exprs(DCE *d, Node *node) {
+    if (node == NULL) return;
+    if (node->kind == ND_BLOCK) {
+        bool *live = new_set(d);
+        fill_set(d, live);
+        live_list(d, &node->right, live, true, true);
+        return;
+    }
+    live_exprs(d, node->left);
+    live_exprs(d, node->right);
+    for (int i = 0; i < node->nparams; i++) {
+        live_exprs(d, node->params[i]);
+    }
+}
+
+static void live_list(DCE *d, Node **link, bool *live, bool tail, bool apply) {
+    int n = 0;
+    for (Node **p = link; *p; p = &(*p)->next) {
+        n++;
+    }
+    Node ***links = calloc(n + 1, sizeof(Node **));
+    n = 0;
+    for (Node **p = link; *p; p = &(*p)->next) {
+        links[n++] = p;
+    }
+    for (int i = n - 1; i >= 0; i--) {
+        live_stmt(d, links[i], live, tail && i == n - 1, apply);
+    }
+    // 右辺に副作用のない代入を消した式文を取り除く
+    if (apply) prune_list(d, link, tail);
+}
+
+// 関数の中の到達しない文、副作用のない式文、無駄な代入を取り除く。
+void dce(Function *fn) {
+    for (int i = 0; i < fn->nvars; i++) {
+        fn->vars[i]->index = i;
+    }
+    mark_escaped(fn);
+    DCE d = {fn};
+    prune_list(&d, &fn->code, false);
+    bool *live = new_set(&d);
+    live_list(&d, &fn->code, live, false, true);
+    if (d.nunreachable || d.nstores || d.nexprs) {
+        opt_report(P_DCE, "%s: %d unreachable statements, %d dead stores, %d useless expressions removed",
+                   fn->name, d.nunreachable, d.nstores, d.nexprs);
+    }
+}
+
+// 関数から参照される関数とグローバル変数に印を付ける。
+static void mark_used(Node *node, int depth, void *arg) {
+    Code *prog = arg;
+    if (node->kind == ND_FUNCCALL) {
+        for (int i = 0; i < prog->n; i++) {
+            Function *fn = prog->function[i];
+            if (fn->name && !fn->referenced && !strcmp(fn->name, node->name)) {
+                fn->referenced = true;
+                for (Node *p = fn->code; p != NULL; p = p->next) {
+                    walk(p, 0, mark_used, prog);
+                }
+            }
+        }
+    }
+    if (node->kind == ND_GVAR && node->var) node->var->referenced = true;
+}
+
+// 翻訳単位から参照されないstaticな関数とグローバル変数を取り除く。
+void dce_unit(Code *prog) {
+    for (int i = 0; i < prog->n; i++) {
+        Function *fn = prog->function[i];
+        if (fn->name == NULL || fn->is_static || fn->referenced) continue;
+        fn->referenced = true;
+        for (Node *p = fn->code; p != NULL; p = p->next) {
+            walk(p, 0, mark_used, prog);
+        }
+    }
+    for (int i = 0; i < prog->n; i++) {
+        Function *fn = prog->function[i];
+        if (fn->name && !fn->referenced) {
+            opt_report(P_DCE, "removed unused function %s", fn->name);
+            fn->dead = true;
+        }
+        for (Var *var = fn->globals; var != NULL; var = var->next) {
+            if (var->is_static && !var->referenced && !var->dead && !isfunc(var->type)) {
+                opt_report(P_DCE, "removed unused variable %s", var->str);
+                var->dead = true;
+            }
+        }
+    }
+}
@@ -8,7 +8,10 @@
 #include "tinycc.h"
 
 
-static int stack_size;
+// 定義中の関数のローカル変数と仮引数の一覧
+static List *locals;
+// 直前に読んだ宣言指定子がstaticを含むかどうか
+static bool is_static;
 
 // 次のトークンが引数の記号と等しいかどうか真偽を返す。
 bool equal(char *op, Token **rest) {
@@ -102,11 +105,11 @@ void expect_token(TokenKind kind, Token **rest) {
     *rest = token->next;
 }
 
-// ローカル変数と仮引数のスタックトップからのオフセットの設定と
-// 関数全体のスタックサイズの設定を行う(dclparamとdecltn内)
-void set_offset(Var *p) {
-    stack_size += roundup(p->type->size, 8);
-    p->offset = stack_size;
+// ローカル変数と仮引数を定義中の関数に登録する(dclparamとdecltn内)
+// スタック上のオフセットはコード生成時にまとめて決める
+void add_local(Var *p) {
+    p->extent = cur_extent;
+    locals = append(p, locals);
 }
 
 /*
@@ -118,7 +121,7 @@ void set_offset(Var *p) {
  decltn         =   decltn_spcf ini_decltr_lst? ";"
  decltn_list    =   decltn
                 |   decltn_list decltn
- decltn_spcf    =   type_spcf decltn_spcf? (TODO)
+ decltn_spcf    =   "static"? type_spcf decltn_spcf? (TODO)
  type_spcf      =   char | int  (TODO)
  ini_decltr_lst =   ini_decltr  (TODO)
                 |   ini_decltr_lst ini_decltr
@@ -174,11 +177,13 @@ Function *ex_decltn(Token **rest) {
     Type *ty, *ty1;
     char *id = NULL;
     ty = decltn_spcf(rest);
+    // 仮引数の宣言指定子を読む前に覚えておく
+    bool stat = is_static;
     if (getlevel() == GLOBAL) {
         // 1回目の宣言子をパース。 TODO 2回目以降
         // 関数の変数宣言のためのスタック領域初期化と記号表の初期化
         Var **params = NULL;
-        stack_size = 0;
+        locals = NULL;
         identifiers = globals;
         ty1 = decltr(rest, &id, ty, &params);
         // 関数の宣言・定義のどちらが続くのか確認
@@ -186,14 +191,18 @@ Function *ex_decltn(Token **rest) {
         // TODO 関数宣言の実装
         if (equal("{", rest)) {
             Function *ret = func_defn(rest, id, ty1, params);
-            ret->stack_size = stack_size;
+            ret->is_static = stat;
+            ret->nvars = list_length(locals);
+            ret->vars = ltov(&locals);
             return ret;
         }
     } else {
+        if (stat) error_tok(*rest, "ローカル変数のstaticには対応していません");
         ty1 = decltr(rest, &id, ty, NULL);
     }
     for (; ; ) {
-        decltn(rest, id, ty1);
+        Var *var = decltn(rest, id, ty1);
+        var->is_static = stat;
         if (!consume(",", rest)) {
             break;
         }
@@ -213,12 +222,12 @@ Var *decltn(Token **rest, char *id, Type *ty) {
         else {
             p = install(id, &identifiers, getlevel(), ty);
             // TODO スコープや関数ごとにスタックサイズを設定
-            set_offset(p);
+            add_local(p);
         }
     } else if(p->scope < getlevel()) {
         p = install(id, &identifiers, getlevel(), ty);
         // TODO スコープや関数ごとにスタックサイズを設定
-        set_offset(p);
+        add_local(p);
     } else {
         error("redeclaration error");
     }
@@ -226,8 +235,9 @@ Var *decltn(Token **rest, char *id, Type *ty) {
     return p;
 }
 
-//decltn_spcf    =   type_spcf decltn_spcf? (TODO)
+//decltn_spcf    =   "static"? type_spcf decltn_spcf? (TODO)
 Type *decltn_spcf(Token **rest) {
+    is_static = consume_token(TK_STATIC, rest);
     return type_spcf(rest, *rest);
 }
 //type_spcf      =   char | int  (TODO 型の追加)
@@ -306,7 +316,7 @@ Type *decltr1(Token **rest, char **id, Var ***params) {
              */
         } else {
             consume("[", rest);
-            int n = expect_number(rest);
+            int n = const_expr(rest);
             expect("]", rest);
             ty = tnode(ARRAY, ty);
             ty->array_size = n;
@@ -368,7 +378,7 @@ Var *dclparam(Token **rest, char *id, Type *ty) {
     } else {
         p = install(id, &identifiers, getlevel(), ty);
         // TODO スコープや関数ごとにスタックサイズを設定
-        set_offset(p);
+        add_local(p);
     }
     p->type = ty;
     p->defined = 1;
@@ -386,10 +396,9 @@ Function *func_defn(Token **rest, char *id, Type *fty, Var *params[]){
     Type *rty = NULL;
     if(fty) rty = get_return_ty(fty);
     if (params) {
-        // 引数の数を数える TODO 引数の数が6個より大きい関数への対応
+        // 引数の数を数える(7個目以降はスタックで渡される)
         while (params[n] != NULL) {
             n++;
-            if(n > 6) error("the number of parameters > 6");
         }
         for (i = 0; (p = params[i]) != NULL; i++) {
             // TODO main関数のとき返り値の型の指定がなくてもいいが、必ず型が指定されているものとする
@@ -0,0 +1,411 @@
+//
+//  eval.c
+//  tinycc
+//
+//  Created by sanluisrey on 2026/10/19.
+//
+
+#include "tinycc.h"
+
+// 純粋な関数の呼び出しのコンパイル時評価
+//
+// 引数がすべて定数の呼び出しで、呼び出し先が同じ翻訳単位で定義された純粋な関数
+// (グローバル変数やポインタの指す先への書き込み、外部の関数の呼び出しを含まない関数)なら、
+// 構文木をそのまま解釈して実行し、呼び出しを結果の定数に置き換える。
+// 解釈できるのはint, charのスカラーのローカル変数と算術・比較演算、制御文、関数呼び出しに限り、
+// それ以外の構文に出会ったら評価をあきらめる。
+//
+// 評価は1回の呼び出しごとに実行する式の数と再帰の深さで打ち切る。
+// 評価した結果は(関数, 引数)ごとに覚えておき、再帰呼び出しや同じ呼び出しで使い回す。
+
+#define MAX_STEPS 1000000   // 1回の評価で実行する式の数の上限
+#define MAX_DEPTH 200       // 再帰の深さの上限
+#define MAX_ARGS 8
+#define NBUCKETS 1024
+
+// 関数が純粋かどうかの判定状態
+enum {
+    PURE_UNKNOWN,
+    PURE_CHECKING,
+    PURE_YES,
+    PURE_NO,
+};
+
+typedef struct Purity Purity;
+struct Purity {
+    Function *fn;
+    int state;
+    Purity *next;
+};
+
+// 評価した呼び出しの結果
+typedef struct Memo Memo;
+struct Memo {
+    Function *fn;
+    int args[MAX_ARGS];
+    int nargs;
+    int val;
+    Memo *next;
+};
+
+// 実行中の関数の変数の値
+typedef struct Frame Frame;
+struct Frame {
+    Function *fn;
+    int *vals;
+    bool *set;      // 値が代入されているか
+};
+
+// 文の実行結果
+enum {
+    EXEC_NEXT,      // 次の文へ進む
+    EXEC_RETURN,    // returnした
+    EXEC_FAIL,      // 評価できない
+};
+
+static Purity *purities;
+static Memo *memo[NBUCKETS];
+static int steps;
+static int depth;
+static int nfolded;
+
+static int *purity_of(Function *fn) {
+    for (Purity *p = purities; p != NULL; p = p->next) {
+        if (p->fn == fn) return &p->state;
+    }
+    Purity *p = calloc(1, sizeof(Purity));
+    p->fn = fn;
+    p->next = purities;
+    purities = p;
+    return &p->state;
+}
+
+static bool is_value_type(Type *ty) {
+    return ty && (ty->ty == INT || ty->ty == CHAR);
+}
+
+static bool pure_fn(Function *fn);
+
+// 部分木が解釈できる構文だけからなり、外から見える副作用を持たないかどうか
+static bool pure_tree(Node *node) {
+    if (node == NULL) return true;
+    switch (node->kind) {
+        case ND_NUM:
+        case ND_NULL:
+            return true;
+        case ND_LVAR:
+            return is_value_type(node->type);
+        case ND_ASGMT:
+            return node->left->kind == ND_LVAR && is_value_type(node->left->type) && pure_tree(node->right);
+        case ND_FUNCCALL: {
+            Function *callee = find_function(node->name);
+            if (callee == NULL || callee->nparams != node->nparams || node->nparams > MAX_ARGS) return false;
+            for (int i = 0; i < node->nparams; i++) {
+                if (!pure_tree(node->params[i])) return false;
+            }
+            return pure_fn(callee);
+        }
+        case ND_BLOCK:
+            for (Node *p = node->right; p != NULL; p = p->next) {
+                if (!pure_tree(p)) return false;
+            }
+            return true;
+        case ND_ADD:
+        case ND_SUB:
+        case ND_MUL:
+        case ND_DIV:
+        case ND_MOD:
+        case ND_SHL:
+        case ND_NEG:
+        case ND_EQ:
+        case ND_NE:
+        case ND_GT:
+        case ND_GE:
+        case ND_LT:
+        case ND_LE:
+        case ND_EXPR_STMT:
+        case ND_RETURN:
+        case ND_IF:
+        case ND_FOR:
+        case ND_WHILE:
+            return pure_tree(node->left) && pure_tree(node->right) && pure_tree(node->cond)
+                && pure_tree(node->body) && pure_tree(node->els)
+                && pure_tree(node->initialization) && pure_tree(node->step);
+    }
+    return false;
+}
+
+// 関数が純粋かどうか。再帰呼び出しは判定中なら純粋とみなす。
+static bool pure_fn(Function *fn) {
+    int *state = purity_of(fn);
+    if (*state == PURE_UNKNOWN) {
+        *state = PURE_CHECKING;
+        bool pure = true;
+        for (int i = 0; i < fn->nparams && pure; i++) {
+            pure = is_value_type(fn->params[i]->type);
+        }
+        for (Node *node = fn->code; node != NULL && pure; node = node->next) {
+            pure = pure_tree(node);
+        }
+        *state = pure ? PURE_YES : PURE_NO;
+    }
+    return *state != PURE_NO;
+}
+
+static unsigned hash(Function *fn, int *args, int nargs) {
+    unsigned h = (unsigned) ((size_t) fn >> 4);
+    for (int i = 0; i < nargs; i++) {
+        h = h * 31 + (unsigned) args[i];
+    }
+    return h % NBUCKETS;
+}
+
+static Memo *lookup_memo(Function *fn, int *args, int nargs) {
+    for (Memo *m = memo[hash(fn, args, nargs)]; m != NULL; m = m->next) {
+        if (m->fn == fn && !memcmp(m->args, args, nargs * sizeof(int))) return m;
+    }
+    return NULL;
+}
+
+// 変数の型に合わせて値を切り詰める。
+static int convert(Type *ty, int val) {
+    return ty->ty == CHAR ? (signed char) val : val;
+}
+
+static bool call(Function *fn, int *args, int nargs, int *val);
+static int exec(Node *node, Frame *f, int *ret);
+
+static bool eval(Node *node, Frame *f, int *val) {
+    if (++steps > MAX_STEPS) return false;
+    int l, r;
+    switch (node->kind) {
+        case ND_NUM:
+            *val = node->val;
+            return true;
+        case ND_LVAR: {
+            int i = node->var->index;
+            // 代入前の変数の値には頼らない
+            if (!f->set[i]) return false;
+            *val = f->vals[i];
+            return true;
+        }
+        case ND_ASGMT: {
+            if (!eval(node->right, f, val)) return false;
+            Var *var = node->left->var;
+            *val = convert(var->type, *val);
+            f->vals[var->index] = *val;
+            f->set[var->index] = true;
+            return true;
+        }
+        case ND_FUNCCALL: {
+            int args[MAX_ARGS];
+            for (int i = 0; i < node->nparams; i++) {
+                if (!eval(node->params[i], f, &args[i])) return false;
+            }
+            // 再帰の途中で純粋と仮定した関数が後から純粋でないと分かった場合に備えて確かめ直す
+            Function *callee = find_function(node->name);
+            return pure_fn(callee) && call(callee, args, node->nparams, val);
+        }
+        case ND_BLOCK: {
+            // 文式の値は最後の式文の値
+            int ret;
+            *val = 0;
+            for (Node *p = node->right; p != NULL; p = p->next) {
+                if (p->kind == ND_EXPR_STMT && p->next == NULL) return eval(p->right, f, val);
+                if (exec(p, f, &ret) != EXEC_NEXT) return false;
+            }
+            return true;
+        }
+        case ND_NEG:
+            if (!eval(node->right, f, &r)) return false;
+            *val = (int) -(unsigned) r;
+            return true;
+    }
+    if (!eval(node->left, f, &l) || !eval(node->right, f, &r)) return false;
+    switch (node->kind) {
+        case ND_ADD:
+            *val = (int) ((unsigned) l + (unsigned) r);
+            return true;
+        case ND_SUB:
+            *val = (int) ((unsigned) l - (unsigned) r);
+            return true;
+        case ND_MUL:
+            *val = (int) ((unsigned) l * (unsigned) r);
+            return true;
+        case ND_DIV:
+        case ND_MOD:
+            // ゼロ除算とオーバーフローは実行時に任せる
+            if (r == 0 || (l == -2147483647 - 1 && r == -1)) return false;
+            *val = node->kind == ND_DIV ? l / r : l % r;
+            return true;
+        case ND_SHL:
+            if (r < 0 || r > 31) return false;
+            *val = (int) ((unsigned) l << r);
+            return true;
+        case ND_EQ:
+            *val = l == r;
+            return true;
+        case ND_NE:
+            *val = l != r;
+            return true;
+        case ND_GT:
+            *val = l > r;
+            return true;
+        case ND_GE:
+            *val = l >= r;
+            return true;
+        case ND_LT:
+            *val = l < r;
+            return true;
+        case ND_LE:
+            *val = l <= r;
+            return true;
+    }
+    return false;
+}
+
+static int exec(Node *node, Frame *f, int *ret) {
+    int val;
+    switch (node->kind) {
+        case ND_NULL:
+            return EXEC_NEXT;
+        case ND_EXPR_STMT:
+            return eval(node->right, f, &val) ? EXEC_NEXT : EXEC_FAIL;
+        case ND_RETURN:
+            return eval(node->right, f, ret) ? EXEC_RETURN : EXEC_FAIL;
+        case ND_IF:
+            if (!eval(node->cond, f, &val)) return EXEC_FAIL;
+            if (val) return exec(node->body, f, ret);
+            return node->els ? exec(node->els, f, ret) : EXEC_NEXT;
+        case ND_FOR:
+        case ND_WHILE: {
+            if (node->initialization && exec(node->initialization, f, ret) != EXEC_NEXT) return EXEC_FAIL;
+            for (;;) {
+                if (node->cond) {
+                    if (!eval(node->cond, f, &val)) return EXEC_FAIL;
+                    if (!val) return EXEC_NEXT;
+                } else if (++steps > MAX_STEPS) {
+                    return EXEC_FAIL;
+                }
+                int st = exec(node->body, f, ret);
+                if (st != EXEC_NEXT) return st;
+                if (node->step && !eval(node->step, f, &val)) return EXEC_FAIL;
+            }
+        }
+        case ND_BLOCK:
+            for (Node *p = node->right; p != NULL; p = p->next) {
+                int st = exec(p, f, ret);
+                if (st != EXEC_NEXT) return st;
+            }
+            return EXEC_NEXT;
+    }
+    return EXEC_FAIL;
+}
+
+// 関数を引数argsで実行し、戻り値をvalに置く。評価できなければ偽を返す。
+static bool call(Function *fn, int *args, int nargs, int *val) {
+    Memo *m = lookup_memo(fn, args, nargs);
+    if (m) {
+        *val = m->val;
+        return true;
+    }
+    if (depth == MAX_DEPTH) return false;
+    Frame f = {fn};
+    f.vals = calloc(fn->nvars + 1, sizeof(int));
+    f.set = calloc(fn->nvars + 1, sizeof(bool));
+    for (int i = 0; i < fn->nvars; i++) {
+        fn->vars[i]->index = i;
+    }
+    for (int i = 0; i < nargs; i++) {
+        Var *param = fn->params[i];
+        f.vals[param->index] = convert(param->type, args[i]);
+        f.set[param->index] = true;
+    }
+    depth++;
+    int st = EXEC_NEXT;
+    for (Node *node = fn->code; node != NULL && st == EXEC_NEXT; node = node->next) {
+        st = exec(node, &f, val);
+    }
+    depth--;
+    free(f.vals);
+    free(f.set);
+    // 末尾まで実行して戻った値は不定なので評価しない
+    if (st != EXEC_RETURN) return false;
+
+    m = calloc(1, sizeof(Memo));
+    m->fn = fn;
+    memcpy(m->args, args, nargs * sizeof(int));
+    m->nargs = nargs;
+    m->val = *val;
+    unsigned h = hash(fn, args, nargs);
+    m->next = memo[h];
+    memo[h] = m;
+    return true;
+}
+
+// 引数がすべて定数の純粋な関数の呼び出しを評価して定数に置き換える。
+// 置き換えで定数になった親の式も畳み込む。
+static void eval_calls(Function *fn, Node *node) {
+    if (node == NULL) return;
+    eval_calls(fn, node->left);
+    eval_calls(fn, node->right);
+    eval_calls(fn, node->cond);
+    eval_calls(fn, node->body);
+    eval_calls(fn, node->els);
+    eval_calls(fn, node->initialization);
+    eval_calls(fn, node->step);
+    eval_calls(fn, node->next);
+    for (int i = 0; i < node->nparams; i++) {
+        eval_calls(fn, node->params[i]);
+    }
+    if (node->kind == ND_FUNCCALL) {
+        Function *callee = find_function(node->name);
+        if (callee == NULL || callee->nparams != node->nparams || node->nparams > MAX_ARGS) return;
+        int args[MAX_ARGS];
+        for (int i = 0; i < node->nparams; i++) {
+            if (node->params[i]->kind != ND_NUM) return;
+            args[i] = node->params[i]->val;
+        }
+        if (!pure_fn(callee)) return;
+        steps = 0;
+        int val;
+        if (!call(callee, args, node->nparams, &val)) {
+            opt_report(P_EVAL, "%s: call to %s not evaluated", fn->name, callee->name);
+            return;
+        }
+        opt_report(P_EVAL, "%s: call to %s evaluated to %d (%d steps)", fn->name, callee->name, val, steps);
+        nfolded++;
+        Node *next = node->next;
+        *node = *new_node_num(val);
+        node->next = next;
+        return;
+    }
+    // 定数になった引数や被演算子を畳み込む
+    switch (node->kind) {
+        case ND_ADD:
+        case ND_SUB:
+        case ND_MUL:
+        case ND_DIV:
+        case ND_MOD:
+        case ND_SHL:
+        case ND_NEG:
+        case ND_EQ:
+        case ND_NE:
+        case ND_GT:
+        case ND_GE:
+        case ND_LT:
+        case ND_LE: {
+            Node *folded = fold(node);
+            if (folded != node) {
+                Node *next = node->next;
+                *node = *folded;
+                node->next = next;
+            }
+        }
+    }
+}
+
+// 関数の中の定数引数の純粋な関数の呼び出しを評価する。
+void eval_pure_calls(Function *fn) {
+    eval_calls(fn, fn->code);
+}
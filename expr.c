@@ -27,8 +27,8 @@ Node *new_node_var(Var *var){
         ret->name = var->str;
     } else {
         ret->kind = ND_LVAR;
-        ret->offset = var->offset;
     }
+    ret->var = var;
     ret->type = var->type;
     return ret;
 }
@@ -46,7 +46,7 @@ Node *new_node_binary(NodeKind kind, Type *ty, Node *lhs, Node *rhs) {
     ret->left = lhs;
     ret->right = rhs;
     ret->type = ty;
-    return ret;
+    return fold(ret);
 }
 
 Node *new_node_funcall(Node *f_head, Node *argument) {
@@ -92,7 +92,8 @@ Node *retype(Node *p, Type *type) {
     if (p->type->ty == type->ty)
         return p;
     q = node(p->kind, type, p->left, p->right);
-    q->offset = p->offset;
+    q->name = p->name;
+    q->var = p->var;
     return q;
 }
 // 配列型のノードをポインター型に変える
@@ -106,7 +107,7 @@ Node *pointer(Node *p) {
 Node *add_node(NodeKind kind, Node *lhs, Node *rhs) {
     Node *p = pointer(lhs);
     Node *q = pointer(rhs);
-    if(iscint(p->type) && iscint(q->type)) return node(kind, p->type, p, q);
+    if(iscint(p->type) && iscint(q->type)) return fold(node(kind, p->type, p, q));
     if (isptr(q->type) && iscint(p->type)) return add_node(kind, rhs, lhs);
     if(!isptr(p->type) || (!iscint(q->type))) {
         error("type error: cannot add/substract operand");
@@ -164,6 +165,7 @@ static char *new_unique_name(void) {
                 |   add "-" mul
  mul            =   mul "*" unary
                 |   mul "/" unary
+                |   mul "%" unary
  unary          =   postfix
                 |   unary_op unary
                 |   "sizeof" unary
@@ -200,11 +202,11 @@ Node *equality(Token **rest) {
         if (consume("==", rest)) {
             Node *right = relational(rest);
             ret = new_node_binary(ND_EQ, type(INT, NULL), ret, right);
-            ret->type = calloc(1, sizeof(Type));
+            ret->type = IntType;
         } else if (consume("!=", rest)) {
             Node *right = relational(rest);
             ret = new_node_binary(ND_NE, type(INT, NULL), ret, right);
-            ret->type = calloc(1, sizeof(Type));
+            ret->type = IntType;
         } else {
             return ret;
         }
@@ -214,21 +216,21 @@ Node *relational(Token **rest) {
     Node *ret = add(rest);
     for (; ; ) {
         if (consume(">=", rest)) {
-            Node *left = add(rest);
-            ret = new_node_binary(ND_GE,type(INT, NULL), left, ret);
-            ret->type = calloc(1, sizeof(Type));
+            Node *right = add(rest);
+            ret = new_node_binary(ND_GE,type(INT, NULL), ret, right);
+            ret->type = IntType;
         } else if (consume("<=", rest)) {
             Node *right = add(rest);
             ret = new_node_binary(ND_LE,type(INT, NULL), ret, right);
-            ret->type = calloc(1, sizeof(Type));
+            ret->type = IntType;
         } else if (consume(">", rest)){
-            Node *left = add(rest);
-            ret = new_node_binary(ND_GT,type(INT, NULL), left, ret);
-            ret->type = calloc(1, sizeof(Type));
+            Node *right = add(rest);
+            ret = new_node_binary(ND_GT,type(INT, NULL), ret, right);
+            ret->type = IntType;
         } else if (consume("<", rest)) {
             Node *right = add(rest);
             ret = new_node_binary(ND_LT,type(INT, NULL), ret, right);
-            ret->type = calloc(1, sizeof(Type));
+            ret->type = IntType;
         } else {
             return ret;
         }
@@ -261,6 +263,9 @@ Node *mul(Token **rest) {
         } else if (consume("/", rest)){
             Node *right = unary(rest);
             ret = new_node_binary(ND_DIV,ret->type, ret, right); //TODO type check
+        } else if (consume("%", rest)){
+            Node *right = unary(rest);
+            ret = new_node_binary(ND_MOD,ret->type, ret, right); //TODO type check
         } else {
             return ret;
         }
@@ -289,11 +294,11 @@ Node *unary(Token **rest) {
         return ret;
     }
     if (consume("+",rest)) {
-        return primary(rest);
+        return unary(rest);
     } else if (consume("-",rest)) {
-        Node *right = primary(rest);
-        if(!isint(right->type)) error_tok(*rest, "int型ではありません。");
-        ret = new_node_binary(ND_SUB, right->type, new_node_num(0), right);
+        Node *right = unary(rest);
+        if(!iscint(right->type)) error_tok(*rest, "int型ではありません。");
+        ret = new_node_binary(ND_NEG, right->type, NULL, right);
         return ret;
     }
     return postfix(rest);
@@ -363,6 +368,16 @@ Node *primary(Token **rest) {
     }
     return ret;
 }
+// cnst_expr      =   cond_expr
+// 定数式を評価してその値を返す。定数でなければエラーを報告する。
+int const_expr(Token **rest) {
+    Token *tok = *rest;
+    int val;
+    if (!const_value(equality(rest), &val)) {
+        error_tok(tok, "定数式ではありません");
+    }
+    return val;
+}
 /*
  argument_lst   =   assign
                 |   argument_lst "," assign
@@ -0,0 +1,176 @@
+//
+//  fold.c
+//  tinycc
+//
+//  Created by sanluisrey on 2026/10/19.
+//
+
+#include "tinycc.h"
+
+static bool is_num(Node *node, int val) {
+    return node && node->kind == ND_NUM && node->val == val;
+}
+
+// nが2のべき乗ならその指数を、そうでなければ-1を返す。
+int ilog2(int n) {
+    if (n <= 0 || (n & (n - 1)) != 0) return -1;
+    int k = 0;
+    while ((1 << k) != n) k++;
+    return k;
+}
+
+// 定数式の値を求める。定数でなければ偽を返す。
+// 演算はintの範囲で折り返す。
+bool const_value(Node *node, int *val) {
+    int l, r;
+    if (node == NULL) return false;
+    switch (node->kind) {
+        case ND_NUM:
+            *val = node->val;
+            return true;
+        case ND_NEG:
+            if (!const_value(node->right, &r)) return false;
+            *val = (int) -(unsigned) r;
+            return true;
+        case ND_ADD:
+        case ND_SUB:
+        case ND_MUL:
+        case ND_DIV:
+        case ND_MOD:
+        case ND_SHL:
+        case ND_EQ:
+        case ND_NE:
+        case ND_GT:
+        case ND_GE:
+        case ND_LT:
+        case ND_LE:
+            if (!const_value(node->left, &l) || !const_value(node->right, &r)) return false;
+            break;
+        default:
+            return false;
+    }
+    switch (node->kind) {
+        case ND_ADD:
+            *val = (int) ((unsigned) l + (unsigned) r);
+            return true;
+        case ND_SUB:
+            *val = (int) ((unsigned) l - (unsigned) r);
+            return true;
+        case ND_MUL:
+            *val = (int) ((unsigned) l * (unsigned) r);
+            return true;
+        case ND_DIV:
+            // ゼロ除算とオーバーフローは実行時に任せる
+            if (r == 0 || (l == -2147483647 - 1 && r == -1)) return false;
+            *val = l / r;
+            return true;
+        case ND_MOD:
+            if (r == 0 || (l == -2147483647 - 1 && r == -1)) return false;
+            *val = l % r;
+            return true;
+        case ND_SHL:
+            *val = (int) ((unsigned) l << r);
+            return true;
+        case ND_EQ:
+            *val = l == r;
+            return true;
+        case ND_NE:
+            *val = l != r;
+            return true;
+        case ND_GT:
+            *val = l > r;
+            return true;
+        case ND_GE:
+            *val = l >= r;
+            return true;
+        case ND_LT:
+            *val = l < r;
+            return true;
+        case ND_LE:
+            *val = l <= r;
+            return true;
+    }
+    return false;
+}
+
+// 加算の左辺が定数を足したアドレス計算であれば、定数をまとめる。
+// 配列型のND_DEREFは値がアドレスそのものなので読み飛ばす。
+static Node *fold_offset(Node *node) {
+    Node *lhs = node->left;
+    if (lhs->kind == ND_DEREF && isarray(lhs->type)) {
+        lhs = lhs->right;
+    }
+    if (lhs->kind == ND_ADD && lhs->right->kind == ND_NUM) {
+        int c = (int) ((unsigned) lhs->right->val + (unsigned) node->right->val);
+        return fold(new_node_binary(ND_ADD, node->type, lhs->left, new_node_num(c)));
+    }
+    if (lhs != node->left) {
+        return fold(new_node_binary(ND_ADD, node->type, lhs, node->right));
+    }
+    return node;
+}
+
+// 定数部分木の評価と代数的な簡約を行い、置き換え後のノードを返す。
+Node *fold(Node *node) {
+    int val;
+    if (!optimizing(P_FOLD)) return node;
+    if (const_value(node, &val)) return new_node_num(val);
+    
+    Node *lhs = node->left;
+    Node *rhs = node->right;
+    switch (node->kind) {
+        case ND_ADD:
+            if (is_num(rhs, 0)) return lhs;
+            if (is_num(lhs, 0) && iscint(rhs->type)) return rhs;
+            if (rhs->kind == ND_NUM) return fold_offset(node);
+            // x + (y + c) は (x + y) + c として定数をアドレスの変位にまとめる
+            if (rhs->kind == ND_ADD && rhs->right->kind == ND_NUM) {
+                Node *sum = fold(new_node_binary(ND_ADD, node->type, lhs, rhs->left));
+                return fold(new_node_binary(ND_ADD, node->type, sum, rhs->right));
+            }
+            return node;
+        case ND_SUB:
+            if (is_num(rhs, 0)) return lhs;
+            if (same_node(lhs, rhs) && is_pure(lhs) && iscint(lhs->type)) return new_node_num(0);
+            // x - c は x + (-c) として定数をまとめやすくする
+            if (rhs->kind == ND_NUM && rhs->val != -2147483647 - 1) {
+                return fold(new_node_binary(ND_ADD, node->type, lhs, new_node_num(-rhs->val)));
+            }
+            return node;
+        case ND_MUL:
+            if (lhs->kind == ND_NUM && rhs->kind != ND_NUM) {
+                return fold(new_node_binary(ND_MUL, node->type, rhs, lhs));
+            }
+            if (is_num(rhs, 1)) return lhs;
+            if (is_num(rhs, 0) && is_pure(lhs)) return new_node_num(0);
+            // (x + c) * k は x * k + c * k に分配する(a[i + 1]のアドレスの定数を外に出す)
+            if (rhs->kind == ND_NUM && lhs->kind == ND_ADD && lhs->right->kind == ND_NUM) {
+                int c = (int) ((unsigned) lhs->right->val * (unsigned) rhs->val);
+                Node *prod = fold(new_node_binary(ND_MUL, node->type, lhs->left, rhs));
+                return fold(new_node_binary(ND_ADD, node->type, prod, new_node_num(c)));
+            }
+            // 2のべき乗の乗算はシフトに置き換える
+            if (rhs->kind == ND_NUM && ilog2(rhs->val) > 0) {
+                return new_node_binary(ND_SHL, node->type, lhs, new_node_num(ilog2(rhs->val)));
+            }
+            return node;
+        case ND_SHL:
+            // (x + c) << s も同様に分配する
+            if (rhs->kind == ND_NUM && lhs->kind == ND_ADD && lhs->right->kind == ND_NUM) {
+                int c = (int) ((unsigned) lhs->right->val << rhs->val);
+                Node *shift = fold(new_node_binary(ND_SHL, node->type, lhs->left, rhs));
+                return fold(new_node_binary(ND_ADD, node->type, shift, new_node_num(c)));
+            }
+            return node;
+        case ND_DIV:
+            if (is_num(rhs, 1)) return lhs;
+            return node;
+        case ND_MOD:
+            if ((is_num(rhs, 1) || is_num(rhs, -1)) && is_pure(lhs)) return new_node_num(0);
+            return node;
+        case ND_NEG:
+            if (rhs->kind == ND_NEG) return rhs->right;
+            return node;
+    }
+    return node;
+}
@@ -0,0 +1,319 @@
+//
+//  forward.c
+//  tinycc
+//
+//  Created by sanluisrey on 2026/10/19.
+//
+
+#include "tinycc.h"
+
+// 代入した値のロードへの転送と無駄なストアの除去
+//
+// 分岐もループも含まない文の並び(基本ブロック)の中で、代入先ごとに最後に書き込んだ値を覚えておき、
+//   x = 5; y = x + 1;       =>  x = 5; y = 5 + 1;
+//   *p = n; s = s + *p;     =>  *p = n; s = s + n;
+// のように、値が定数かローカル変数ならロードを書き込んだ値で置き換える。
+// また、同じ場所への2回目の書き込みまでにその場所を読みうる式がなければ、1回目の書き込みを除く。
+//   *p = 1; *p = 2;         =>  *p = 2;
+// ローカル変数への無駄な代入はdce.cが除くので、ここで効くのは主にポインタ経由の書き込みである。
+//
+// 別名の扱い:
+// アドレスを取られていないスカラーのローカル変数は、その変数への代入以外では値が変わらず、
+// *pや配列の要素、グローバル変数とは重ならない。それ以外のメモリ同士は、
+// 別々の名前の変数どうしを除いて重なりうるとみなす。関数呼び出しはメモリをすべて読み書きしうる。
+// 覚えておく*pのアドレスは、メモリを読まない式(ローカル変数と定数の計算)に限る。
+
+#define MAX_ENTRIES 32
+
+typedef struct Entry Entry;
+struct Entry {
+    Node *lhs;      // 代入先
+    Node *val;      // 書き込んだ値(定数かローカル変数でなければNULL)
+    Node **link;    // 代入文を指すポインタ(前の文のnextかブロックの先頭)
+    bool read;      // 代入の後で代入先を読みうる式があったかどうか
+};
+
+typedef struct Forward Forward;
+struct Forward {
+    Entry entries[MAX_ENTRIES];
+    int n;
+};
+
+static int nforwarded;
+static int nremoved;
+
+// アドレスを取られていないスカラーのローカル変数かどうか
+static bool is_private(Node *node) {
+    return node->kind == ND_LVAR && !node->var->escaped && is_scalar(node->type);
+}
+
+// 式がメモリを読むかどうか(配列やアドレスは値を読まない)
+static bool reads_mem(Node *node) {
+    if (node == NULL) return false;
+    switch (node->kind) {
+        case ND_DEREF:
+        case ND_GVAR:
+            if (is_scalar(node->type)) return true;
+            break;
+        case ND_LVAR:
+            return node->var->escaped && is_scalar(node->type);
+        case ND_ADDR:
+            if (node->right->kind == ND_DEREF) return reads_mem(node->right->right);
+            return false;
+    }
+    return reads_mem(node->left) || reads_mem(node->right);
+}
+
+// 式が変数varを読むかどうか
+static bool reads_var(Node *node, Var *var) {
+    if (node == NULL) return false;
+    if (node->kind == ND_LVAR) return node->var == var;
+    return reads_var(node->left, var) || reads_var(node->right, var);
+}
+
+// ポインタの式を、定数の変位とそれ以外の部分に分ける。
+static Node *split(Node *addr, int *disp) {
+    *disp = 0;
+    while (addr->kind == ND_ADD && !iscint(addr->type) && addr->right->kind == ND_NUM) {
+        *disp += addr->right->val;
+        addr = addr->left;
+    }
+    return addr;
+}
+
+// 2つの代入先(またはロード)が同じメモリを指しうるかどうか
+static bool may_alias(Node *a, Node *b) {
+    if (a->kind == ND_DEREF && b->kind == ND_DEREF) {
+        // a[0]とa[1]のように同じポインタからの変位が違えば重ならない
+        int da, db;
+        Node *ba = split(a->right, &da);
+        Node *bb = split(b->right, &db);
+        if (same_node(ba, bb)) return da < db + b->type->size && db < da + a->type->size;
+        return true;
+    }
+    if (is_private(a) || is_private(b)) {
+        return a->kind == ND_LVAR && b->kind == ND_LVAR && a->var == b->var;
+    }
+    if (a->kind == ND_GVAR && b->kind == ND_GVAR) return !strcmp(a->name, b->name);
+    if (a->kind == ND_LVAR && b->kind == ND_LVAR) return a->var == b->var;
+    if ((a->kind == ND_LVAR && b->kind == ND_GVAR) || (a->kind == ND_GVAR && b->kind == ND_LVAR)) return false;
+    return true;
+}
+
+// 値を覚えておける代入先かどうか
+static bool trackable(Node *lhs) {
+    if (!is_scalar(lhs->type)) return false;
+    switch (lhs->kind) {
+        case ND_LVAR:
+        case ND_GVAR:
+            return true;
+        case ND_DEREF:
+            return is_pure(lhs->right) && !reads_mem(lhs->right);
+    }
+    return false;
+}
+
+// 代入先lhsから読み出す値として、書き込んだ式rhsの代わりに使えるものを返す。
+static Node *forwardable(Node *lhs, Node *rhs) {
+    if (rhs->kind == ND_NUM && iscint(lhs->type)) {
+        return new_node_num(ischar(lhs->type) ? (signed char) rhs->val : rhs->val);
+    }
+    if (is_private(rhs) && rhs->type->ty == lhs->type->ty) {
+        Node *var = new_node_var(rhs->var);
+        var->type = lhs->type;
+        return var;
+    }
+    return NULL;
+}
+
+static void remove_entry(Forward *f, int i) {
+    f->entries[i] = f->entries[--f->n];
+}
+
+// ロードするノードを覚えている値で置き換える。置き換えなければ重なりうる代入を読まれたものとする。
+static void load(Forward *f, Node **ref) {
+    Node *node = *ref;
+    for (int i = 0; i < f->n; i++) {
+        Entry *e = &f->entries[i];
+        if (e->val && same_node(e->lhs, node)) {
+            Node *val = calloc(1, sizeof(Node));
+            *val = *e->val;
+            *ref = val;
+            nforwarded++;
+            return;
+        }
+    }
+    for (int i = 0; i < f->n; i++) {
+        if (may_alias(f->entries[i].lhs, node)) f->entries[i].read = true;
+    }
+}
+
+// 式の中のロードを評価順に処理する。
+static void visit(Forward *f, Node **ref) {
+    Node *node = *ref;
+    if (node == NULL) return;
+    switch (node->kind) {
+        case ND_ADDR:
+            // &*pのpは読むが、&xや&a[i]の要素は読まない
+            if (node->right->kind == ND_DEREF) visit(f, &node->right->right);
+            else if (node->right->kind != ND_LVAR && node->right->kind != ND_GVAR) visit(f, &node->right);
+            return;
+        case ND_DEREF:
+            visit(f, &node->right);
+            if (is_scalar(node->type)) load(f, ref);
+            return;
+        case ND_LVAR:
+        case ND_GVAR:
+            if (is_scalar(node->type)) load(f, ref);
+            return;
+    }
+    visit(f, &node->left);
+    visit(f, &node->right);
+}
+
+// *linkの文を除き、それを指していた覚えている代入のポインタを付け替える。
+static void remove_stmt(Forward *f, Node **link) {
+    Node *stmt = *link;
+    *link = stmt->next;
+    for (int i = 0; i < f->n; i++) {
+        if (f->entries[i].link == &stmt->next) f->entries[i].link = link;
+    }
+    nremoved++;
+}
+
+// lhsへの書き込みで値が変わりうる代入を忘れる。
+static void kill(Forward *f, Node *lhs) {
+    for (int i = 0; i < f->n; i++) {
+        Entry *e = &f->entries[i];
+        bool killed = may_alias(e->lhs, lhs);
+        if (is_private(lhs)) {
+            // 値やアドレスの計算に使っている変数への代入
+            killed = killed || (e->val && reads_var(e->val, lhs->var)) || reads_var(e->lhs, lhs->var);
+        }
+        if (killed) remove_entry(f, i--);
+    }
+}
+
+// 関数呼び出し: 呼び出し先はメモリを読み書きしうる。
+static void call(Forward *f) {
+    for (int i = 0; i < f->n; i++) {
+        if (!is_private(f->entries[i].lhs)) remove_entry(f, i--);
+    }
+}
+
+// 代入文*linkを処理する。
+static void store(Forward *f, Node **link, Node *asgmt) {
+    Node *lhs = asgmt->left;
+    if (lhs->kind == ND_DEREF) visit(f, &lhs->right);
+    visit(f, &asgmt->right);
+
+    // 前の書き込みが読まれないまま上書きされるなら除く
+    for (int i = 0; i < f->n; i++) {
+        Entry *e = &f->entries[i];
+        if (!e->read && same_node(e->lhs, lhs)) {
+            Node **prev = e->link;
+            Node *dead = *prev;
+            remove_stmt(f, prev);
+            if (link == &dead->next) link = prev;
+            break;
+        }
+    }
+    kill(f, lhs);
+    if (trackable(lhs) && f->n < MAX_ENTRIES) {
+        f->entries[f->n++] = (Entry) {lhs, forwardable(lhs, asgmt->right), link, false};
+    }
+}
+
+// 基本ブロックに含められる文なら処理して真を返す。
+static bool forward_stmt(Forward *f, Node **link) {
+    Node *node = *link;
+    switch (node->kind) {
+        case ND_RETURN:
+            if (!is_pure(node->right)) return false;
+            visit(f, &node->right);
+            return true;
+        case ND_IF:
+            if (!is_pure(node->cond)) return false;
+            visit(f, &node->cond);
+            return true;
+        case ND_EXPR_STMT:
+            break;
+        default:
+            return false;
+    }
+    Node *e = node->right;
+    if (is_pure(e)) {
+        visit(f, &node->right);
+        return true;
+    }
+    if (e->kind == ND_ASGMT && is_pure(e->left) && is_pure(e->right)) {
+        store(f, link, e);
+        return true;
+    }
+    if (e->kind == ND_FUNCCALL) {
+        for (int i = 0; i < e->nparams; i++) {
+            if (!is_pure(e->params[i])) return false;
+        }
+        for (int i = 0; i < e->nparams; i++) {
+            visit(f, &e->params[i]);
+        }
+        call(f);
+        return true;
+    }
+    return false;
+}
+
+static void forward_list(Node **link);
+
+// 文の中に入れ子になった文の並びを処理する。
+static void forward_nested(Node *node) {
+    if (node == NULL) return;
+    switch (node->kind) {
+        case ND_BLOCK:
+            forward_list(&node->right);
+            return;
+        case ND_IF:
+            forward_nested(node->body);
+            forward_nested(node->els);
+            return;
+        case ND_FOR:
+        case ND_WHILE:
+        case ND_SWITCH:
+        case ND_CASE:
+            forward_nested(node->body);
+            return;
+    }
+    // 文式やインライン展開した本体
+    forward_nested(node->left);
+    forward_nested(node->right);
+    for (int i = 0; i < node->nparams; i++) {
+        forward_nested(node->params[i]);
+    }
+}
+
+// 文の並びを先頭から処理する。基本ブロックに含められない文で覚えている代入を忘れる。
+static void forward_list(Node **link) {
+    Forward f = {0};
+    while (*link) {
+        Node *node = *link;
+        if (!forward_stmt(&f, link)) {
+            f.n = 0;
+            forward_nested(node);
+        } else if (node->kind == ND_IF || node->kind == ND_RETURN) {
+            f.n = 0;
+            forward_nested(node);
+        }
+        // 処理中の文が除かれることはないので、*linkはnodeのまま
+        link = &node->next;
+    }
+}
+
+// 関数本体の基本ブロックごとにストアからロードへ値を転送し、無駄なストアを除く。
+void store_forward(Function *fn) {
+    mark_escaped(fn);
+    nforwarded = nremoved = 0;
+    forward_list(&fn->code);
+    if (nforwarded || nremoved) {
+        opt_report(P_FORWARD, "%s: %d loads forwarded, %d dead stores removed", fn->name, nforwarded, nremoved);
+    }
+}
@@ -0,0 +1,223 @@
+//
+//  ifconv.c
+//  tinycc
+//
+//  Created by sanluisrey on 2026/10/19.
+//
+
+#include "tinycc.h"
+
+// 分岐の条件付き転送命令(cmov, setcc)への置き換え
+//
+// 次の形の小さなif文を、両方の値を計算してから条件で選ぶ式(ND_SELECT)に置き換える。
+//   if (c) x = a; else x = b;  =>  x = c ? a : b
+//   if (c) x = a;              =>  x = c ? a : x
+//   if (c) return a; return b; =>  return c ? a : b
+// 値が1と0で条件が比較なら、比較の結果をそのまま代入する(setcc)。
+//
+// 選ばれない方の値も計算するので、値は例外を起こさず副作用のない式に限る。
+// メモリを読む式は、条件の中で同じ式を既に読んでいる場合だけ許す(if (a[i] < m) m = a[i];)。
+// 分岐を残した方が速いかどうかは、両方の値の計算量の合計がif_conv_budget以下かで判断する。
+
+int if_conv_budget = 4;
+
+typedef struct IfConv IfConv;
+struct IfConv {
+    Function *fn;
+    int nselects;
+    int nsetcc;
+};
+
+typedef struct Find Find;
+struct Find {
+    Node *target;
+    bool found;
+};
+
+static void find_same(Node *node, int depth, void *arg) {
+    Find *f = arg;
+    if (same_node(node, f->target)) f->found = true;
+}
+
+// 条件を計算するときに同じ式を計算しているかどうか
+static bool in_cond(Node *node, Node *cond) {
+    Find f = {node};
+    walk(cond, 0, find_same, &f);
+    return f.found;
+}
+
+// 条件にかかわらず計算してよい式なら計算量を、そうでなければ-1を返す。
+static int cost(Node *node, Node *cond) {
+    if (in_cond(node, cond)) return node->kind == ND_NUM || node->kind == ND_LVAR ? 0 : 1;
+    switch (node->kind) {
+        case ND_NUM:
+            return 0;
+        case ND_LVAR:
+            return node->var->escaped ? 1 : 0;
+        case ND_GVAR:
+            return isarray(node->type) ? 0 : 1;
+        case ND_ADDR:
+            return node->right->kind == ND_LVAR || node->right->kind == ND_GVAR ? 0 : -1;
+        case ND_ADD:
+        case ND_SUB:
+        case ND_MUL:
+        case ND_SHL:
+        case ND_NEG:
+        case ND_EQ:
+        case ND_NE:
+        case ND_GT:
+        case ND_GE:
+        case ND_LT:
+        case ND_LE: {
+            int l = node->left ? cost(node->left, cond) : 0;
+            int r = cost(node->right, cond);
+            return l < 0 || r < 0 ? -1 : l + r + 1;
+        }
+    }
+    return -1;
+}
+
+// 1文だけのブロックならその文を返す。
+static Node *single(Node *node) {
+    while (node && node->kind == ND_BLOCK && node->name == NULL && node->right && node->right->next == NULL) {
+        node = node->right;
+    }
+    return node;
+}
+
+// 文がローカル変数への代入(x = a)なら代入の式を返す。
+static Node *local_assign(Node *node) {
+    node = single(node);
+    if (node == NULL || node->kind != ND_EXPR_STMT || node->right->kind != ND_ASGMT) return NULL;
+    Node *lhs = node->right->left;
+    if (lhs->kind != ND_LVAR || lhs->var->escaped || isarray(lhs->type)) return NULL;
+    return node->right;
+}
+
+// c ? a : bの式を作る。1と0を比較の結果で選ぶなら比較そのものにする。
+static Node *new_select(IfConv *ic, Node *cond, Node *a, Node *b, Type *ty) {
+    if (a->kind == ND_NUM && b->kind == ND_NUM && is_cmp(cond)) {
+        if (a->val == 1 && b->val == 0) {
+            ic->nsetcc++;
+            return cond;
+        }
+        if (a->val == 0 && b->val == 1) {
+            static NodeKind inverse[] = {[ND_EQ] = ND_NE, [ND_NE] = ND_EQ, [ND_GT] = ND_LE,
+                [ND_GE] = ND_LT, [ND_LT] = ND_GE, [ND_LE] = ND_GT};
+            ic->nsetcc++;
+            cond->kind = inverse[cond->kind];
+            return cond;
+        }
+    }
+    Node *arms = calloc(1, sizeof(Node));
+    arms->kind = ND_ARMS;
+    arms->type = ty;
+    arms->left = a;
+    arms->right = b;
+    Node *ret = calloc(1, sizeof(Node));
+    ret->kind = ND_SELECT;
+    ret->type = ty;
+    ret->left = cond;
+    ret->right = arms;
+    ic->nselects++;
+    return ret;
+}
+
+// 2つの値の計算量が分岐を残すより安いかどうか
+static bool profitable(Node *cond, Node *a, Node *b) {
+    int ca = cost(a, cond), cb = cost(b, cond);
+    return ca >= 0 && cb >= 0 && ca + cb <= if_conv_budget;
+}
+
+// *linkのif文を置き換えられれば置き換えて真を返す。
+static bool convert(IfConv *ic, Node **link) {
+    Node *node = *link;
+    Node *cond = node->cond;
+    if (node->kind != ND_IF || cond->kind == ND_NUM || !is_pure(cond) || has_call(cond)) return false;
+
+    // if (c) x = a; [else x = b;]
+    Node *then = local_assign(node->body);
+    if (then) {
+        Var *var = then->left->var;
+        Node *els = node->els ? local_assign(node->els) : NULL;
+        if (node->els && (els == NULL || els->left->var != var)) return false;
+        Node *a = then->right;
+        Node *b = els ? els->right : then->left;
+        if (!profitable(cond, a, b)) return false;
+        Node *asgmt = calloc(1, sizeof(Node));
+        *asgmt = *then;
+        asgmt->right = new_select(ic, cond, a, b, then->left->type);
+        Node *stmt = new_node_expr(asgmt);
+        stmt->next = node->next;
+        *link = stmt;
+        return true;
+    }
+
+    // if (c) return a; [else] return b;
+    Node *ret = single(node->body);
+    Node *other = node->els ? single(node->els) : node->next;
+    if (ret == NULL || other == NULL || ret->kind != ND_RETURN || other->kind != ND_RETURN) return false;
+    // インライン展開した本体のreturnは同じ飛び先のものに限る
+    if ((ret->name == NULL) != (other->name == NULL) || (ret->name && strcmp(ret->name, other->name) != 0)) return false;
+    if (ret->right->kind == ND_NULL || other->right->kind == ND_NULL) return false;
+    if (!profitable(cond, ret->right, other->right)) return false;
+    Node *stmt = calloc(1, sizeof(Node));
+    *stmt = *ret;
+    stmt->right = new_select(ic, cond, ret->right, other->right, ret->right->type);
+    stmt->next = node->els ? node->next : other->next;
+    *link = stmt;
+    return true;
+}
+
+static void if_conv_list(IfConv *ic, Node **link);
+static void if_conv_stmt(IfConv *ic, Node **ref);
+
+// 文の中に入れ子になった文を処理する。
+static void if_conv_nested(IfConv *ic, Node *node) {
+    if (node == NULL) return;
+    switch (node->kind) {
+        case ND_BLOCK:
+            if_conv_list(ic, &node->right);
+            return;
+        case ND_IF:
+            if_conv_stmt(ic, &node->body);
+            if (node->els) if_conv_stmt(ic, &node->els);
+            return;
+        case ND_FOR:
+        case ND_WHILE:
+        case ND_SWITCH:
+        case ND_CASE:
+            if (node->initialization) if_conv_stmt(ic, &node->initialization);
+            if_conv_stmt(ic, &node->body);
+            return;
+    }
+    // 文式やインライン展開した本体
+    if_conv_nested(ic, node->left);
+    if_conv_nested(ic, node->right);
+    for (int i = 0; i < node->nparams; i++) {
+        if_conv_nested(ic, node->params[i]);
+    }
+}
+
+// 内側を先に置き換え、本体が1文になったifも対象にする。
+static void if_conv_stmt(IfConv *ic, Node **ref) {
+    if_conv_nested(ic, *ref);
+    if ((*ref)->kind == ND_IF) convert(ic, ref);
+}
+
+static void if_conv_list(IfConv *ic, Node **link) {
+    for (; *link; link = &(*link)->next) {
+        if_conv_stmt(ic, link);
+    }
+}
+
+// 関数の小さなif文を条件付き転送に置き換える。
+void if_convert(Function *fn) {
+    mark_escaped(fn);
+    IfConv ic = {fn};
+    if_conv_list(&ic, &fn->code);
+    if (ic.nselects || ic.nsetcc) {
+        opt_report(P_IFCONV, "%s: %d if statements converted (%d conditional moves, %d setcc)",
+                   fn->name, ic.nselects + ic.nsetcc, ic.nselects, ic.nsetcc);
+    }
+}
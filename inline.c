@@ -0,0 +1,178 @@
+//
+//  inline.c
+//  tinycc
+//
+//  Created by sanluisrey on 2026/10/19.
+//
+
+#include "tinycc.h"
+
+// 展開する関数本体の大きさの上限(ノード数)
+#define INLINE_LIMIT 40
+
+// 展開したreturnの飛び先ラベルの番号づけ
+static int nlabels;
+
+typedef struct Inliner Inliner;
+struct Inliner {
+    char *self;     // 関数名
+    int size;       // ノード数
+    bool unsafe;    // 自身の呼び出しや文式を含むかどうか
+};
+
+// ノード数を数え、展開できない構文を探す。
+// 式の中の文式にreturnがあると飛び先でスタックの深さが合わないので、文式を含む関数は展開しない。
+static void measure(Node *node, int depth, void *arg) {
+    Inliner *in = arg;
+    in->size++;
+    if (node->kind == ND_FUNCCALL && !strcmp(node->name, in->self)) {
+        in->unsafe = true;
+    }
+    switch (node->kind) {
+        case ND_BLOCK:
+        case ND_IF:
+        case ND_FOR:
+        case ND_WHILE:
+            if ((node->cond && node->cond->kind == ND_BLOCK)
+                || (node->step && node->step->kind == ND_BLOCK)) {
+                in->unsafe = true;
+            }
+            return;
+    }
+    if ((node->left && node->left->kind == ND_BLOCK) || (node->right && node->right->kind == ND_BLOCK)) {
+        in->unsafe = true;
+    }
+    for (int i = 0; i < node->nparams; i++) {
+        if (node->params[i]->kind == ND_BLOCK) in->unsafe = true;
+    }
+}
+
+// 関数が呼び出し元に展開できるかどうか
+static bool can_inline(Function *callee, Node *call) {
+    if (callee == NULL || callee->code == NULL || callee->nparams != call->nparams) return false;
+    Inliner in = {callee->name};
+    for (Node *node = callee->code; node != NULL; node = node->next) {
+        walk(node, 0, measure, &in);
+    }
+    return !in.unsafe && in.size <= INLINE_LIMIT;
+}
+
+// 展開先の関数に新しいローカル変数を作る。
+static Var *new_var(Function *fn, Var *orig) {
+    Var *var = calloc(1, sizeof(Var));
+    *var = *orig;
+    var->reg = 0;
+    var->offset = 0;
+    fn->vars = realloc(fn->vars, (fn->nvars + 1) * sizeof(Var *));
+    fn->vars[fn->nvars++] = var;
+    return var;
+}
+
+typedef struct Clone Clone;
+struct Clone {
+    Function *callee;
+    Var **vars;     // callee->varsに対応する展開先の変数
+    char *label;    // returnの飛び先
+};
+
+// 部分木を複製する。変数は展開先の変数に置き換え、returnは展開の末尾へのジャンプにする。
+static Node *clone(Node *node, Clone *c) {
+    if (node == NULL) return NULL;
+    Node *ret = calloc(1, sizeof(Node));
+    *ret = *node;
+    ret->left = clone(node->left, c);
+    ret->right = clone(node->right, c);
+    ret->cond = clone(node->cond, c);
+    ret->body = clone(node->body, c);
+    ret->els = clone(node->els, c);
+    ret->initialization = clone(node->initialization, c);
+    ret->step = clone(node->step, c);
+    ret->next = clone(node->next, c);
+    if (node->nparams) {
+        ret->params = calloc(node->nparams, sizeof(Node *));
+        for (int i = 0; i < node->nparams; i++) {
+            ret->params[i] = clone(node->params[i], c);
+        }
+    }
+    if (node->kind == ND_LVAR) {
+        for (int i = 0; i < c->callee->nvars; i++) {
+            if (c->callee->vars[i] == node->var) ret->var = c->vars[i];
+        }
+    }
+    if (node->kind == ND_RETURN) {
+        ret->name = c->label;
+    }
+    return ret;
+}
+
+// 呼び出しを({ 仮引数 = 実引数; ...; 本体 })の文式に置き換える。
+// 本体のreturnは文式の末尾のラベル.<label>.returnへジャンプし、戻り値はraxに残る。
+static void expand(Function *fn, Node *call, Function *callee) {
+    Clone c = {callee};
+    c.vars = calloc(callee->nvars, sizeof(Var *));
+    for (int i = 0; i < callee->nvars; i++) {
+        c.vars[i] = new_var(fn, callee->vars[i]);
+    }
+    char *label = calloc(1, strlen(callee->name) + 16);
+    sprintf(label, "%s.i%d", callee->name, ++nlabels);
+    c.label = label;
+
+    Node stmts = {0};
+    Node *cur = &stmts;
+    for (int i = 0; i < call->nparams; i++) {
+        Var *param = NULL;
+        for (int j = 0; j < callee->nvars; j++) {
+            if (callee->vars[j] == callee->params[i]) param = c.vars[j];
+        }
+        Node *lhs = new_node_var(param);
+        Node *asgmt = calloc(1, sizeof(Node));
+        asgmt->kind = ND_ASGMT;
+        asgmt->type = param->type;
+        asgmt->left = lhs;
+        asgmt->right = call->params[i];
+        cur = cur->next = calloc(1, sizeof(Node));
+        cur->kind = ND_EXPR_STMT;
+        cur->right = asgmt;
+    }
+    cur->next = clone(callee->code, &c);
+
+    call->kind = ND_BLOCK;
+    call->right = stmts.next;
+    call->name = label;
+    call->params = NULL;
+    call->nparams = 0;
+}
+
+// 部分木の呼び出しを展開する。展開した本体の中の呼び出しはそれ以上展開しない。
+static void inline_calls(Function *fn, Node *node) {
+    if (node == NULL) return;
+    if (node->kind == ND_FUNCCALL) {
+        for (int i = 0; i < node->nparams; i++) {
+            inline_calls(fn, node->params[i]);
+        }
+        Function *callee = find_function(node->name);
+        if (callee == NULL || callee == fn) return;
+        // 呼び出し先を先に処理し、展開済みの本体を使う(相互再帰のときは処理中の本体のまま)
+        inline_func(callee);
+        if (!can_inline(callee, node)) return;
+        opt_report(P_INLINE, "%s: inlined %s", fn->name, callee->name);
+        expand(fn, node, callee);
+        return;
+    }
+    inline_calls(fn, node->left);
+    inline_calls(fn, node->right);
+    inline_calls(fn, node->cond);
+    inline_calls(fn, node->body);
+    inline_calls(fn, node->els);
+    inline_calls(fn, node->initialization);
+    inline_calls(fn, node->step);
+    inline_calls(fn, node->next);
+}
+
+// 同じ翻訳単位で定義された小さな関数の呼び出しを本体で置き換える。
+void inline_func(Function *fn) {
+    if (fn->inline_state) return;
+    fn->inline_state = 1;
+    inline_calls(fn, fn->code);
+    fn->inline_state = 2;
+}
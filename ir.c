@@ -0,0 +1,1095 @@
+//
+//  ir.c
+//  tinycc
+//
+//  Created by sanluisrey on 2026/10/19.
+//
+
+#include "tinycc.h"
+
+// 抽象構文木からSSA形式の三番地コードへの変換
+//
+// 関数本体を基本ブロックに分けながら三番地コードの命令列にする。アドレスを取られないスカラー変数は
+// SSA形式の値として扱い、それ以外の変数はフレーム上のメモリとしてLOAD, STOREで読み書きする。
+// SSA形式は Braun et al. "Simple and Efficient Construction of Static Single Assignment Form"
+// の方法で直接組み立てる。ブロックごとに変数の現在の値を記録し、定義がなければ先行ブロックを辿る。
+// 先行ブロックが確定していないブロック(ループの先頭など)では仮のφ関数を置き、確定したときに
+// 被演算子を埋める。被演算子が自身と1つの値だけのφ関数はその値に置き換える。
+// 値の意味はcodegen.cと同じで、式は64ビットで計算し、int, charの変数への代入で符号拡張する。
+// ベクトル化したループを含む関数は変換せず、抽象構文木から直接コードを生成する。
+
+// 変換中の関数
+static Function *fn;
+// 命令を追加しているブロック
+static Block *cur;
+// SSA形式にする変数の数(インライン展開した本体の戻り値を含む)
+static int nslots;
+// 仮引数を受け取った後の本体の先頭(自己末尾再帰の飛び先)
+static Block *start;
+// breakの飛び先
+static Block *break_to;
+// 変換中の文式({ ... })の入れ子の深さ
+static int stmt_expr_depth;
+// 末尾のreturnの値として変換中のインライン展開の名前
+static char *tail_label;
+// 末尾呼び出しをジャンプにできるかどうか(フレーム上の変数のアドレスが外に出ない)
+static bool tail_ok;
+
+// 変換中のインライン展開した本体(returnの飛び先と戻り値の変数)
+typedef struct Inlined Inlined;
+struct Inlined {
+    char *name;
+    Var *result;
+    Block *end;
+    Inlined *outer;
+};
+static Inlined *inlined;
+// インライン展開した本体の戻り値の変数(変数の後の番号を順に使う)
+static Var **results;
+static int nresults;
+
+// 変換中のswitch文のcaseラベルと、それぞれの入口のブロック
+typedef struct Switch Switch;
+struct Switch {
+    Node **cases;
+    Block **entries;
+    int n;
+    Switch *outer;
+};
+static Switch *switches;
+
+// メモリオペランド [var|sym|base + index*scale + disp] の構成要素(codegen.cのAddrと同じ分解)
+typedef struct Mem Mem;
+struct Mem {
+    Var *var;       // ベースがフレーム上の変数のときの変数
+    char *sym;      // ベースがrip相対のシンボルのときの名前
+    Node *base;     // ベースを計算する式
+    Node *index;    // インデックスを計算する式(NULLならインデックスなし)
+    int scale;
+    int disp;
+};
+
+// 関数のvarsに含まれる変数かどうか
+static bool is_local(Var *var) {
+    return var->index >= 0 && var->index < fn->nvars && fn->vars[var->index] == var;
+}
+
+// SSA形式の値として扱う変数かどうか
+static bool is_ssa(Var *var) {
+    return var->index >= fn->nvars || (!var->escaped && is_scalar(var->type));
+}
+
+static IR *new_ir(IROp op, int nops) {
+    IR *ir = calloc(1, sizeof(IR));
+    ir->op = op;
+    ir->id = fn->nvalues++;
+    ir->nops = nops;
+    if (nops) ir->ops = calloc(nops, sizeof(IR *));
+    return ir;
+}
+
+static IR *imm(int val) {
+    IR *ir = new_ir(IR_IMM, 0);
+    ir->val = val;
+    return ir;
+}
+
+// 命令をブロックの末尾に追加する。
+static IR *append_ir(Block *b, IR *ir) {
+    ir->block = b;
+    ir->prev = b->last;
+    if (b->last) b->last->next = ir;
+    else b->first = ir;
+    b->last = ir;
+    return ir;
+}
+
+// φ関数をブロックの先頭に追加する。
+static IR *prepend(Block *b, IR *ir) {
+    ir->block = b;
+    ir->next = b->first;
+    if (b->first) b->first->prev = ir;
+    else b->last = ir;
+    b->first = ir;
+    return ir;
+}
+
+static void unlink_ir(IR *ir) {
+    Block *b = ir->block;
+    if (ir->prev) ir->prev->next = ir->next;
+    else b->first = ir->next;
+    if (ir->next) ir->next->prev = ir->prev;
+    else b->last = ir->prev;
+}
+
+static IR *add_ir(IR *ir) {
+    return append_ir(cur, ir);
+}
+
+static Block *new_block(void) {
+    Block *b = calloc(1, sizeof(Block));
+    b->defs = calloc(nslots, sizeof(IR *));
+    char *label = calloc(1, 32);
+    sprintf(label, ".Lbb%d", count());
+    b->label = label;
+    return b;
+}
+
+// ブロックを出力順の末尾に置き、命令の追加先にする。
+static void start_block(Block *b) {
+    fn->blocks = realloc(fn->blocks, (fn->nblocks + 1) * sizeof(Block *));
+    b->id = fn->nblocks;
+    fn->blocks[fn->nblocks++] = b;
+    cur = b;
+}
+
+static void add_edge(Block *from, Block *to) {
+    assert(!to->sealed);
+    to->preds = realloc(to->preds, (to->npreds + 1) * sizeof(Block *));
+    to->preds[to->npreds++] = from;
+    from->succs = realloc(from->succs, (from->nsuccs + 1) * sizeof(Block *));
+    from->succs[from->nsuccs++] = to;
+}
+
+// 到達しないブロック(先行ブロックがなく確定している)かどうか
+static bool is_dead(Block *b) {
+    return b->sealed && b->npreds == 0 && b != fn->blocks[0];
+}
+
+// 分岐の後に続く到達しないコードを置くブロックを始める。
+static void seal(Block *b);
+static void unreachable(void) {
+    Block *b = new_block();
+    seal(b);
+    start_block(b);
+}
+
+static void jump(Block *to) {
+    add_ir(new_ir(IR_JMP, 0));
+    add_edge(cur, to);
+}
+
+// 置き換えられたφ関数を辿って値を返す。
+static IR *resolve(IR *v) {
+    while (v && v->replaced) v = v->replaced;
+    return v;
+}
+
+// 変数の値の読み書き(Braun et al.のwriteVariable, readVariable)
+static IR *read_var(int slot, Block *b);
+
+static void write_var(int slot, Block *b, IR *v) {
+    b->defs[slot] = v;
+}
+
+static Var *slot_var(int slot);
+
+static IR *new_phi(Block *b, int slot) {
+    IR *phi = new_ir(IR_PHI, 0);
+    phi->var = slot_var(slot);
+    return prepend(b, phi);
+}
+
+// 被演算子が自身と1つの値だけのφ関数をその値に置き換える。置き換えた値を返す。
+static IR *remove_trivial(IR *phi) {
+    IR *same = NULL;
+    for (int i = 0; i < phi->nops; i++) {
+        IR *op = resolve(phi->ops[i]);
+        if (op == same || op == phi) continue;
+        if (same) return phi;
+        same = op;
+    }
+    // 値の定義されない経路だけなら0とする
+    if (same == NULL) same = imm(0);
+    phi->replaced = same;
+    return same;
+}
+
+static void add_phi_operands(IR *phi, int slot) {
+    Block *b = phi->block;
+    phi->nops = b->npreds;
+    phi->ops = calloc(b->npreds + 1, sizeof(IR *));
+    for (int i = 0; i < b->npreds; i++) {
+        phi->ops[i] = read_var(slot, b->preds[i]);
+    }
+}
+
+static IR *read_var(int slot, Block *b) {
+    if (b->defs[slot]) return resolve(b->defs[slot]);
+    IR *v;
+    if (!b->sealed) {
+        v = new_phi(b, slot);
+        b->incomplete = realloc(b->incomplete, (b->nincomplete + 1) * sizeof(IR *));
+        b->incomplete[b->nincomplete++] = v;
+    } else if (b->npreds == 0) {
+        // 初期化されない変数や到達しないコード
+        v = imm(0);
+    } else {
+        // 循環する参照を止めるため、先にφ関数を変数の値にしておく。
+        // 入口の条件が偽に畳み込まれたループの本体のように、先行ブロックが1つずつのまま
+        // 循環する到達しないブロックもあるので、先行ブロックが1つでも同じにする
+        // (自明なφ関数は先行ブロックの値に置き換わる)
+        IR *phi = new_phi(b, slot);
+        write_var(slot, b, phi);
+        add_phi_operands(phi, slot);
+        v = remove_trivial(phi);
+    }
+    write_var(slot, b, v);
+    return v;
+}
+
+// ブロックの先行ブロックが確定したので、仮に置いたφ関数の被演算子を埋める。
+static void seal(Block *b) {
+    assert(!b->sealed);
+    for (int i = 0; i < b->nincomplete; i++) {
+        IR *phi = b->incomplete[i];
+        add_phi_operands(phi, phi->var->index);
+        remove_trivial(phi);
+    }
+    b->sealed = true;
+}
+
+static Var *slot_var(int slot) {
+    if (slot < fn->nvars) return fn->vars[slot];
+    if (slot < fn->nvars + nresults) return results[slot - fn->nvars];
+    error("SSA形式の変数が見つかりません。");
+    return NULL;
+}
+
+// 比較演算の種類を命令の種類に変換する。
+static IROp cmp_op(NodeKind kind) {
+    switch (kind) {
+        case ND_EQ:
+            return IR_EQ;
+        case ND_NE:
+            return IR_NE;
+        case ND_GT:
+            return IR_GT;
+        case ND_GE:
+            return IR_GE;
+        case ND_LT:
+            return IR_LT;
+        case ND_LE:
+            return IR_LE;
+    }
+    error("比較演算ではありません。");
+    return IR_EQ;
+}
+
+// 比較を評価する。
+static bool holds(IROp cmp, long a, long b) {
+    switch (cmp) {
+        case IR_EQ:
+            return a == b;
+        case IR_NE:
+            return a != b;
+        case IR_GT:
+            return a > b;
+        case IR_GE:
+            return a >= b;
+        case IR_LT:
+            return a < b;
+        case IR_LE:
+            return a <= b;
+    }
+    error("比較演算ではありません。");
+    return false;
+}
+
+// 定数の演算を64ビットで畳み込む。結果がintに収まらなければ偽を返す。
+static bool fold_op(IROp op, long a, long b, long *r) {
+    switch (op) {
+        case IR_ADD:
+            *r = a + b;
+            break;
+        case IR_SUB:
+            *r = a - b;
+            break;
+        case IR_MUL:
+            *r = a * b;
+            break;
+        case IR_SHL:
+            *r = (long) ((unsigned long) a << b);
+            break;
+        case IR_NEG:
+            *r = -a;
+            break;
+        case IR_EQ:
+        case IR_NE:
+        case IR_GT:
+        case IR_GE:
+        case IR_LT:
+        case IR_LE:
+            *r = holds(op, a, b);
+            break;
+        default:
+            return false;
+    }
+    return *r == (int) *r;
+}
+
+static IR *binary(IROp op, IR *a, IR *b) {
+    long r;
+    if (a->op == IR_IMM && b->op == IR_IMM && fold_op(op, a->val, b->val, &r)) return imm((int) r);
+    IR *ir = new_ir(op, 2);
+    ir->ops[0] = a;
+    ir->ops[1] = b;
+    return add_ir(ir);
+}
+
+static IR *negate(IR *a) {
+    long r;
+    if (a->op == IR_IMM && fold_op(IR_NEG, a->val, 0, &r)) return imm((int) r);
+    IR *ir = new_ir(IR_NEG, 1);
+    ir->ops[0] = a;
+    return add_ir(ir);
+}
+
+// 値がtypeの大きさから符号拡張した範囲に収まっていることが分かるかどうか
+static bool fits(IR *v, Type *type) {
+    switch (v->op) {
+        case IR_IMM:
+            return type->ty == CHAR ? v->val == (signed char) v->val : true;
+        case IR_EXT:
+        case IR_LOAD:
+            return (v->type->ty == CHAR || v->type->ty == INT) && v->type->size <= type->size;
+        case IR_DIV:
+        case IR_MOD:
+            return iscint(v->type) && type->ty == INT;
+        case IR_EQ:
+        case IR_NE:
+        case IR_GT:
+        case IR_GE:
+        case IR_LT:
+        case IR_LE:
+            return true;
+    }
+    return false;
+}
+
+// int, charの値を型の大きさから符号拡張する(変数への代入)。
+static IR *ext(IR *v, Type *type) {
+    if (!iscint(type) || fits(v, type)) return v;
+    if (v->op == IR_IMM) return imm(type->ty == CHAR ? (signed char) v->val : v->val);
+    IR *ir = new_ir(IR_EXT, 1);
+    ir->ops[0] = v;
+    ir->type = type;
+    return add_ir(ir);
+}
+
+static IR *lower_expr(Node *node);
+static void lower_void(Node *node);
+static void lower_stmt(Node *node);
+static IR *lower_list(Node *list);
+
+// 左辺値と、ポインタの値を求める式をメモリオペランドに分解する(codegen.cのmatch_lval, match_ptr)。
+static void match_ptr(Node *node, Mem *m);
+
+static void match_lval(Node *node, Mem *m) {
+    switch (node->kind) {
+        case ND_LVAR:
+            m->var = node->var;
+            return;
+        case ND_GVAR:
+        case ND_STR:
+            m->sym = node->name;
+            return;
+        case ND_DEREF:
+            match_ptr(node->right, m);
+            return;
+    }
+    error("左辺値ではありません。");
+}
+
+static void match_ptr(Node *node, Mem *m) {
+    if (isarray(node->type) && node->kind != ND_ADD) {
+        match_lval(node, m);
+        return;
+    }
+    if (node->kind == ND_ADD && !iscint(node->type)) {
+        Node *rhs = node->right;
+        if (rhs->kind == ND_NUM) {
+            match_ptr(node->left, m);
+            m->disp += rhs->val;
+            return;
+        }
+        Mem b = *m;
+        match_ptr(node->left, &b);
+        if (b.index == NULL) {
+            // インデックスの倍率は1, 2, 4, 8のいずれか
+            b.scale = 1;
+            if (rhs->kind == ND_SHL && rhs->right->val <= 3) {
+                b.scale = 1 << rhs->right->val;
+                rhs = rhs->left;
+            }
+            // a[i+c] の定数部分は変位にまとめる
+            if (rhs->kind == ND_ADD && iscint(rhs->type) && rhs->right->kind == ND_NUM) {
+                b.disp += rhs->right->val * b.scale;
+                rhs = rhs->left;
+            }
+            b.index = rhs;
+            *m = b;
+            return;
+        }
+    }
+    m->base = node;
+}
+
+// メモリオペランドを使う命令を作る。インデックス、ベースの順に計算し、命令はまだ追加しない。
+static IR *new_mem(IROp op, Mem *m, Type *type) {
+    IR *ir = new_ir(op, 3);
+    ir->var = m->var;
+    ir->sym = m->sym;
+    ir->scale = m->scale;
+    ir->disp = m->disp;
+    ir->type = type;
+    if (m->index) ir->ops[1] = lower_expr(m->index);
+    if (m->base) ir->ops[0] = lower_expr(m->base);
+    return ir;
+}
+
+// 左辺値のアドレス
+static IR *lower_addr(Node *node) {
+    Mem m = {0};
+    match_lval(node, &m);
+    if (m.base && !m.index && !m.disp) return lower_expr(m.base);
+    return add_ir(new_mem(IR_LEA, &m, NULL));
+}
+
+// メモリにある左辺値の読み込み。配列はアドレスを値とする。
+static IR *lower_load(Node *node) {
+    if (isarray(node->type)) return lower_addr(node);
+    Mem m = {0};
+    match_lval(node, &m);
+    return add_ir(new_mem(IR_LOAD, &m, node->type));
+}
+
+static IR *lower_assign(Node *node) {
+    Node *lhs = node->left;
+    if (lhs->kind == ND_LVAR && is_ssa(lhs->var)) {
+        IR *v = lower_expr(node->right);
+        write_var(lhs->var->index, cur, ext(v, lhs->var->type));
+        return v;
+    }
+    Mem m = {0};
+    match_lval(lhs, &m);
+    IR *store = new_mem(IR_STORE, &m, lhs->type);
+    // 代入式の値はストアする前の値(codegen.cと同じ)
+    IR *v = lower_expr(node->right);
+    store->ops[2] = v;
+    add_ir(store);
+    return v;
+}
+
+// 二項演算は右辺、左辺の順に計算する(codegen.cと同じ)。
+static IR *lower_binary(IROp op, Node *node) {
+    IR *b = lower_expr(node->right);
+    IR *a = lower_expr(node->left);
+    if (op == IR_DIV || op == IR_MOD) {
+        IR *ir = new_ir(op, 2);
+        ir->ops[0] = a;
+        ir->ops[1] = b;
+        ir->type = node->type;
+        return add_ir(ir);
+    }
+    return binary(op, a, b);
+}
+
+static IR *lower_call(Node *node) {
+    IR *call = new_ir(IR_CALL, node->nparams);
+    call->name = node->name;
+    // スタックで渡す引数は右から、レジスタで渡す引数は左から計算する
+    for (int i = node->nparams - 1; i >= 6; i--) {
+        call->ops[i] = lower_expr(node->params[i]);
+    }
+    for (int i = 0; i < node->nparams && i < 6; i++) {
+        call->ops[i] = lower_expr(node->params[i]);
+    }
+    add_ir(call);
+    // 翻訳単位外の関数はintを返すものとし、上位ビットを符号拡張する
+    if (!find_function(node->name)) {
+        IR *ir = new_ir(IR_EXT, 1);
+        ir->ops[0] = call;
+        ir->type = IntType;
+        return add_ir(ir);
+    }
+    return call;
+}
+
+// 比較の被演算子を求める。比較でない条件は0との比較にする。
+static IROp lower_cmp(Node *cond, IR **a, IR **b) {
+    if (optimizing(P_CMPBR) && is_cmp(cond)) {
+        *b = lower_expr(cond->right);
+        *a = lower_expr(cond->left);
+        return cmp_op(cond->kind);
+    }
+    *a = lower_expr(cond);
+    *b = imm(0);
+    return IR_NE;
+}
+
+// 条件が真ならt, 偽ならfへ分岐する。条件のないループはcondをNULLとする。
+static void lower_cond(Node *cond, Block *t, Block *f) {
+    if (cond == NULL) {
+        jump(t);
+        return;
+    }
+    IR *a, *b;
+    IROp cmp = lower_cmp(cond, &a, &b);
+    if (a->op == IR_IMM && b->op == IR_IMM) {
+        jump(holds(cmp, a->val, b->val) ? t : f);
+        return;
+    }
+    IR *br = new_ir(IR_BR, 2);
+    br->cmp = cmp;
+    br->ops[0] = a;
+    br->ops[1] = b;
+    add_ir(br);
+    add_edge(cur, t);
+    add_edge(cur, f);
+}
+
+static IR *lower_select(Node *node) {
+    IR *f = lower_expr(node->right->right);
+    IR *t = lower_expr(node->right->left);
+    IR *a, *b;
+    IROp cmp = lower_cmp(node->left, &a, &b);
+    if (a->op == IR_IMM && b->op == IR_IMM) return holds(cmp, a->val, b->val) ? t : f;
+    IR *ir = new_ir(IR_SELECT, 4);
+    ir->cmp = cmp;
+    ir->ops[0] = a;
+    ir->ops[1] = b;
+    ir->ops[2] = t;
+    ir->ops[3] = f;
+    return add_ir(ir);
+}
+
+// 文式。インライン展開した本体なら、returnは戻り値の変数に書いて末尾へ飛ぶ。
+static IR *lower_block(Node *node) {
+    Inlined in = {node->name, NULL, NULL, inlined};
+    if (node->name) {
+        in.result = calloc(1, sizeof(Var));
+        in.result->type = node->type ? node->type : IntType;
+        in.result->index = fn->nvars + nresults;
+        results[nresults++] = in.result;
+        in.end = new_block();
+        inlined = &in;
+    }
+    stmt_expr_depth++;
+    IR *v = lower_list(node->right);
+    stmt_expr_depth--;
+    if (!node->name) return v;
+    write_var(in.result->index, cur, v);
+    jump(in.end);
+    seal(in.end);
+    start_block(in.end);
+    inlined = in.outer;
+    return read_var(in.result->index, cur);
+}
+
+static IR *lower_expr(Node *node) {
+    switch (node->kind) {
+        case ND_NUM:
+            return imm(node->val);
+        case ND_LVAR:
+            if (is_ssa(node->var)) return read_var(node->var->index, cur);
+            return lower_load(node);
+        case ND_GVAR:
+        case ND_STR:
+        case ND_DEREF:
+            return lower_load(node);
+        case ND_ADDR:
+            return lower_addr(node->right);
+        case ND_ASGMT:
+            return lower_assign(node);
+        case ND_FUNCCALL:
+            return lower_call(node);
+        case ND_NULL:
+            return imm(0);
+        case ND_BLOCK:
+            return lower_block(node);
+        case ND_SELECT:
+            return lower_select(node);
+        case ND_NEG:
+            return negate(lower_expr(node->right));
+        case ND_SHL:
+            return binary(IR_SHL, lower_expr(node->left), imm(node->right->val));
+        case ND_ADD:
+            return lower_binary(IR_ADD, node);
+        case ND_SUB:
+            return lower_binary(IR_SUB, node);
+        case ND_MUL:
+            return lower_binary(IR_MUL, node);
+        case ND_DIV:
+            return lower_binary(IR_DIV, node);
+        case ND_MOD:
+            return lower_binary(IR_MOD, node);
+        case ND_EQ:
+        case ND_NE:
+        case ND_GT:
+        case ND_GE:
+        case ND_LT:
+        case ND_LE:
+            return lower_binary(cmp_op(node->kind), node);
+    }
+    error("不正な式です。");
+    return NULL;
+}
+
+// lhs = lhs + e, lhs = e + lhs, lhs = lhs - e のメモリにある左辺値を直接書き換える命令にする。
+// 条件はcodegen.cのgen_rmwと同じ。
+static bool lower_rmw(Node *node) {
+    Node *lhs = node->left, *rhs = node->right;
+    if (lhs->kind != ND_LVAR && lhs->kind != ND_GVAR && lhs->kind != ND_DEREF) return false;
+    if ((lhs->kind == ND_LVAR && is_ssa(lhs->var)) || !is_pure(lhs)) return false;
+    if (rhs->kind != ND_ADD && rhs->kind != ND_SUB) return false;
+    if (!(iscint(lhs->type) && iscint(rhs->type)) && !(isptr(lhs->type) && isptr(rhs->type))) return false;
+    Node *e;
+    if (same_node(rhs->left, lhs)) {
+        e = rhs->right;
+    } else if (rhs->kind == ND_ADD && same_node(rhs->right, lhs)) {
+        e = rhs->left;
+    } else {
+        return false;
+    }
+    if (!is_pure(e)) return false;
+    IR *v = lower_expr(e);
+    Mem m = {0};
+    match_lval(lhs, &m);
+    IR *rmw = new_mem(IR_RMW, &m, lhs->type);
+    rmw->cmp = rhs->kind == ND_ADD ? IR_ADD : IR_SUB;
+    rmw->ops[2] = v;
+    add_ir(rmw);
+    return true;
+}
+
+// 値を使わない式
+static void lower_void(Node *node) {
+    if (node->kind == ND_ASGMT && optimizing(P_RMW) && lower_rmw(node)) return;
+    lower_expr(node);
+}
+
+// 仮引数に値を置く(関数の入口と自己末尾再帰)。
+static void set_param(int i, IR *v) {
+    Var *param = fn->params[i];
+    if (is_ssa(param)) {
+        write_var(param->index, cur, ext(v, param->type));
+        return;
+    }
+    Mem m = {param};
+    IR *store = new_mem(IR_STORE, &m, param->type);
+    store->ops[2] = v;
+    add_ir(store);
+}
+
+// return f(...)をジャンプにできるかどうか(codegen.cのis_tail_callと同じ条件)
+static bool is_tail_call(Node *node) {
+    return tail_ok && node->kind == ND_FUNCCALL && node->nparams <= 6 && find_function(node->name);
+}
+
+// 末尾呼び出し: 自己再帰なら仮引数を置き換えて本体の先頭へ、それ以外は呼び出し先へジャンプする。
+static void lower_tail_call(Node *node) {
+    IR *tc = new_ir(IR_TAILCALL, node->nparams);
+    tc->name = node->name;
+    for (int i = 0; i < node->nparams; i++) {
+        tc->ops[i] = lower_expr(node->params[i]);
+    }
+    if (!strcmp(node->name, fn->name) && node->nparams == fn->nparams) {
+        for (int i = 0; i < node->nparams; i++) {
+            set_param(i, tc->ops[i]);
+        }
+        jump(start);
+        return;
+    }
+    add_ir(tc);
+}
+
+static Block *case_entry(Node *node) {
+    for (int i = 0; i < switches->n; i++) {
+        if (switches->cases[i] == node) return switches->entries[i];
+    }
+    error("caseラベルがswitch文の中にありません。");
+    return NULL;
+}
+
+// switch文。caseラベルごとに分岐先だけを先行ブロックに持つ入口のブロックを作り、
+// 直前の文から流れ込むときは入口と直前の文の両方から本体のブロックへ飛ぶ。
+static void lower_switch(Node *node) {
+    Node **cases, *dflt;
+    int n = switch_cases(node->body, &cases, &dflt);
+    IR *sw = new_ir(IR_SWITCH, 1);
+    sw->ops[0] = lower_expr(node->cond);
+    sw->cases = cases;
+    sw->ncases = n;
+    add_ir(sw);
+    Switch s = {calloc(n + 1, sizeof(Node *)), calloc(n + 1, sizeof(Block *)), n + 1, switches};
+    Block *dflt_entry = NULL;
+    for (int i = 0; i <= n; i++) {
+        Block *entry = new_block();
+        if (i < n || dflt) {
+            s.cases[i] = i < n ? cases[i] : dflt;
+            sprintf(entry->label, ".Lcase%d", s.cases[i]->label);
+        }
+        add_edge(cur, entry);
+        seal(entry);
+        s.entries[i] = entry;
+        dflt_entry = entry;
+    }
+    switches = &s;
+    Block *exit = new_block();
+    Block *saved = break_to;
+    break_to = exit;
+    unreachable();
+    lower_stmt(node->body);
+    jump(exit);
+    // defaultラベルがなければ末尾へ
+    if (!dflt) {
+        start_block(dflt_entry);
+        jump(exit);
+    }
+    break_to = saved;
+    switches = s.outer;
+    seal(exit);
+    start_block(exit);
+}
+
+static void lower_loop(Node *cond, Node *body, Node *step) {
+    Block *exit = new_block();
+    Block *saved = break_to;
+    break_to = exit;
+    Block *head = new_block();
+    if (optimizing(P_ROTATE)) {
+        // 入口で一度だけ条件を判定し、本体の末尾で条件が真なら先頭へ戻る
+        lower_cond(cond, head, exit);
+        start_block(head);
+        lower_stmt(body);
+        if (step != NULL) lower_void(step);
+        lower_cond(cond, head, exit);
+    } else {
+        Block *in = new_block();
+        jump(head);
+        start_block(head);
+        lower_cond(cond, in, exit);
+        seal(in);
+        start_block(in);
+        lower_stmt(body);
+        if (step != NULL) lower_void(step);
+        jump(head);
+    }
+    seal(head);
+    break_to = saved;
+    seal(exit);
+    start_block(exit);
+}
+
+static void lower_stmt(Node *node) {
+    switch (node->kind) {
+        case ND_RETURN: {
+            // 関数の末尾にあるreturnか(インライン展開した本体なら、展開箇所が末尾にあるか)
+            bool tail = node->name ? tail_label && !strcmp(node->name, tail_label) : stmt_expr_depth == 0;
+            if (tail && is_tail_call(node->right)) {
+                lower_tail_call(node->right);
+                unreachable();
+                return;
+            }
+            char *saved = tail_label;
+            if (tail && node->right->kind == ND_BLOCK) tail_label = node->right->name;
+            IR *v = lower_expr(node->right);
+            tail_label = saved;
+            if (node->name) {
+                // インライン展開した本体のreturnは展開箇所の末尾へ飛ぶ
+                Inlined *in = inlined;
+                while (in && strcmp(in->name, node->name) != 0) in = in->outer;
+                if (in == NULL) error("returnの飛び先がありません。");
+                write_var(in->result->index, cur, v);
+                jump(in->end);
+            } else {
+                IR *ret = new_ir(IR_RET, 1);
+                ret->ops[0] = v;
+                add_ir(ret);
+            }
+            unreachable();
+            return;
+        }
+        case ND_IF: {
+            Block *then = new_block(), *els = new_block();
+            Block *end = node->els ? new_block() : els;
+            lower_cond(node->cond, then, els);
+            seal(then);
+            start_block(then);
+            lower_stmt(node->body);
+            jump(end);
+            if (node->els != NULL) {
+                seal(els);
+                start_block(els);
+                lower_stmt(node->els);
+                jump(end);
+            }
+            seal(end);
+            start_block(end);
+            return;
+        }
+        case ND_FOR:
+            if (node->initialization != NULL) lower_stmt(node->initialization);
+            lower_loop(node->cond, node->body, node->step);
+            return;
+        case ND_WHILE:
+            lower_loop(node->cond, node->body, NULL);
+            return;
+        case ND_SWITCH:
+            lower_switch(node);
+            return;
+        case ND_CASE: {
+            Block *entry = case_entry(node);
+            if (is_dead(cur)) {
+                start_block(entry);
+            } else {
+                // 直前の文から流れ込む
+                Block *body = new_block();
+                jump(body);
+                start_block(entry);
+                jump(body);
+                seal(body);
+                start_block(body);
+            }
+            lower_stmt(node->body);
+            return;
+        }
+        case ND_BREAK:
+            jump(break_to);
+            unreachable();
+            return;
+        case ND_BLOCK:
+            lower_list(node->right);
+            return;
+        case ND_EXPR_STMT:
+            lower_void(node->right);
+            return;
+    }
+    error("不正なステートメントです。");
+}
+
+// 文の列を変換する。文式の中では最後の式文(末尾のブロックの中も含む)の値を返す。
+static IR *lower_list(Node *list) {
+    for (Node *node = list; node != NULL; node = node->next) {
+        if (node->next == NULL && stmt_expr_depth > 0) {
+            if (node->kind == ND_EXPR_STMT) return lower_expr(node->right);
+            if (node->kind == ND_BLOCK) return lower_list(node->right);
+        }
+        lower_stmt(node);
+    }
+    return imm(0);
+}
+
+// 変換できない文を含むか、関数のvarsにない変数を参照するかを調べる。
+static void find_unsupported(Node *node, int depth, void *arg) {
+    if (node->kind == ND_VLOOP || (node->kind == ND_LVAR && !is_local(node->var))) *(bool *) arg = true;
+}
+
+static void find_inlined(Node *node, int depth, void *arg) {
+    if (node->kind == ND_BLOCK && node->name) ++*(int *) arg;
+}
+
+// 全てのφ関数の置き換えが変わらなくなるまで自明なφ関数を除く。
+static void remove_trivial_phis(void) {
+    for (bool changed = true; changed; ) {
+        changed = false;
+        for (int i = 0; i < fn->nblocks; i++) {
+            for (IR *ir = fn->blocks[i]->first; ir && ir->op == IR_PHI; ir = ir->next) {
+                if (!ir->replaced && remove_trivial(ir) != ir) changed = true;
+            }
+        }
+    }
+    for (int i = 0; i < fn->nblocks; i++) {
+        for (IR *ir = fn->blocks[i]->first, *next; ir; ir = next) {
+            next = ir->next;
+            if (ir->replaced) {
+                unlink_ir(ir);
+                continue;
+            }
+            for (int j = 0; j < ir->nops; j++) {
+                ir->ops[j] = resolve(ir->ops[j]);
+            }
+        }
+    }
+}
+
+static void mark_reachable(Block *b, bool *reached) {
+    if (reached[b->id]) return;
+    reached[b->id] = true;
+    for (int i = 0; i < b->nsuccs; i++) {
+        mark_reachable(b->succs[i], reached);
+    }
+}
+
+// 入口から到達しないブロックを除き、そこからの辺に対応するφ関数の被演算子を除く。
+static void remove_unreachable(void) {
+    bool *reached = calloc(fn->nblocks, sizeof(bool));
+    mark_reachable(fn->blocks[0], reached);
+    int n = 0;
+    for (int i = 0; i < fn->nblocks; i++) {
+        Block *b = fn->blocks[i];
+        if (!reached[i]) continue;
+        int k = 0;
+        for (int j = 0; j < b->npreds; j++) {
+            if (!reached[b->preds[j]->id]) continue;
+            for (IR *ir = b->first; ir && ir->op == IR_PHI; ir = ir->next) {
+                ir->ops[k] = ir->ops[j];
+            }
+            b->preds[k++] = b->preds[j];
+        }
+        b->npreds = k;
+        for (IR *ir = b->first; ir && ir->op == IR_PHI; ir = ir->next) {
+            ir->nops = k;
+        }
+        fn->blocks[n++] = b;
+    }
+    fn->nblocks = n;
+    for (int i = 0; i < n; i++) {
+        fn->blocks[i]->id = i;
+    }
+    free(reached);
+}
+
+// 副作用のある命令から辿れない命令を除く。
+static bool has_effect(IR *ir) {
+    switch (ir->op) {
+        case IR_STORE:
+        case IR_RMW:
+        case IR_CALL:
+        case IR_BR:
+        case IR_JMP:
+        case IR_SWITCH:
+        case IR_RET:
+        case IR_TAILCALL:
+            return true;
+    }
+    return false;
+}
+
+static void mark_live(IR *ir, bool *live) {
+    if (ir == NULL || ir->op == IR_IMM || live[ir->id]) return;
+    live[ir->id] = true;
+    for (int i = 0; i < ir->nops; i++) {
+        mark_live(ir->ops[i], live);
+    }
+}
+
+static void remove_dead_code(void) {
+    bool *live = calloc(fn->nvalues, sizeof(bool));
+    for (int i = 0; i < fn->nblocks; i++) {
+        for (IR *ir = fn->blocks[i]->first; ir; ir = ir->next) {
+            if (has_effect(ir)) mark_live(ir, live);
+        }
+    }
+    for (int i = 0; i < fn->nblocks; i++) {
+        for (IR *ir = fn->blocks[i]->first, *next; ir; ir = next) {
+            next = ir->next;
+            if (!live[ir->id]) unlink_ir(ir);
+        }
+    }
+    free(live);
+}
+
+// 複数の後続を持つブロックから複数の先行を持つブロックへの辺に空のブロックを挟む。
+// φ関数の値の転送を辺ごとに置けるようにする。挟んだブロックは分岐元の直後に置く。
+static void split_critical_edges(void) {
+    int n = fn->nblocks;
+    Block **order = fn->blocks;
+    fn->blocks = NULL;
+    fn->nblocks = 0;
+    for (int i = 0; i < n; i++) {
+        Block *b = order[i];
+        start_block(b);
+        if (b->nsuccs < 2) continue;
+        for (int k = 0; k < b->nsuccs; k++) {
+            Block *s = b->succs[k];
+            if (s->npreds < 2) continue;
+            Block *mid = new_block();
+            mid->sealed = true;
+            mid->preds = calloc(1, sizeof(Block *));
+            mid->preds[mid->npreds++] = b;
+            mid->succs = calloc(1, sizeof(Block *));
+            mid->succs[mid->nsuccs++] = s;
+            for (int j = 0; j < s->npreds; j++) {
+                if (s->preds[j] == b) s->preds[j] = mid;
+            }
+            b->succs[k] = mid;
+            start_block(mid);
+            add_ir(new_ir(IR_JMP, 0));
+        }
+    }
+    free(order);
+}
+
+// 関数本体をSSA形式の三番地コードに変換し、fn->blocksに置く(P_SSA)。
+void build_ssa(Function *f) {
+    fn = f;
+    bool unsupported = false;
+    int ninlined = 0;
+    for (int i = 0; i < fn->nvars; i++) {
+        fn->vars[i]->index = i;
+    }
+    for (Node *node = fn->code; node != NULL; node = node->next) {
+        walk(node, 0, find_unsupported, &unsupported);
+        walk(node, 0, find_inlined, &ninlined);
+    }
+    if (unsupported) {
+        opt_report(P_SSA, "%s: not converted", fn->name);
+        return;
+    }
+    mark_escaped(fn);
+    tail_ok = optimizing(P_TAILCALL);
+    for (int i = 0; i < fn->nvars; i++) {
+        if (fn->vars[i]->escaped || isarray(fn->vars[i]->type)) tail_ok = false;
+    }
+    nslots = fn->nvars + ninlined;
+    results = calloc(ninlined + 1, sizeof(Var *));
+    nresults = 0;
+    fn->nvalues = 0;
+    stmt_expr_depth = 0;
+    tail_label = NULL;
+    break_to = NULL;
+    inlined = NULL;
+    switches = NULL;
+
+    // 入口で仮引数を受け取る。スタックで渡されたメモリ上の仮引数はそのまま使う
+    Block *entry = new_block();
+    seal(entry);
+    start_block(entry);
+    for (int i = 0; i < fn->nparams; i++) {
+        if (i >= 6 && !is_ssa(fn->params[i])) continue;
+        IR *param = new_ir(IR_PARAM, 0);
+        param->val = i;
+        set_param(i, add_ir(param));
+    }
+    start = new_block();
+    jump(start);
+    start_block(start);
+    for (Node *node = fn->code; node != NULL; node = node->next) {
+        lower_stmt(node);
+    }
+    // 末尾にreturnがなければ0を返す
+    IR *ret = new_ir(IR_RET, 1);
+    ret->ops[0] = imm(0);
+    add_ir(ret);
+    seal(start);
+
+    remove_trivial_phis();
+    remove_unreachable();
+    remove_trivial_phis();
+    remove_dead_code();
+    split_critical_edges();
+
+    int ninsns = 0, nphis = 0;
+    for (int i = 0; i < fn->nblocks; i++) {
+        Block *b = fn->blocks[i];
+        free(b->defs);
+        b->defs = NULL;
+        for (IR *ir = b->first; ir; ir = ir->next) {
+            ninsns++;
+            if (ir->op == IR_PHI) nphis++;
+        }
+    }
+    opt_report(P_SSA, "%s: %d blocks, %d instructions, %d phis", fn->name, fn->nblocks, ninsns, nphis);
+}
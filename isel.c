@@ -0,0 +1,1077 @@
+//
+//  isel.c
+//  tinycc
+//
+//  Created by sanluisrey on 2026/10/19.
+//
+
+#include "tinycc.h"
+
+// SSA形式の三番地コード(ir.c)からの命令選択とレジスタ割り当て
+//
+// 命令に出力順の位置を振ってブロックの入口と出口で生きている値を求め、値ごとの生存区間
+// (生きている位置を全て含む範囲)を線形走査してレジスタを割り当てる。関数呼び出しをまたぐ値は
+// callee-savedレジスタに置き、レジスタが足りなければ区間の終わりが最も遠い値をスタックに置く。
+// φ関数は先行ブロックの末尾での並列代入にし、φ関数と被演算子には同じレジスタを選びやすくする。
+// rax, rdx, r11は命令選択の作業用に使い、値には割り当てない。
+
+// 値に割り当てるレジスタ(IR.regで番号を指定)。1からNCALLEE_REGSまではcallee-saved
+static char *REGS[] = {NULL, "rbx", "r12", "r13", "r14", "r15", "rdi", "rsi", "rcx", "r8", "r9", "r10"};
+static char *REGS32[] = {NULL, "ebx", "r12d", "r13d", "r14d", "r15d", "edi", "esi", "ecx", "r8d", "r9d", "r10d"};
+static char *REGS8[] = {NULL, "bl", "r12b", "r13b", "r14b", "r15b", "dil", "sil", "cl", "r8b", "r9b", "r10b"};
+#define NREGS 11
+// 関数呼び出しの引数に用いるレジスタと、その番号(rdxは割り当てに使わないので0)
+static char *ARGREGS[] = {"rdi", "rsi", "rdx", "rcx", "r8", "r9"};
+static int ARGREG_NUM[] = {6, 7, 0, 8, 9, 10};
+
+// 生成中の関数
+static Function *fn;
+// ブロックの入口と出口の位置
+static int *block_start, *block_end;
+// 番号ごとの値
+static IR **values;
+// 値ごとの生存区間 [lo, hi] (使われない値はhi < 0)
+static int *lo, *hi;
+// 関数呼び出しの位置
+static int *calls;
+static int ncalls;
+// 退避したcallee-savedレジスタ
+static bool saved[NCALLEE_REGS + 1];
+static int nsaved;
+// フレームポインタを使わない関数(葉関数と-fomit-frame-pointer)かどうか
+static bool frameless;
+// フレームポインタを使わないときにプロローグで確保した大きさと、関数呼び出しのために積んだ大きさ
+static int frame_extra, stackpos;
+// スタックに置いた値の数
+static int nspills;
+
+// ブロックの集合を表すビット列
+typedef unsigned long Bits;
+static int nwords;
+
+static bool has_bit(Bits *s, int i) {
+    return (s[i / 64] >> (i % 64)) & 1;
+}
+
+static void set_bit(Bits *s, int i) {
+    s[i / 64] |= 1UL << (i % 64);
+}
+
+static void clear_bit(Bits *s, int i) {
+    s[i / 64] &= ~(1UL << (i % 64));
+}
+
+// 命令が値を定義するかどうか
+static bool defines(IR *ir) {
+    switch (ir->op) {
+        case IR_STORE:
+        case IR_RMW:
+        case IR_BR:
+        case IR_JMP:
+        case IR_SWITCH:
+        case IR_RET:
+        case IR_TAILCALL:
+            return false;
+    }
+    return true;
+}
+
+// レジスタかスタックに置く値(定数は命令の即値にする)かどうか
+static bool is_value(IR *v) {
+    return v != NULL && v->op != IR_IMM;
+}
+
+// 値を定義する位置。φ関数と仮引数はブロックの入口で定義する
+static int def_pos(IR *ir) {
+    if (ir->op == IR_PHI || ir->op == IR_PARAM) return block_start[ir->block->id];
+    return ir->pos + 1;
+}
+
+// sの先行ブロックの中でのbの位置
+static int pred_index(Block *s, Block *b) {
+    for (int i = 0; i < s->npreds; i++) {
+        if (s->preds[i] == b) return i;
+    }
+    error("先行ブロックではありません。");
+    return -1;
+}
+
+// 命令に位置を振る。命令は位置で被演算子を使い、位置+1で値を定義する。
+static void number(void) {
+    int pos = 0;
+    ncalls = 0;
+    for (int i = 0; i < fn->nblocks; i++) {
+        Block *b = fn->blocks[i];
+        block_start[i] = pos;
+        pos += 2;
+        for (IR *ir = b->first; ir; ir = ir->next) {
+            if (ir->op == IR_PHI || ir->op == IR_PARAM) continue;
+            ir->pos = pos;
+            pos += 2;
+            if (ir->op == IR_CALL) {
+                calls = realloc(calls, (ncalls + 1) * sizeof(int));
+                calls[ncalls++] = ir->pos;
+            }
+        }
+        block_end[i] = pos;
+        pos += 2;
+    }
+}
+
+static void extend(IR *v, int pos) {
+    if (pos < lo[v->id]) lo[v->id] = pos;
+    if (pos > hi[v->id]) hi[v->id] = pos;
+}
+
+// ブロックの出口で生きている値を求める。φ関数の被演算子は先行ブロックの出口で使う。
+static void live_out(Block *b, Bits **live_in, Bits *out) {
+    memset(out, 0, nwords * sizeof(Bits));
+    for (int k = 0; k < b->nsuccs; k++) {
+        Block *s = b->succs[k];
+        for (int w = 0; w < nwords; w++) {
+            out[w] |= live_in[s->id][w];
+        }
+        int j = pred_index(s, b);
+        for (IR *ir = s->first; ir && ir->op == IR_PHI; ir = ir->next) {
+            if (is_value(ir->ops[j])) set_bit(out, ir->ops[j]->id);
+        }
+    }
+}
+
+// ブロックの入口と出口で生きている値を求め、値ごとの生存区間を求める。
+static void live_intervals(void) {
+    int n = fn->nvalues;
+    nwords = (n + 63) / 64;
+    Bits **live_in = calloc(fn->nblocks, sizeof(Bits *));
+    for (int i = 0; i < fn->nblocks; i++) {
+        live_in[i] = calloc(nwords + 1, sizeof(Bits));
+    }
+    Bits *live = calloc(nwords + 1, sizeof(Bits));
+    for (bool changed = true; changed; ) {
+        changed = false;
+        for (int i = fn->nblocks - 1; i >= 0; i--) {
+            Block *b = fn->blocks[i];
+            live_out(b, live_in, live);
+            for (IR *ir = b->last; ir; ir = ir->prev) {
+                if (defines(ir)) clear_bit(live, ir->id);
+                if (ir->op == IR_PHI) continue;
+                for (int j = 0; j < ir->nops; j++) {
+                    if (is_value(ir->ops[j])) set_bit(live, ir->ops[j]->id);
+                }
+            }
+            if (memcmp(live, live_in[i], nwords * sizeof(Bits)) != 0) {
+                memcpy(live_in[i], live, nwords * sizeof(Bits));
+                changed = true;
+            }
+        }
+    }
+
+    for (int i = 0; i < n; i++) {
+        lo[i] = 1 << 30;
+        hi[i] = -1;
+    }
+    for (int i = 0; i < fn->nblocks; i++) {
+        Block *b = fn->blocks[i];
+        for (IR *ir = b->first; ir; ir = ir->next) {
+            if (ir->op == IR_PHI) {
+                for (int j = 0; j < ir->nops; j++) {
+                    if (is_value(ir->ops[j])) extend(ir->ops[j], block_end[b->preds[j]->id]);
+                }
+                continue;
+            }
+            for (int j = 0; j < ir->nops; j++) {
+                if (is_value(ir->ops[j])) extend(ir->ops[j], ir->pos);
+            }
+        }
+    }
+    // 区間をブロックの入口と出口で生きている位置まで広げる
+    for (int i = 0; i < fn->nblocks; i++) {
+        live_out(fn->blocks[i], live_in, live);
+        for (int id = 0; id < n; id++) {
+            if (values[id] == NULL) continue;
+            if (has_bit(live_in[i], id)) extend(values[id], block_start[i]);
+            if (has_bit(live, id)) extend(values[id], block_end[i]);
+        }
+    }
+    // 定義の位置を含める(使われない値はhi < 0のまま)
+    for (int i = 0; i < fn->nblocks; i++) {
+        for (IR *ir = fn->blocks[i]->first; ir; ir = ir->next) {
+            if (defines(ir) && hi[ir->id] >= 0) extend(ir, def_pos(ir));
+        }
+    }
+    for (int i = 0; i < fn->nblocks; i++) {
+        free(live_in[i]);
+    }
+    free(live_in);
+    free(live);
+}
+
+// 区間が関数呼び出しをまたぐかどうか
+static bool crosses_call(IR *v) {
+    for (int i = 0; i < ncalls; i++) {
+        if (lo[v->id] < calls[i] && calls[i] < hi[v->id]) return true;
+    }
+    return false;
+}
+
+static int by_start(const void *x, const void *y) {
+    IR *a = *(IR **) x, *b = *(IR **) y;
+    if (lo[a->id] != lo[b->id]) return lo[a->id] < lo[b->id] ? -1 : 1;
+    return a->id - b->id;
+}
+
+// 値に使いたいレジスタを優先順にoutに置き、その数を返す。φ関数と被演算子、命令の結果と
+// 最後に使う被演算子、仮引数と引数のレジスタが同じなら値を移さずに済む。
+static int hints(IR *v, IR **phi_use, int *out) {
+    int n = 0;
+    if (v->op == IR_PARAM && v->val < 6) out[n++] = ARGREG_NUM[v->val];
+    if (v->op == IR_PHI) {
+        for (int i = 0; i < v->nops && n < 8; i++) {
+            if (is_value(v->ops[i]) && v->ops[i]->reg) out[n++] = v->ops[i]->reg;
+        }
+    } else if (v->op != IR_PARAM && v->op != IR_CALL) {
+        for (int i = 0; i < v->nops && i < 2; i++) {
+            IR *op = v->ops[i];
+            if (is_value(op) && op->reg && hi[op->id] <= v->pos) out[n++] = op->reg;
+        }
+    }
+    if (phi_use[v->id] && phi_use[v->id]->reg) out[n++] = phi_use[v->id]->reg;
+    return n;
+}
+
+// 線形走査でレジスタを割り当てる。割り当てられなかった値はslotを1にしておく。
+static void allocate(void) {
+    IR **order = calloc(fn->nvalues + 1, sizeof(IR *));
+    IR **phi_use = calloc(fn->nvalues + 1, sizeof(IR *));
+    IR **active = calloc(NREGS + 1, sizeof(IR *));
+    int n = 0, nactive = 0;
+    for (int i = 0; i < fn->nvalues; i++) {
+        IR *v = values[i];
+        if (v == NULL || !defines(v) || hi[i] < 0) continue;
+        order[n++] = v;
+        if (v->op == IR_PHI) {
+            for (int j = 0; j < v->nops; j++) {
+                if (is_value(v->ops[j])) phi_use[v->ops[j]->id] = v;
+            }
+        }
+    }
+    qsort(order, n, sizeof(IR *), by_start);
+
+    for (int i = 0; i < n; i++) {
+        IR *v = order[i];
+        // -fno-mem2regでは全ての値をスタックに置く
+        if (!optimizing(P_MEM2REG)) {
+            v->slot = 1;
+            nspills++;
+            continue;
+        }
+        // 終わった区間のレジスタを空ける
+        for (int j = 0; j < nactive; ) {
+            if (hi[active[j]->id] < lo[v->id]) {
+                active[j] = active[--nactive];
+            } else {
+                j++;
+            }
+        }
+        bool taken[NREGS + 1] = {false};
+        for (int j = 0; j < nactive; j++) {
+            taken[active[j]->reg] = true;
+        }
+        // 呼び出しをまたぐ値はcallee-savedだけ、またがない値はcaller-savedを先に使う
+        int limit = crosses_call(v) ? NCALLEE_REGS : NREGS;
+        int reg = 0;
+        int hint[12];
+        int nhints = hints(v, phi_use, hint);
+        for (int k = 0; reg == 0 && k < nhints; k++) {
+            if (hint[k] > 0 && hint[k] <= limit && !taken[hint[k]]) reg = hint[k];
+        }
+        for (int r = NCALLEE_REGS + 1; reg == 0 && r <= limit; r++) {
+            if (!taken[r]) reg = r;
+        }
+        for (int r = 1; reg == 0 && r <= NCALLEE_REGS; r++) {
+            if (!taken[r]) reg = r;
+        }
+        if (reg == 0) {
+            // 区間の終わりが最も遠い値をスタックに置く
+            int far = -1;
+            for (int j = 0; j < nactive; j++) {
+                if (active[j]->reg <= limit && (far < 0 || hi[active[j]->id] > hi[active[far]->id])) far = j;
+            }
+            if (far < 0 || hi[active[far]->id] <= hi[v->id]) {
+                v->slot = 1;
+                nspills++;
+                continue;
+            }
+            reg = active[far]->reg;
+            active[far]->reg = 0;
+            active[far]->slot = 1;
+            nspills++;
+            active[far] = active[--nactive];
+        }
+        v->reg = reg;
+        active[nactive++] = v;
+    }
+    for (int i = 0; i < n; i++) {
+        if (order[i]->reg && order[i]->reg <= NCALLEE_REGS) saved[order[i]->reg] = true;
+    }
+    free(order);
+    free(phi_use);
+    free(active);
+}
+
+// 仮引数の番号(仮引数でなければ-1)
+static int param_index(Var *var) {
+    for (int i = 0; i < fn->nparams; i++) {
+        if (fn->params[i] == var) return i;
+    }
+    return -1;
+}
+
+// 7個目以降の仮引数の位置(呼び出し元が積んだ戻り番地の上)
+static int stack_param(int i) {
+    return (frameless ? 8 : 16) + 8 * (i - 6);
+}
+
+// 命令が参照するメモリ上の変数とスタックに置いた値をフレームに配置し、退避したレジスタを含む
+// フレームの大きさを返す。スタックで渡された仮引数は呼び出し元のフレームにあるものを使う。
+// -fstack-reuseでは生存区間の重ならない値に同じ位置を使う。
+static int layout_frame(void) {
+    bool *used = calloc(fn->nvars + 1, sizeof(bool));
+    bool any = false;
+    for (int i = 0; i < fn->nblocks; i++) {
+        for (IR *ir = fn->blocks[i]->first; ir; ir = ir->next) {
+            if (ir->op != IR_PHI && ir->var) {
+                used[ir->var->index] = true;
+                any = true;
+            }
+        }
+    }
+    frameless = optimizing(P_OMITFP) || (optimizing(P_LEAFFRAME) && !any && nspills == 0 && ncalls == 0);
+
+    int size = nsaved * 8;
+    for (int align = 8; align >= 1; align /= 2) {
+        for (int i = 0; i < fn->nvars; i++) {
+            Var *var = fn->vars[i];
+            if (!used[i] || align_of(var->type) != align) continue;
+            int p = param_index(var);
+            if (p >= 6) {
+                var->offset = -stack_param(p);
+                continue;
+            }
+            size = roundup(size + var->type->size, align);
+            var->offset = size;
+        }
+    }
+    size = roundup(size, 8);
+    IR **spilled = calloc(nspills + 1, sizeof(IR *));
+    int n = 0;
+    for (int i = 0; i < fn->nvalues; i++) {
+        IR *v = values[i];
+        if (v == NULL || v->slot == 0) continue;
+        if (v->op == IR_PARAM && v->val >= 6) {
+            v->slot = stack_param(v->val);
+        } else {
+            spilled[n++] = v;
+        }
+    }
+    qsort(spilled, n, sizeof(IR *), by_start);
+    // 位置ごとに最後に置いた値
+    IR **last = calloc(n + 1, sizeof(IR *));
+    int nslots = 0;
+    for (int i = 0; i < n; i++) {
+        IR *v = spilled[i];
+        int s = nslots;
+        for (int j = 0; optimizing(P_STACKREUSE) && j < nslots; j++) {
+            if (hi[last[j]->id] < lo[v->id]) {
+                s = j;
+                break;
+            }
+        }
+        if (s == nslots) nslots++;
+        v->slot = -(size + 8 * (s + 1));
+        last[s] = v;
+    }
+    if (nslots < n) opt_report(P_STACKREUSE, "%s: %d -> %d bytes", fn->name, size + 8 * n, size + 8 * nslots);
+    size += 8 * nslots;
+    free(used);
+    free(spilled);
+    free(last);
+    return size;
+}
+
+// フレームの基点(rbpの指す位置)からdisp離れた位置。indexがあればそのレジスタをscale倍して加える。
+// フレームポインタを使わないときはrsp相対にするので、出力する直前のstackposで求めること。
+static char *frame_addr(int disp, char *index, int scale) {
+    char *buf = calloc(1, 64);
+    char *base = "rbp";
+    if (frameless) {
+        base = "rsp";
+        disp += nsaved * 8 + frame_extra + stackpos;
+    }
+    char d[16] = "";
+    if (disp) sprintf(d, "%+d", disp);
+    if (index) {
+        sprintf(buf, "[%s+%s*%d%s]", base, index, scale, d);
+    } else {
+        sprintf(buf, "[%s%s]", base, d);
+    }
+    return buf;
+}
+
+static char *slot_ref(char *size, int disp) {
+    char *buf = calloc(1, 80);
+    sprintf(buf, "%s PTR %s", size, frame_addr(disp, NULL, 0));
+    return buf;
+}
+
+static char *imm_str(long val) {
+    char *buf = calloc(1, 24);
+    sprintf(buf, "%ld", val);
+    return buf;
+}
+
+// 値の64ビットのオペランド(レジスタ、スタック上の位置、即値)
+static char *loc(IR *v) {
+    if (v->op == IR_IMM) return imm_str(v->val);
+    if (v->reg) return REGS[v->reg];
+    return slot_ref("QWORD", v->slot);
+}
+
+// 値の下位32ビットのオペランド
+static char *loc32(IR *v) {
+    if (v->op == IR_IMM) return imm_str(v->val);
+    if (v->reg) return REGS32[v->reg];
+    return slot_ref("DWORD", v->slot);
+}
+
+// typeの大きさのオペランド
+static char *part(IR *v, Type *type) {
+    if (type->ty == CHAR) {
+        if (v->op == IR_IMM) return imm_str((signed char) v->val);
+        if (v->reg) return REGS8[v->reg];
+        return slot_ref("BYTE", v->slot);
+    }
+    if (type->ty == INT) return loc32(v);
+    return loc(v);
+}
+
+static bool in_mem(IR *v) {
+    return v->op != IR_IMM && v->reg == 0;
+}
+
+// 値をレジスタで使う。レジスタになければscratchに読み込む。
+static char *in_reg(IR *v, char *scratch) {
+    if (v->op != IR_IMM && v->reg) return REGS[v->reg];
+    emit("    mov %s, %s\n", scratch, loc(v));
+    return scratch;
+}
+
+// 値のオペランド。定数を即値にしなければ(-fno-imm)scratchに読み込む。
+static char *operand(IR *v, char *scratch) {
+    if (v->op == IR_IMM && !optimizing(P_IMM)) return in_reg(v, scratch);
+    return loc(v);
+}
+
+// 命令の結果を置くレジスタ。スタックに置く値はraxで計算してからstore_resultで書き込む。
+static char *result(IR *v) {
+    return v->reg ? REGS[v->reg] : "rax";
+}
+
+static void store_result(IR *v) {
+    if (!v->reg && v->slot) emit("    mov %s, rax\n", loc(v));
+}
+
+// 命令が参照するメモリの番地 "[...]"。ベースはrax、インデックスはrdxを作業用に使う。
+// アドレッシングモードを使わなければ(-fno-addr-mode)番地をraxに計算する。
+static char *addr(IR *ir) {
+    int disp = ir->disp;
+    IR *ix = ir->ops[1];
+    if (ix && ix->op == IR_IMM) {
+        disp += ix->val * ir->scale;
+        ix = NULL;
+    }
+    if (!optimizing(P_ADDRMODE)) {
+        if (ir->var) {
+            emit("    lea rax, %s\n", frame_addr(-ir->var->offset, NULL, 0));
+        } else if (ir->sym) {
+            emit("    lea rax, [rip+%s]\n", ir->sym);
+        } else {
+            emit("    mov rax, %s\n", loc(ir->ops[0]));
+        }
+        if (ix) {
+            emit("    mov rdx, %s\n", loc(ix));
+            if (ir->scale != 1) emit("    imul rdx, rdx, %d\n", ir->scale);
+            emit("    add rax, rdx\n");
+        }
+        if (disp) emit("    add rax, %d\n", disp);
+        return "[rax]";
+    }
+    char *index = ix ? in_reg(ix, "rdx") : NULL;
+    if (ir->var) return frame_addr(disp - ir->var->offset, index, ir->scale);
+    char *buf = calloc(1, 64);
+    char d[16] = "";
+    if (disp) sprintf(d, "%+d", disp);
+    char *base;
+    if (ir->sym) {
+        if (index == NULL) {
+            sprintf(buf, "[rip+%s%s]", ir->sym, d);
+            return buf;
+        }
+        emit("    lea rax, [rip+%s]\n", ir->sym);
+        base = "rax";
+    } else {
+        base = in_reg(ir->ops[0], "rax");
+    }
+    if (index) {
+        sprintf(buf, "[%s+%s*%d%s]", base, index, ir->scale, d);
+    } else {
+        sprintf(buf, "[%s%s]", base, d);
+    }
+    return buf;
+}
+
+// 命令のメモリオペランド
+static char *mem(IR *ir, char *size) {
+    char *a = addr(ir);
+    char *buf = calloc(1, strlen(size) + strlen(a) + 8);
+    sprintf(buf, "%s PTR %s", size, a);
+    return buf;
+}
+
+static char *size_of(Type *type) {
+    if (type->ty == CHAR) return "BYTE";
+    if (type->ty == INT) return "DWORD";
+    return "QWORD";
+}
+
+// 比較の種類の条件コード
+static char *cond(IROp cmp, bool when) {
+    switch (cmp) {
+        case IR_EQ: return when ? "e" : "ne";
+        case IR_NE: return when ? "ne" : "e";
+        case IR_GT: return when ? "g" : "le";
+        case IR_GE: return when ? "ge" : "l";
+        case IR_LT: return when ? "l" : "ge";
+        case IR_LE: return when ? "le" : "g";
+    }
+    error("比較ではありません。");
+    return NULL;
+}
+
+// 被演算子を入れ替えた比較
+static IROp mirror(IROp cmp) {
+    switch (cmp) {
+        case IR_GT: return IR_LT;
+        case IR_GE: return IR_LE;
+        case IR_LT: return IR_GT;
+        case IR_LE: return IR_GE;
+    }
+    return cmp;
+}
+
+// aとbを比較してフラグを立て、フラグで判定する比較の種類を返す。
+// 両方ともスタック上にあればaをscratchに読み込む。-fno-immでは定数のbをr11に読み込む。
+static IROp gen_cmp(IROp cmp, IR *a, IR *b, char *scratch) {
+    if (a->op == IR_IMM) {
+        IR *t = a;
+        a = b;
+        b = t;
+        cmp = mirror(cmp);
+    }
+    if (optimizing(P_IMM) && b->op == IR_IMM && b->val == 0 && a->reg) {
+        emit("    test %s, %s\n", REGS[a->reg], REGS[a->reg]);
+    } else if (a->op == IR_IMM || (in_mem(a) && in_mem(b))) {
+        char *r = in_reg(a, scratch);
+        emit("    cmp %s, %s\n", r, operand(b, "r11"));
+    } else {
+        emit("    cmp %s, %s\n", loc(a), operand(b, "r11"));
+    }
+    return cmp;
+}
+
+static char *binary_op(IROp op) {
+    switch (op) {
+        case IR_ADD: return "add";
+        case IR_SUB: return "sub";
+        case IR_MUL: return "imul";
+    }
+    error("二項演算ではありません。");
+    return NULL;
+}
+
+static void gen_binary(IR *ir) {
+    IR *a = ir->ops[0], *b = ir->ops[1];
+    bool commutative = ir->op != IR_SUB;
+    if (commutative && a->op == IR_IMM) {
+        IR *t = a;
+        a = b;
+        b = t;
+    }
+    char *d = result(ir);
+    if (optimizing(P_IMM) && b->op == IR_IMM && a->op != IR_IMM) {
+        int val = b->val;
+        if (ir->op == IR_MUL) {
+            if (a->reg && (val == 3 || val == 5 || val == 9)) {
+                emit("    lea %s, [%s+%s*%d]\n", d, REGS[a->reg], REGS[a->reg], val - 1);
+            } else {
+                emit("    imul %s, %s, %d\n", d, loc(a), val);
+            }
+            store_result(ir);
+            return;
+        }
+        if (ir->op == IR_SUB && val != -2147483647 - 1) val = -val;
+        if (ir->op == IR_ADD || val != b->val) {
+            if (a->reg && a->reg != ir->reg) {
+                emit("    lea %s, [%s%+d]\n", d, REGS[a->reg], val);
+            } else {
+                if (!a->reg || a->reg != ir->reg) emit("    mov %s, %s\n", d, loc(a));
+                if (val < 0 && val != -2147483647 - 1) {
+                    emit("    sub %s, %d\n", d, -val);
+                } else {
+                    emit("    add %s, %d\n", d, val);
+                }
+            }
+            store_result(ir);
+            return;
+        }
+    }
+    if (commutative && ir->reg && b->op != IR_IMM && b->reg == ir->reg) {
+        IR *t = a;
+        a = b;
+        b = t;
+    }
+    if (ir->reg && b->op != IR_IMM && b->reg == ir->reg && a != b) d = "rax";
+    if (a->op == IR_IMM || a->reg != ir->reg || !ir->reg) emit("    mov %s, %s\n", d, loc(a));
+    emit("    %s %s, %s\n", binary_op(ir->op), d, operand(b, "r11"));
+    if (ir->reg && strcmp(d, "rax") == 0) {
+        emit("    mov %s, rax\n", REGS[ir->reg]);
+    } else {
+        store_result(ir);
+    }
+}
+
+// int, charの定数による除算・剰余(gen_divconstと同じ)。扱えなければfalseを返す。
+static bool gen_divconst(IR *ir) {
+    IR *b = ir->ops[1];
+    if (!optimizing(P_DIVCONST) || !iscint(ir->type) || b->op != IR_IMM) return false;
+    int d = b->val;
+    if (d == 0 || d == -2147483647 - 1) return false;
+    emit("    mov rax, %s\n", loc(ir->ops[0]));
+    if (ir->op == IR_MOD && (d == 1 || d == -1)) {
+        emit("    xor eax, eax\n");
+    } else if (d == -1) {
+        emit("    neg eax\n");
+        emit("    movsxd rax, eax\n");
+    } else if (ir->op == IR_DIV) {
+        if (d != 1) gen_quotient(d, "rdx");
+    } else {
+        emit("    mov r11, rax\n");
+        gen_quotient(d, "rdx");
+        emit("    imul rax, rax, %d\n", d);
+        emit("    sub r11, rax\n");
+        emit("    mov rax, r11\n");
+    }
+    if (ir->reg) emit("    mov %s, rax\n", REGS[ir->reg]);
+    store_result(ir);
+    return true;
+}
+
+static void gen_div(IR *ir) {
+    if (gen_divconst(ir)) return;
+    IR *a = ir->ops[0], *b = ir->ops[1];
+    bool narrow = iscint(ir->type);
+    char *divisor;
+    if (b->op == IR_IMM) {
+        emit("    mov r11, %d\n", b->val);
+        divisor = narrow ? "r11d" : "r11";
+    } else {
+        divisor = narrow ? loc32(b) : loc(b);
+    }
+    emit("    mov rax, %s\n", loc(a));
+    if (narrow) {
+        emit("    cdq\n");
+        emit("    idiv %s\n", divisor);
+        emit("    movsxd %s, %s\n", result(ir), ir->op == IR_DIV ? "eax" : "edx");
+    } else {
+        emit("    cqo\n");
+        emit("    idiv %s\n", divisor);
+        if (ir->op == IR_MOD) emit("    mov rax, rdx\n");
+        if (ir->reg) emit("    mov %s, rax\n", REGS[ir->reg]);
+    }
+    store_result(ir);
+}
+
+static void gen_ext(IR *ir) {
+    IR *a = ir->ops[0];
+    if (a->op == IR_IMM) {
+        int val = ir->type->ty == CHAR ? (signed char) a->val : a->val;
+        emit("    mov %s, %d\n", result(ir), val);
+    } else if (ir->type->ty == CHAR) {
+        emit("    movsx %s, %s\n", result(ir), part(a, ir->type));
+    } else {
+        emit("    movsxd %s, %s\n", result(ir), part(a, ir->type));
+    }
+    store_result(ir);
+}
+
+static void gen_load(IR *ir) {
+    char *m = mem(ir, size_of(ir->type));
+    if (ir->type->ty == CHAR) {
+        emit("    movsx %s, %s\n", result(ir), m);
+    } else if (ir->type->ty == INT) {
+        emit("    movsxd %s, %s\n", result(ir), m);
+    } else {
+        emit("    mov %s, %s\n", result(ir), m);
+    }
+    store_result(ir);
+}
+
+// メモリへの書き込みと直接の増減。書き込む値はr11を作業用に使う。
+static void gen_store(IR *ir) {
+    IR *v = ir->ops[2];
+    char *val;
+    if ((v->op == IR_IMM && optimizing(P_IMM)) || v->reg) {
+        val = part(v, ir->type);
+    } else {
+        emit("    mov r11, %s\n", loc(v));
+        val = ir->type->ty == CHAR ? "r11b" : ir->type->ty == INT ? "r11d" : "r11";
+    }
+    char *m = mem(ir, size_of(ir->type));
+    if (ir->op == IR_STORE) {
+        emit("    mov %s, %s\n", m, val);
+    } else if (v->op == IR_IMM && optimizing(P_IMM) && (v->val == 1 || v->val == -1)) {
+        emit("    %s %s\n", (v->val == 1) == (ir->cmp == IR_ADD) ? "inc" : "dec", m);
+    } else {
+        emit("    %s %s, %s\n", ir->cmp == IR_ADD ? "add" : "sub", m, val);
+    }
+}
+
+// 比較してから選ぶ値を読み込む(movはフラグを変えない)。
+static void gen_select(IR *ir) {
+    IR *t = ir->ops[2], *f = ir->ops[3];
+    IROp cmp = gen_cmp(ir->cmp, ir->ops[0], ir->ops[1], "rax");
+    char *tv = t->op == IR_IMM ? in_reg(t, "r11") : loc(t);
+    emit("    mov rax, %s\n", loc(f));
+    emit("    cmov%s rax, %s\n", cond(cmp, true), tv);
+    if (ir->reg) emit("    mov %s, rax\n", REGS[ir->reg]);
+    store_result(ir);
+}
+
+static void push_value(IR *v) {
+    emit("    push %s\n", operand(v, "r11"));
+    stackpos += 8;
+}
+
+// 引数を規約の位置に置く。7番目以降の引数は後ろからスタックに積み、積んだ大きさを返す。
+// -fno-arg-regsではレジスタで渡す引数も順にスタックに積んでから引数レジスタに降ろす。
+static int gen_args(IR *ir) {
+    int nstack = ir->nops > 6 ? ir->nops - 6 : 0;
+    int pad = nstack % 2 ? 8 : 0;
+    if (pad) emit("    sub rsp, 8\n");
+    stackpos += pad;
+    for (int i = ir->nops - 1; i >= 6; i--) {
+        push_value(ir->ops[i]);
+    }
+    int n = ir->nops < 6 ? ir->nops : 6;
+    if (!optimizing(P_ARGREGS)) {
+        for (int i = 0; i < n; i++) {
+            push_value(ir->ops[i]);
+        }
+        for (int i = n - 1; i >= 0; i--) {
+            emit("    pop %s\n", ARGREGS[i]);
+            stackpos -= 8;
+        }
+        return pad + nstack * 8;
+    }
+    char *dst[6], *src[6];
+    for (int i = 0; i < n; i++) {
+        dst[i] = ARGREGS[i];
+        src[i] = loc(ir->ops[i]);
+    }
+    parallel_move(dst, src, n);
+    return pad + nstack * 8;
+}
+
+static void gen_call(IR *ir) {
+    int size = gen_args(ir);
+    emit("    call %s\n", ir->name);
+    if (size) emit("    add rsp, %d\n", size);
+    stackpos -= size;
+    if (ir->reg) emit("    mov %s, rax\n", REGS[ir->reg]);
+    store_result(ir);
+}
+
+// 退避したレジスタとフレームを戻す。
+static void gen_epilogue(void) {
+    if (frameless) {
+        if (frame_extra) emit("    add rsp, %d\n", frame_extra);
+        for (int r = NCALLEE_REGS; r >= 1; r--) {
+            if (saved[r]) emit("    pop %s\n", REGS[r]);
+        }
+        return;
+    }
+    if (nsaved) {
+        emit("    lea rsp, [rbp-%d]\n", nsaved * 8);
+        for (int r = NCALLEE_REGS; r >= 1; r--) {
+            if (saved[r]) emit("    pop %s\n", REGS[r]);
+        }
+    } else {
+        emit("    mov rsp, rbp\n");
+    }
+    emit("    pop rbp\n");
+}
+
+// ブロックbからsへ移るときのφ関数の並列代入。n個の代入をdst, srcに置き、その数を返す。
+static int phi_moves(Block *b, Block *s, char **dst, char **src) {
+    int j = pred_index(s, b), n = 0;
+    for (IR *phi = s->first; phi && phi->op == IR_PHI; phi = phi->next) {
+        if (!phi->reg && !phi->slot) continue;
+        char *d = loc(phi), *v = loc(phi->ops[j]);
+        if (strcmp(d, v) == 0) continue;
+        dst[n] = d;
+        src[n++] = v;
+    }
+    return n;
+}
+
+static int nphis(Block *s) {
+    int n = 0;
+    for (IR *phi = s->first; phi && phi->op == IR_PHI; phi = phi->next) {
+        n++;
+    }
+    return n;
+}
+
+// 分岐するだけで値を移さないブロックは出力せず、分岐元から直接その先へ分岐する。
+static bool bypassed(Block *b) {
+    if (b->id == 0 || b->first != b->last || b->first->op != IR_JMP) return false;
+    for (int i = 0; i < b->npreds; i++) {
+        if (b->preds[i]->last->op == IR_SWITCH) return false;
+    }
+    Block *s = b->succs[0];
+    if (s == b) return false;
+    char **dst = calloc(nphis(s) + 1, sizeof(char *)), **src = calloc(nphis(s) + 1, sizeof(char *));
+    int n = phi_moves(b, s, dst, src);
+    free(dst);
+    free(src);
+    return n == 0;
+}
+
+// 分岐先のブロックのラベル
+static char *target(Block *b) {
+    for (int i = 0; i < fn->nblocks && bypassed(b); i++) {
+        b = b->succs[0];
+    }
+    return b->label;
+}
+
+// 次に出力するブロックのラベル(なければNULL)
+static char *next_label(Block *b) {
+    for (int i = b->id + 1; i < fn->nblocks; i++) {
+        if (!bypassed(fn->blocks[i])) return fn->blocks[i]->label;
+    }
+    return NULL;
+}
+
+static void gen_jump(char *label, Block *b) {
+    char *next = next_label(b);
+    if (next == NULL || strcmp(label, next) != 0) emit("    jmp %s\n", label);
+}
+
+static void gen_branch(IR *ir, Block *b) {
+    IROp cmp = gen_cmp(ir->cmp, ir->ops[0], ir->ops[1], "rax");
+    char *t = target(b->succs[0]), *f = target(b->succs[1]);
+    char *next = next_label(b);
+    if (next && strcmp(f, next) == 0) {
+        emit("    j%s %s\n", cond(cmp, true), t);
+    } else if (next && strcmp(t, next) == 0) {
+        emit("    j%s %s\n", cond(cmp, false), f);
+    } else {
+        emit("    j%s %s\n", cond(cmp, true), t);
+        emit("    jmp %s\n", f);
+    }
+}
+
+static void gen_insn(IR *ir, Block *b) {
+    switch (ir->op) {
+        case IR_PARAM:
+        case IR_PHI:
+            return;
+        case IR_ADD:
+        case IR_SUB:
+        case IR_MUL:
+            gen_binary(ir);
+            return;
+        case IR_DIV:
+        case IR_MOD:
+            gen_div(ir);
+            return;
+        case IR_SHL:
+            if (!ir->reg || ir->ops[0]->op == IR_IMM || ir->ops[0]->reg != ir->reg) {
+                emit("    mov %s, %s\n", result(ir), loc(ir->ops[0]));
+            }
+            emit("    shl %s, %d\n", result(ir), ir->ops[1]->val);
+            store_result(ir);
+            return;
+        case IR_NEG:
+            if (!ir->reg || ir->ops[0]->op == IR_IMM || ir->ops[0]->reg != ir->reg) {
+                emit("    mov %s, %s\n", result(ir), loc(ir->ops[0]));
+            }
+            emit("    neg %s\n", result(ir));
+            store_result(ir);
+            return;
+        case IR_EQ:
+        case IR_NE:
+        case IR_GT:
+        case IR_GE:
+        case IR_LT:
+        case IR_LE: {
+            IROp cmp = gen_cmp(ir->op, ir->ops[0], ir->ops[1], "rax");
+            emit("    set%s al\n", cond(cmp, true));
+            emit("    movzx %s, al\n", ir->reg ? REGS32[ir->reg] : "eax");
+            store_result(ir);
+            return;
+        }
+        case IR_EXT:
+            gen_ext(ir);
+            return;
+        case IR_LEA:
+            emit("    lea %s, %s\n", result(ir), addr(ir));
+            store_result(ir);
+            return;
+        case IR_LOAD:
+            gen_load(ir);
+            return;
+        case IR_STORE:
+        case IR_RMW:
+            gen_store(ir);
+            return;
+        case IR_CALL:
+            gen_call(ir);
+            return;
+        case IR_SELECT:
+            gen_select(ir);
+            return;
+        case IR_BR:
+            gen_branch(ir, b);
+            return;
+        case IR_JMP: {
+            Block *s = b->succs[0];
+            char **dst = calloc(nphis(s) + 1, sizeof(char *)), **src = calloc(nphis(s) + 1, sizeof(char *));
+            parallel_move(dst, src, phi_moves(b, s, dst, src));
+            gen_jump(target(s), b);
+            free(dst);
+            free(src);
+            return;
+        }
+        case IR_SWITCH:
+            emit("    mov eax, %s\n", loc32(ir->ops[0]));
+            gen_case_dispatch(fn, ir->cases, ir->ncases, b->succs[b->nsuccs - 1]->label);
+            return;
+        case IR_RET:
+            emit("    mov rax, %s\n", loc(ir->ops[0]));
+            emit("    jmp .%s.return\n", fn->name);
+            return;
+        case IR_TAILCALL:
+            gen_args(ir);
+            gen_epilogue();
+            emit("    jmp %s\n", ir->name);
+            return;
+    }
+    error("命令を選択できません。");
+}
+
+// ループの先頭(後ろのブロックから分岐してくるブロック)かどうか
+static bool loop_head(Block *b) {
+    for (int i = 0; i < b->npreds; i++) {
+        if (b->preds[i]->id >= b->id) return true;
+    }
+    return false;
+}
+
+// SSA形式に変換した関数(build_ssa)のコードを生成する。
+void gen_ir(Function *f) {
+    fn = f;
+    int n = fn->nvalues;
+    values = calloc(n + 1, sizeof(IR *));
+    lo = calloc(n + 1, sizeof(int));
+    hi = calloc(n + 1, sizeof(int));
+    block_start = calloc(fn->nblocks + 1, sizeof(int));
+    block_end = calloc(fn->nblocks + 1, sizeof(int));
+    for (int i = 0; i < fn->nblocks; i++) {
+        for (IR *ir = fn->blocks[i]->first; ir; ir = ir->next) {
+            values[ir->id] = ir;
+            ir->reg = ir->slot = 0;
+        }
+    }
+    memset(saved, 0, sizeof(saved));
+    nspills = 0;
+    number();
+    live_intervals();
+    allocate();
+    nsaved = 0;
+    for (int r = 1; r <= NCALLEE_REGS; r++) {
+        if (saved[r]) nsaved++;
+    }
+    int size = layout_frame();
+    // 関数呼び出しのためrspを16バイト境界に揃える。rbpを使わないときは戻り番地の分だけずれる
+    int frame = roundup(size, 16);
+    if (frameless) frame = ncalls == 0 ? roundup(size, 8) : roundup(size + 8, 16) - 8;
+    frame_extra = frame - nsaved * 8;
+    stackpos = 0;
+
+    if (!fn->is_static) emit(".global %s\n", fn->name);
+    emit(".text\n");
+    emit("%s:\n", fn->name);
+    if (!frameless) {
+        emit("    push rbp\n");
+        emit("    mov rbp, rsp\n");
+    }
+    for (int r = 1; r <= NCALLEE_REGS; r++) {
+        if (saved[r]) emit("    push %s\n", REGS[r]);
+    }
+    if (frame_extra) emit("    sub rsp, %d\n", frame_extra);
+    // レジスタで渡された仮引数を割り当てた位置に移し、スタックで渡された仮引数を読み込む
+    char *dst[6], *src[6];
+    int nmoves = 0;
+    Block *entry = fn->blocks[0];
+    for (IR *ir = entry->first; ir; ir = ir->next) {
+        if (ir->op == IR_PARAM && ir->val < 6 && (ir->reg || ir->slot)) {
+            dst[nmoves] = loc(ir);
+            src[nmoves++] = ARGREGS[ir->val];
+        }
+    }
+    parallel_move(dst, src, nmoves);
+    for (IR *ir = entry->first; ir; ir = ir->next) {
+        if (ir->op == IR_PARAM && ir->val >= 6 && ir->reg) {
+            emit("    mov %s, %s\n", REGS[ir->reg], slot_ref("QWORD", stack_param(ir->val)));
+        }
+    }
+
+    for (int i = 0; i < fn->nblocks; i++) {
+        Block *b = fn->blocks[i];
+        if (bypassed(b)) continue;
+        if (i > 0) {
+            if (loop_head(b) && align_loops > 1) emit("    .p2align %d\n", ilog2(align_loops));
+            emit("%s:\n", b->label);
+        }
+        for (IR *ir = b->first; ir; ir = ir->next) {
+            gen_insn(ir, b);
+        }
+    }
+
+    emit(".%s.return:\n", fn->name);
+    gen_epilogue();
+    emit("    ret\n");
+
+    int nregs = 0;
+    for (int i = 0; i < n; i++) {
+        if (values[i] && values[i]->reg) nregs++;
+    }
+    opt_report(P_SSA, "%s: %d values in registers, %d on the stack", fn->name, nregs, nspills);
+    free(values);
+    free(lo);
+    free(hi);
+    free(block_start);
+    free(block_end);
+}
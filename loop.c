@@ -0,0 +1,871 @@
+//
+//  loop.c
+//  tinycc
+//
+//  Created by sanluisrey on 2026/10/19.
+//
+
+#include "tinycc.h"
+
+// ループの最適化
+//
+// for, whileループの条件・本体・ステップで代入される変数と書き込まれるメモリを調べ、
+// 内側のループから順に次の変形を行う。計算はループの直前(プリヘッダ)に置く。
+//
+// licm: ループの中で値の変わらない式(ループ不変式)を一時変数に一度だけ計算しておく。
+//   ループが一度も回らない場合にも計算するので、例外を起こしうる式(除算や
+//   指す先の分からないポインタの参照)は移動しない。
+// ivopts: i = i + cでだけ更新される誘導変数iについて、base + i*kの形のアドレス計算を
+//   ポインタの一時変数に置き換え、iの更新の直後でc*kバイトずつ進める。
+// unroll-loops: for (i = 初期値; i < n; i = i + c)の形のループを展開する。反復回数が
+//   コンパイル時に分かって展開後が小さければ、iに定数を入れた本体を並べてループをなくす。
+//   それ以外はiにi + c, i + 2c, ...を入れた本体をN個並べてN回分ずつ進むループにし、
+//   残りの反復は元のループで行う(Nは-funroll-loops=N)。
+//
+// メモリの別名の扱いはcse.cと同じく保守的に行う。ただし書き込み先が変数や配列として
+// 分かる場合は、別の変数や配列の読み込みを変えないものとする。
+
+#define MAX_OBJS 32
+#define MAX_IVS 4   // 1つのループで強さを軽減するアドレス計算の数
+#define UNROLL_SIZE 160     // 展開後の本体の大きさの上限(ノード数)
+#define MAX_FULL_UNROLL 16  // 完全に展開する反復回数の上限
+#define MAX_LABELS 8        // 展開する本体で定義できるラベルの数
+
+typedef struct Loop Loop;
+struct Loop {
+    Node *node;             // ND_FORかND_WHILE
+    Var *vars[MAX_OBJS];    // 代入されるアドレスを取られていないローカル変数
+    int nassigns[MAX_OBJS]; // 変数ごとの代入の数
+    int nvars;
+    Node *objs[MAX_OBJS];   // 書き込まれる変数や配列(ND_LVARかND_GVAR)
+    int nobjs;
+    bool clobber;           // 関数呼び出しや書き込み先の分からない書き込みがある
+    Node *exprs[MAX_OBJS];  // 一時変数に置き換えた式
+    Var *temps[MAX_OBJS];
+    int ntemps;
+    Node pre;               // プリヘッダに置く文の連結リストの先頭
+    Node *pre_tail;
+};
+
+// アドレスが指すオブジェクト(ND_LVARかND_GVARの配列か変数)を返す。分からなければNULL
+static Node *base_object(Node *node) {
+    switch (node->kind) {
+        case ND_LVAR:
+        case ND_GVAR:
+            return isarray(node->type) ? node : NULL;
+        case ND_ADDR:
+            if (node->right->kind == ND_LVAR || node->right->kind == ND_GVAR) return node->right;
+            if (node->right->kind == ND_DEREF) return base_object(node->right->right);
+            return NULL;
+        case ND_DEREF:
+            // 配列型の*は値がアドレスそのもの
+            return isarray(node->type) ? base_object(node->right) : NULL;
+        case ND_ADD:
+        case ND_SUB:
+            return iscint(node->type) ? NULL : base_object(node->left);
+    }
+    return NULL;
+}
+
+// 左辺値や読み込みの対象のオブジェクトを返す。分からなければNULL
+static Node *mem_object(Node *node) {
+    if (node->kind == ND_DEREF) return base_object(node->right);
+    return node;
+}
+
+static bool same_object(Node *a, Node *b) {
+    if (a->kind != b->kind) return false;
+    if (a->kind == ND_LVAR) return a->var == b->var;
+    return !strcmp(a->name, b->name);
+}
+
+// ローカル変数への代入を記録する。
+static void note_assign(Loop *l, Var *var) {
+    for (int i = 0; i < l->nvars; i++) {
+        if (l->vars[i] == var) {
+            l->nassigns[i]++;
+            return;
+        }
+    }
+    if (l->nvars == MAX_OBJS) {
+        // 数えきれない場合はすべての変数が変わるものとする
+        l->clobber = true;
+        return;
+    }
+    l->vars[l->nvars] = var;
+    l->nassigns[l->nvars++] = 1;
+}
+
+// ループ内の代入と関数呼び出しを集める。
+static void scan(Node *node, int depth, void *arg) {
+    Loop *l = arg;
+    if (node->kind == ND_FUNCCALL) l->clobber = true;
+    if (node->kind != ND_ASGMT) return;
+    Node *lhs = node->left;
+    if (lhs->kind == ND_LVAR && !lhs->var->escaped) {
+        note_assign(l, lhs->var);
+        return;
+    }
+    Node *obj = mem_object(lhs);
+    if (obj == NULL || l->nobjs == MAX_OBJS) {
+        l->clobber = true;
+        return;
+    }
+    l->objs[l->nobjs++] = obj;
+}
+
+// ローカル変数がループ内で代入される回数
+static int assigns(Loop *l, Var *var) {
+    if (l->clobber && l->nvars == MAX_OBJS) return 2;
+    for (int i = 0; i < l->nvars; i++) {
+        if (l->vars[i] == var) return l->nassigns[i];
+    }
+    return 0;
+}
+
+// ループ内の書き込みや呼び出しが読み込みの値を変えうるかどうか
+static bool clobbered(Loop *l, Node *load) {
+    if (l->clobber) return true;
+    Node *obj = mem_object(load);
+    if (obj == NULL) return l->nobjs > 0;
+    for (int i = 0; i < l->nobjs; i++) {
+        if (same_object(l->objs[i], obj)) return true;
+    }
+    return false;
+}
+
+// 例外を起こさずに読めるアドレス(変数や配列の先頭から定数だけ離れた位置)かどうか
+static bool safe_addr(Node *node) {
+    switch (node->kind) {
+        case ND_LVAR:
+        case ND_GVAR:
+            return isarray(node->type);
+        case ND_ADDR:
+            return node->right->kind == ND_LVAR || node->right->kind == ND_GVAR;
+        case ND_ADD:
+            return !iscint(node->type) && node->right->kind == ND_NUM && safe_addr(node->left);
+        case ND_DEREF:
+            return isarray(node->type) && safe_addr(node->right);
+    }
+    return false;
+}
+
+// 式がループ不変で、ループの前で計算しても例外を起こさないかどうか
+static bool invariant(Node *node, Loop *l) {
+    if (node == NULL) return true;
+    switch (node->kind) {
+        case ND_NUM:
+        case ND_STR:
+            return true;
+        case ND_LVAR:
+            if (isarray(node->type)) return true;
+            if (node->var->escaped) return !clobbered(l, node);
+            return assigns(l, node->var) == 0;
+        case ND_GVAR:
+            return isarray(node->type) || !clobbered(l, node);
+        case ND_ADDR:
+            if (node->right->kind == ND_DEREF) return invariant(node->right->right, l);
+            return node->right->kind == ND_LVAR || node->right->kind == ND_GVAR;
+        case ND_DEREF:
+            if (isarray(node->type)) return invariant(node->right, l);
+            return safe_addr(node->right) && !clobbered(l, node);
+        case ND_ADD:
+        case ND_SUB:
+        case ND_MUL:
+        case ND_SHL:
+        case ND_NEG:
+        case ND_EQ:
+        case ND_NE:
+        case ND_GT:
+        case ND_GE:
+        case ND_LT:
+        case ND_LE:
+            return invariant(node->left, l) && invariant(node->right, l);
+    }
+    return false;
+}
+
+static bool is_leaf_node(Node *node) {
+    return node->kind == ND_NUM || (node->kind == ND_LVAR && !node->var->escaped && !isarray(node->type));
+}
+
+// 一時変数に置くほどの計算を含むかどうか。
+// 変数や配列のアドレス、アドレッシングモードや即値に畳み込まれる式は除く。
+static bool worth(Node *node) {
+    if (node->type == NULL) return false;
+    switch (node->kind) {
+        case ND_NUM:
+        case ND_STR:
+            return false;
+        case ND_LVAR:
+            return node->var->escaped && is_scalar(node->type);
+        case ND_GVAR:
+            return is_scalar(node->type);
+        case ND_ADDR:
+            return node->right->kind == ND_DEREF && worth(node->right->right);
+        case ND_DEREF:
+            return !isarray(node->type) || worth(node->right);
+        case ND_SHL:
+            return !is_leaf_node(node->left);
+        case ND_ADD:
+        case ND_SUB:
+            if (node->right->kind != ND_NUM) return true;
+            if (iscint(node->type)) return !is_leaf_node(node->left);
+            return worth(node->left);
+    }
+    return true;
+}
+
+static bool has_temp(Loop *l, Node *expr) {
+    for (int i = 0; i < l->ntemps; i++) {
+        if (same_node(l->exprs[i], expr)) return true;
+    }
+    return false;
+}
+
+// 式を計算する一時変数を返す。同じ式に対してはすでに作った一時変数を使い、
+// 新しく作ったときはプリヘッダに計算する文を追加する。
+static Var *temp_for(Function *fn, Loop *l, Node *expr, char *prefix) {
+    for (int i = 0; i < l->ntemps; i++) {
+        if (same_node(l->exprs[i], expr)) return l->temps[i];
+    }
+    Var *tmp = new_temp(fn, prefix, expr->type);
+    if (l->ntemps < MAX_OBJS) {
+        l->exprs[l->ntemps] = expr;
+        l->temps[l->ntemps++] = tmp;
+    }
+    Node *asgmt = new_node_binary(ND_ASGMT, tmp->type, new_node_var(tmp), expr);
+    l->pre_tail = l->pre_tail->next = new_node_expr(asgmt);
+    return tmp;
+}
+
+static void hoist(Function *fn, Loop *l, Node **ref);
+
+// 部分木の子をすべて処理する。
+static void hoist_children(Function *fn, Loop *l, Node *node) {
+    if (node->kind == ND_BLOCK) {
+        for (Node **p = &node->right; *p; p = &(*p)->next) {
+            hoist(fn, l, p);
+        }
+        return;
+    }
+    Node **kids[] = {&node->left, &node->right, &node->cond, &node->body, &node->els,
+        &node->initialization, &node->step};
+    for (int i = 0; i < (int) (sizeof(kids) / sizeof(kids[0])); i++) {
+        if (*kids[i]) hoist(fn, l, kids[i]);
+    }
+    for (int i = 0; i < node->nparams; i++) {
+        hoist(fn, l, &node->params[i]);
+    }
+}
+
+// ループ不変式を一時変数の参照に置き換える。
+static void hoist(Function *fn, Loop *l, Node **ref) {
+    Node *node = *ref;
+    switch (node->kind) {
+        case ND_ASGMT:
+            // 代入先そのものは値ではないので、アドレスの計算だけを対象にする
+            if (node->left->kind == ND_DEREF) hoist(fn, l, &node->left->right);
+            hoist(fn, l, &node->right);
+            return;
+        case ND_ADDR:
+            if (node->right->kind == ND_DEREF) hoist(fn, l, &node->right->right);
+            return;
+    }
+    if (invariant(node, l) && worth(node)) {
+        Var *tmp = temp_for(fn, l, node, "licm");
+        Node *next = node->next;
+        *ref = new_node_var(tmp);
+        (*ref)->next = next;
+        return;
+    }
+    hoist_children(fn, l, node);
+}
+
+// ループ内の代入と書き込みを調べる。
+static void analyze(Loop *l, Node *loop) {
+    memset(l, 0, sizeof(*l));
+    l->node = loop;
+    l->pre_tail = &l->pre;
+    walk(loop->cond, 0, scan, l);
+    walk(loop->body, 0, scan, l);
+    walk(loop->step, 0, scan, l);
+}
+
+// ループの前にプリヘッダの文を挿入する。forの初期化式はプリヘッダより前に出す。
+static void insert_preheader(Node **link, Loop *l) {
+    Node *loop = *link;
+    if (l->pre.next == NULL) return;
+    Node *head = l->pre.next;
+    if (loop->kind == ND_FOR && loop->initialization) {
+        Node *init = loop->initialization;
+        loop->initialization = NULL;
+        init->next = head;
+        head = init;
+    }
+    l->pre_tail->next = loop;
+    *link = head;
+}
+
+static void licm_loop(Function *fn, Node **link, int *nloops) {
+    Node *loop = *link;
+    Loop l;
+    analyze(&l, loop);
+    if (loop->cond) hoist(fn, &l, &loop->cond);
+    hoist(fn, &l, &loop->body);
+    if (loop->step) hoist(fn, &l, &loop->step);
+    ++*nloops;
+    if (l.ntemps) {
+        opt_report(P_LICM, "%s: loop %d: hoisted %d invariant expressions", fn->name, *nloops, l.ntemps);
+    }
+    insert_preheader(link, &l);
+}
+
+// 誘導変数
+typedef struct IndVar IndVar;
+struct IndVar {
+    Var *var;
+    int step;       // 1回の更新で足す値
+    Node *update;   // 更新する本体直下の文(ステップ式で更新するならNULL)
+};
+
+// exprがiv * k + (ループ不変式)の形ならkを求める。
+static bool linear(Node *node, Loop *l, Var *iv, long *k) {
+    switch (node->kind) {
+        case ND_LVAR:
+            *k = 1;
+            return node->var == iv;
+        case ND_MUL:
+        case ND_SHL:
+            if (node->right->kind != ND_NUM || !linear(node->left, l, iv, k)) return false;
+            if (node->kind == ND_MUL) *k *= node->right->val;
+            else if (node->right->val < 31) *k <<= node->right->val;
+            else return false;
+            return *k > -65536 && *k < 65536;
+        case ND_ADD:
+            if (invariant(node->left, l)) return linear(node->right, l, iv, k);
+        case ND_SUB:
+            return invariant(node->right, l) && linear(node->left, l, iv, k);
+        case ND_NEG:
+            if (!linear(node->right, l, iv, k)) return false;
+            *k = -*k;
+            return true;
+    }
+    return false;
+}
+
+// 文がiv = iv + cの形ならcを求める。
+static bool is_update(Node *node, Var *var, int *c) {
+    if (node == NULL || node->kind != ND_ASGMT) return false;
+    Node *lhs = node->left, *rhs = node->right;
+    if (lhs->kind != ND_LVAR || lhs->var != var || rhs->kind != ND_ADD) return false;
+    if (rhs->left->kind != ND_LVAR || rhs->left->var != var || rhs->right->kind != ND_NUM) return false;
+    *c = rhs->right->val;
+    return true;
+}
+
+// ループの誘導変数(ループ内の代入がステップ式か本体直下のiv = iv + cだけの変数)を探す。
+static bool find_iv(Loop *l, Var *var, IndVar *iv) {
+    if (var->type->ty != INT || assigns(l, var) != 1) return false;
+    iv->var = var;
+    iv->update = NULL;
+    Node *loop = l->node;
+    if (is_update(loop->step, var, &iv->step)) return true;
+    Node *list = loop->body->kind == ND_BLOCK ? loop->body->right : loop->body;
+    for (Node *node = list; node != NULL; node = node->next) {
+        if (node->kind == ND_EXPR_STMT && is_update(node->right, var, &iv->step)) {
+            iv->update = node;
+            return true;
+        }
+        if (loop->body->kind != ND_BLOCK) break;
+    }
+    return false;
+}
+
+typedef struct Reducer Reducer;
+struct Reducer {
+    Function *fn;
+    Loop *l;
+    IndVar *iv;
+    Node *incs;     // ポインタを進める文の連結リスト
+    int n;
+};
+
+// base + iv*kの形のアドレス計算をポインタの一時変数に置き換える。
+static void reduce(Reducer *r, Node **ref) {
+    Node *node = *ref;
+    long k;
+    if (node->kind == ND_ADD && !iscint(node->type) && invariant(node->left, r->l)
+        && linear(node->right, r->l, r->iv->var, &k) && k != 0) {
+        long d = k * r->iv->step;
+        int before = r->l->ntemps;
+        if (d < -2147483647 || d > 2147483647) return;
+        if (before >= MAX_IVS && !has_temp(r->l, node)) return;
+        Var *tmp = temp_for(r->fn, r->l, node, "iv");
+        if (r->l->ntemps > before) {
+            // 一時変数もループ内で代入される変数になる
+            note_assign(r->l, tmp);
+            Node *inc = new_node_binary(ND_ADD, tmp->type, new_node_var(tmp), new_node_num((int) d));
+            Node *stmt = new_node_expr(new_node_binary(ND_ASGMT, tmp->type, new_node_var(tmp), inc));
+            stmt->next = r->incs;
+            r->incs = stmt;
+            r->n++;
+        }
+        Node *next = node->next;
+        *ref = new_node_var(tmp);
+        (*ref)->next = next;
+        return;
+    }
+    switch (node->kind) {
+        case ND_ASGMT:
+            if (node->left->kind == ND_DEREF) reduce(r, &node->left->right);
+            reduce(r, &node->right);
+            return;
+        case ND_ADDR:
+            if (node->right->kind == ND_DEREF) reduce(r, &node->right->right);
+            return;
+        case ND_BLOCK:
+            for (Node **p = &node->right; *p; p = &(*p)->next) {
+                reduce(r, p);
+            }
+            return;
+    }
+    Node **kids[] = {&node->left, &node->right, &node->cond, &node->body, &node->els,
+        &node->initialization, &node->step};
+    for (int i = 0; i < (int) (sizeof(kids) / sizeof(kids[0])); i++) {
+        if (*kids[i]) reduce(r, kids[i]);
+    }
+    for (int i = 0; i < node->nparams; i++) {
+        reduce(r, &node->params[i]);
+    }
+}
+
+// 文の連結リストの末尾にlistを繋ぐ。
+static void append_stmts(Node *stmt, Node *list) {
+    while (stmt->next) stmt = stmt->next;
+    stmt->next = list;
+}
+
+static void ivopts_loop(Function *fn, Node **link, int *nloops) {
+    Node *loop = *link;
+    Loop l;
+    analyze(&l, loop);
+    ++*nloops;
+    int reduced = 0;
+    for (int i = 0; i < l.nvars && l.ntemps < MAX_IVS; i++) {
+        IndVar iv;
+        if (!find_iv(&l, l.vars[i], &iv)) continue;
+        Reducer r = {fn, &l, &iv};
+        if (loop->cond) reduce(&r, &loop->cond);
+        reduce(&r, &loop->body);
+        if (r.incs == NULL) continue;
+        reduced += r.n;
+        // 誘導変数の更新の直後でポインタを進める(ステップ式で更新するなら本体の末尾)
+        if (iv.update) {
+            append_stmts(r.incs, iv.update->next);
+            iv.update->next = r.incs;
+        } else if (loop->body->kind == ND_BLOCK && loop->body->right) {
+            append_stmts(loop->body->right, r.incs);
+        } else {
+            Node *body = loop->body;
+            loop->body = new_node_block(body);
+            body->next = r.incs;
+        }
+    }
+    if (reduced) {
+        opt_report(P_IVOPTS, "%s: loop %d: %d addresses strength-reduced", fn->name, *nloops, reduced);
+    }
+    insert_preheader(link, &l);
+}
+
+// 展開する数え上げループ
+typedef struct Unroll Unroll;
+struct Unroll {
+    Var *iv;
+    int step;
+    int op;             // 終了条件をi op boundの形にしたときの比較
+    Node *bound;
+    char *labels[MAX_LABELS];   // 本体の中で展開した関数のreturnの飛び先
+    int nlabels;
+    bool too_many_labels;
+    Node *value;        // 複製した本体でiの代わりに使う式
+    int id;             // 複製の通し番号
+};
+
+static void count_node(Node *node, int depth, void *arg) {
+    ++*(int *) arg;
+}
+
+// 部分木のノード数
+static int tree_size(Node *node) {
+    int n = 0;
+    walk(node, 0, count_node, &n);
+    return n;
+}
+
+static void find_labels(Node *node, int depth, void *arg) {
+    Unroll *u = arg;
+    if (node->kind != ND_BLOCK || node->name == NULL) return;
+    if (u->nlabels == MAX_LABELS) {
+        u->too_many_labels = true;
+        return;
+    }
+    u->labels[u->nlabels++] = node->name;
+}
+
+static void find_loop(Node *node, int depth, void *arg) {
+    if (node->kind == ND_FOR || node->kind == ND_WHILE || node->kind == ND_VLOOP) *(bool *) arg = true;
+}
+
+// 部分木がループを含むかどうか
+static bool has_loop(Node *node) {
+    bool found = false;
+    walk(node, 0, find_loop, &found);
+    return found;
+}
+
+// 複製した本体のラベルの名前(本体の中で定義したものだけ複製ごとに付け替える)
+static char *relabel(Unroll *u, char *name) {
+    for (int i = 0; i < u->nlabels; i++) {
+        if (u->labels[i] != name && strcmp(u->labels[i], name) != 0) continue;
+        char *buf = calloc(1, strlen(name) + 16);
+        sprintf(buf, "%s.u%d", name, u->id);
+        return buf;
+    }
+    return name;
+}
+
+// 部分木を複製し、誘導変数をu->valueで置き換えて畳み込む。
+static Node *copy_body(Node *node, Unroll *u) {
+    if (node == NULL) return NULL;
+    if (node->kind == ND_LVAR && node->var == u->iv) {
+        Node *ret = calloc(1, sizeof(Node));
+        *ret = *u->value;
+        return ret;
+    }
+    Node *ret = calloc(1, sizeof(Node));
+    *ret = *node;
+    ret->left = copy_body(node->left, u);
+    ret->right = copy_body(node->right, u);
+    ret->cond = copy_body(node->cond, u);
+    ret->body = copy_body(node->body, u);
+    ret->els = copy_body(node->els, u);
+    ret->initialization = copy_body(node->initialization, u);
+    ret->step = copy_body(node->step, u);
+    ret->next = copy_body(node->next, u);
+    if (node->nparams) {
+        ret->params = calloc(node->nparams, sizeof(Node *));
+        for (int i = 0; i < node->nparams; i++) {
+            ret->params[i] = copy_body(node->params[i], u);
+        }
+    }
+    if ((node->kind == ND_BLOCK || node->kind == ND_RETURN) && node->name) {
+        ret->name = relabel(u, node->name);
+    }
+    switch (node->kind) {
+        case ND_ADD:
+        case ND_SUB:
+        case ND_MUL:
+        case ND_SHL:
+        case ND_NEG:
+        case ND_EQ:
+        case ND_NE:
+        case ND_GT:
+        case ND_GE:
+        case ND_LT:
+        case ND_LE:
+            return fold(ret);
+    }
+    return ret;
+}
+
+// iにvalueを入れた本体を複製する。
+static Node *unrolled_copy(Unroll *u, Node *body, Node *value) {
+    static int ncopies;
+    u->value = value;
+    u->id = ++ncopies;
+    return copy_body(body, u);
+}
+
+// i op boundが成り立つかどうか
+static bool compare(int op, long i, long bound) {
+    switch (op) {
+        case ND_LT:
+            return i < bound;
+        case ND_LE:
+            return i <= bound;
+        case ND_GT:
+            return i > bound;
+        case ND_GE:
+            return i >= bound;
+    }
+    return i != bound;
+}
+
+// 比較の左右を入れ替えた比較
+static int swap_cmp(int op) {
+    switch (op) {
+        case ND_LT:
+            return ND_GT;
+        case ND_LE:
+            return ND_GE;
+        case ND_GT:
+            return ND_LT;
+        case ND_GE:
+            return ND_LE;
+    }
+    return op;
+}
+
+// ループが展開できる数え上げループか調べる。できなければ理由を返す。
+static char *counted_loop(Loop *l, Unroll *u) {
+    Node *loop = l->node;
+    if (loop->kind != ND_FOR || loop->cond == NULL || loop->step == NULL) return "not a counted for loop";
+    Node *step = loop->step;
+    if (step->kind != ND_ASGMT || step->left->kind != ND_LVAR) return "no induction variable";
+    u->iv = step->left->var;
+    if (u->iv->escaped || u->iv->type->ty != INT || assigns(l, u->iv) != 1
+        || !is_update(step, u->iv, &u->step) || u->step == 0) {
+        return "no induction variable";
+    }
+    Node *cond = loop->cond;
+    switch (cond->kind) {
+        case ND_LT:
+        case ND_LE:
+        case ND_GT:
+        case ND_GE:
+        case ND_NE:
+            break;
+        default:
+            return "unsupported exit condition";
+    }
+    if (cond->left->kind == ND_LVAR && cond->left->var == u->iv) {
+        u->op = cond->kind;
+        u->bound = cond->right;
+    } else if (cond->right->kind == ND_LVAR && cond->right->var == u->iv) {
+        u->op = swap_cmp(cond->kind);
+        u->bound = cond->left;
+    } else {
+        return "unsupported exit condition";
+    }
+    if (!invariant(u->bound, l)) return "loop bound may change in the loop";
+    walk(loop->body, 0, find_labels, u);
+    if (u->too_many_labels) return "too many inlined calls";
+    return NULL;
+}
+
+// 反復回数がコンパイル時に分かればその値を、分からないか多すぎれば-1を返す。
+static int trip_count(Node *loop, Unroll *u, int *first) {
+    Node *init = loop->initialization;
+    if (init == NULL || init->kind != ND_EXPR_STMT || init->right->kind != ND_ASGMT) return -1;
+    Node *asgmt = init->right;
+    if (asgmt->left->kind != ND_LVAR || asgmt->left->var != u->iv || asgmt->right->kind != ND_NUM) return -1;
+    if (u->bound->kind != ND_NUM) return -1;
+    *first = asgmt->right->val;
+    long i = *first;
+    int n = 0;
+    while (compare(u->op, i, u->bound->val)) {
+        i += u->step;
+        if (++n > MAX_FULL_UNROLL || i < -2147483647 - 1 || i > 2147483647) return -1;
+    }
+    return n;
+}
+
+// 本体を反復回数分並べたブロックでループを置き換える。
+static void full_unroll(Node *loop, Unroll *u, int first, int n) {
+    Node head = {0};
+    Node *tail = &head;
+    if (loop->initialization) tail = tail->next = loop->initialization;
+    for (int k = 0; k < n; k++) {
+        tail = tail->next = unrolled_copy(u, loop->body, new_node_num(first + k * u->step));
+    }
+    // ループを抜けたあとのiの値
+    Node *last = new_node_num(first + n * u->step);
+    tail->next = new_node_expr(new_node_binary(ND_ASGMT, u->iv->type, new_node_var(u->iv), last));
+    // 処理中のループを指すポインタが変わらないよう、ループのノードをブロックに書き換える
+    Node *next = loop->next;
+    memset(loop, 0, sizeof(*loop));
+    loop->kind = ND_BLOCK;
+    loop->right = head.next;
+    loop->next = next;
+}
+
+// 本体をfactor個並べてfactor回分ずつ進むループを元のループの前に置く。
+static void partial_unroll(Node **link, Unroll *u, int factor) {
+    Node *loop = *link;
+    Node head = {0};
+    Node *tail = &head;
+    for (int k = 0; k < factor; k++) {
+        Node *value = fold(new_node_binary(ND_ADD, u->iv->type, new_node_var(u->iv), new_node_num(k * u->step)));
+        tail = tail->next = unrolled_copy(u, loop->body, value);
+    }
+    Node *fast = calloc(1, sizeof(Node));
+    fast->kind = ND_FOR;
+    // 最後の複製の反復でも条件が成り立つ間だけ回る
+    Node *last = fold(new_node_binary(ND_ADD, u->iv->type, new_node_var(u->iv),
+                                      new_node_num((factor - 1) * u->step)));
+    fast->cond = new_node_binary(u->op, loop->cond->type, last, unrolled_copy(u, u->bound, NULL));
+    Node *inc = new_node_binary(ND_ADD, u->iv->type, new_node_var(u->iv), new_node_num(factor * u->step));
+    fast->step = new_node_binary(ND_ASGMT, u->iv->type, new_node_var(u->iv), inc);
+    fast->body = new_node_block(head.next);
+    fast->next = loop;
+    if (loop->initialization) {
+        Node *init = loop->initialization;
+        loop->initialization = NULL;
+        init->next = fast;
+        *link = init;
+    } else {
+        *link = fast;
+    }
+}
+
+static void unroll_loop(Function *fn, Node **link, int *nloops) {
+    Node *loop = *link;
+    Loop l;
+    analyze(&l, loop);
+    ++*nloops;
+    Unroll u = {0};
+    char *reason = counted_loop(&l, &u);
+    if (reason) {
+        opt_report(P_UNROLL, "%s: loop %d: not unrolled: %s", fn->name, *nloops, reason);
+        return;
+    }
+    int size = tree_size(loop->body);
+    int first;
+    int n = trip_count(loop, &u, &first);
+    if (n >= 0 && n * size <= UNROLL_SIZE) {
+        full_unroll(loop, &u, first, n);
+        opt_report(P_UNROLL, "%s: loop %d: fully unrolled (%d iterations)", fn->name, *nloops, n);
+        return;
+    }
+    if (unroll_factor < 2) {
+        reason = "partial unrolling disabled";
+    } else if (loop->val > 0 && loop->val <= unroll_factor) {
+        reason = "remainder of a vectorized loop";
+    } else if (u.op == ND_NE || (u.step > 0) != (u.op == ND_LT || u.op == ND_LE)) {
+        reason = "unsupported exit condition";
+    } else if (size * unroll_factor > UNROLL_SIZE) {
+        reason = "loop body too large";
+    } else if (has_call(loop->body)) {
+        reason = "loop body contains a call";
+    } else if (has_loop(loop->body)) {
+        reason = "loop body contains a loop";
+    }
+    if (reason) {
+        opt_report(P_UNROLL, "%s: loop %d: not unrolled: %s", fn->name, *nloops, reason);
+        return;
+    }
+    partial_unroll(link, &u, unroll_factor);
+    opt_report(P_UNROLL, "%s: loop %d: unrolled by %d with a remainder loop", fn->name, *nloops, unroll_factor);
+}
+
+// 文がその外へ出るbreakか、外のswitch文のcaseラベルを含むかどうか
+static bool jumps_across(Node *node) {
+    if (node == NULL) return false;
+    switch (node->kind) {
+        case ND_BREAK:
+        case ND_CASE:
+            return true;
+        case ND_FOR:
+        case ND_WHILE:
+        case ND_VLOOP:
+            // 入れ子のループのbreakはそのループを抜けるだけ
+            return jumps_across(node->initialization) || has_case(node->body);
+        case ND_SWITCH:
+            return false;
+        case ND_BLOCK:
+            for (Node *p = node->right; p != NULL; p = p->next) {
+                if (jumps_across(p)) return true;
+            }
+            return false;
+    }
+    if (jumps_across(node->cond) || jumps_across(node->body) || jumps_across(node->els)
+        || jumps_across(node->left) || jumps_across(node->right)) {
+        return true;
+    }
+    for (int i = 0; i < node->nparams; i++) {
+        if (jumps_across(node->params[i])) return true;
+    }
+    return false;
+}
+
+// 文の並びの中のループを内側から順に処理する。
+static void each_loop(Function *fn, Node **link, void (*fn_loop)(Function *, Node **, int *), int *nloops);
+
+// 文(とその中の文式)のループを処理する。ループを挿入した文で置き換えるときはブロックにする。
+static void each_stmt(Function *fn, Node **ref, void (*fn_loop)(Function *, Node **, int *), int *nloops) {
+    Node *node = *ref;
+    if (node == NULL) return;
+    switch (node->kind) {
+        case ND_BLOCK:
+            each_loop(fn, &node->right, fn_loop, nloops);
+            return;
+        case ND_IF:
+            each_stmt(fn, &node->body, fn_loop, nloops);
+            each_stmt(fn, &node->els, fn_loop, nloops);
+            return;
+        case ND_SWITCH:
+        case ND_CASE:
+            each_stmt(fn, &node->body, fn_loop, nloops);
+            return;
+        case ND_FOR:
+        case ND_WHILE: {
+            Node *next = node->next;
+            node->next = NULL;
+            Node *block = new_node_block(node);
+            each_loop(fn, &block->right, fn_loop, nloops);
+            *ref = block->right == node ? node : block;
+            (*ref)->next = next;
+            return;
+        }
+    }
+    // 文式やインライン展開した本体
+    each_stmt(fn, &node->left, fn_loop, nloops);
+    each_stmt(fn, &node->right, fn_loop, nloops);
+    for (int i = 0; i < node->nparams; i++) {
+        each_stmt(fn, &node->params[i], fn_loop, nloops);
+    }
+}
+
+static void each_loop(Function *fn, Node **link, void (*fn_loop)(Function *, Node **, int *), int *nloops) {
+    for (; *link; link = &(*link)->next) {
+        Node *node = *link;
+        if (node->kind != ND_FOR && node->kind != ND_WHILE) {
+            each_stmt(fn, link, fn_loop, nloops);
+            continue;
+        }
+        if (node->initialization) each_stmt(fn, &node->initialization, fn_loop, nloops);
+        each_stmt(fn, &node->body, fn_loop, nloops);
+        // breakで抜けるループやcaseラベルで途中に入るループは出入口が1つでないので変形しない
+        if (jumps_across(node->body)) {
+            ++*nloops;
+            continue;
+        }
+        fn_loop(fn, link, nloops);
+        // プリヘッダを挿入したらループの位置まで進める
+        while (*link != node) link = &(*link)->next;
+    }
+}
+
+// 関数のすべてのループに内側から順にvisitを適用する。
+// visitにはループを指すポインタ(前にプリヘッダなどの文を挿入してよい)とループの通し番号を渡す。
+void for_each_loop(Function *fn, void (*visit)(Function *, Node **, int *)) {
+    mark_escaped(fn);
+    int nloops = 0;
+    each_loop(fn, &fn->code, visit, &nloops);
+}
+
+// ループ不変式をループの前へ移動する。
+void licm(Function *fn) {
+    for_each_loop(fn, licm_loop);
+}
+
+// 誘導変数から求めるアドレス計算をポインタの加算に置き換える。
+void ivopts(Function *fn) {
+    for_each_loop(fn, ivopts_loop);
+}
+
+// 数え上げループを展開する。
+void unroll_loops(Function *fn) {
+    for_each_loop(fn, unroll_loop);
+}
@@ -8,16 +8,30 @@
 #include "tinycc.h"
 
 int main(int argc, char **argv){
-    if (argc != 2) {
+    char *path = NULL;
+    int npaths = 0;
+    for (int i = 1; i < argc; i++) {
+        // "-"は標準入力を表す
+        if (argv[i][0] == '-' && argv[i][1] != '\0') {
+            if (!parse_opt(argv[i])) error("不明なオプションです: %s", argv[i]);
+            continue;
+        }
+        path = argv[i];
+        npaths++;
+    }
+    if (npaths != 1) {
         fprintf(stderr, "引数の個数が正しくありません\n");
         return 1;
     }
+    opt_init();
     // 現在着目しているトークン
     Token *token;
     // トークナイズ
-    token = tokenize_file(argv[1]);
+    token = tokenize_file(path);
     // 抽象構文木の作成
     Code *prog = trns_unit(&token);
+    // 最適化
+    optimize(prog);
     // コード生成
     codegen(prog);
     
@@ -0,0 +1,402 @@
+//
+//  opt.c
+//  tinycc
+//
+//  Created by sanluisrey on 2026/10/19.
+//
+
+#include "tinycc.h"
+#include <time.h>
+
+// 最適化レベル(-O0, -O1, -O2)
+int opt_level = 0;
+// 最適化中の翻訳単位
+static Code *unit;
+// -ftime-reportが指定されたかどうか
+static bool time_report;
+// ループ先頭の揃え(バイト数、-falign-loops=N)。負なら最適化レベルで決める
+int align_loops = -1;
+// ループを部分的に展開する倍数(-funroll-loops=N)。負なら既定値にする
+int unroll_factor = -1;
+
+static void simplify(Function *fn);
+
+// 最適化パスの一覧(実行順)
+Pass passes[] = {
+    [P_SIMPLIFY] = {"simplify", 1, simplify},
+    [P_FOLD] = {"fold", 1, NULL},
+    [P_CMPBR] = {"cmp-branch", 1, NULL},
+    [P_ROTATE] = {"loop-rotate", 1, NULL},
+    [P_SWITCH] = {"switch-tables", 1, NULL},
+    [P_EVAL] = {"eval-calls", 2, eval_pure_calls},
+    [P_INLINE] = {"inline", 2, inline_func},
+    [P_VECTORIZE] = {"vectorize", 2, vectorize},
+    [P_UNROLL] = {"unroll-loops", 2, unroll_loops},
+    [P_IFCONV] = {"if-conversion", 2, if_convert},
+    [P_CSE] = {"cse", 2, cse},
+    [P_LICM] = {"licm", 2, licm},
+    [P_IVOPTS] = {"ivopts", 2, ivopts},
+    [P_FORWARD] = {"store-forward", 1, store_forward},
+    [P_DCE] = {"dce", 1, dce},
+    [P_SSA] = {"ssa", 2, build_ssa},
+    [P_MEM2REG] = {"mem2reg", 2, mem2reg},
+    [P_PEEPHOLE] = {"peephole", 1, NULL},
+    [P_ADDRMODE] = {"addr-mode", 1, NULL},
+    [P_IMM] = {"imm", 1, NULL},
+    [P_RMW] = {"rmw", 1, NULL},
+    [P_DIVCONST] = {"div-const", 1, NULL},
+    [P_TAILCALL] = {"tail-call", 2, NULL},
+    [P_STACKREUSE] = {"stack-reuse", 1, NULL},
+    [P_LEAFFRAME] = {"leaf-frame", 1, NULL},
+    [P_ARGREGS] = {"arg-regs", 1, NULL},
+    // デバッグしやすいよう-O2までは有効にしない
+    [P_OMITFP] = {"omit-frame-pointer", 3, NULL},
+};
+
+// -O<n>, -f<pass>, -fno-<pass>, -f<pass>-report, -ftime-reportを解釈する。
+// 解釈できないオプションの場合は偽を返す。
+bool parse_opt(char *arg) {
+    if (!strncmp(arg, "-O", 2)) {
+        char *end;
+        int n = arg[2] ? (int) strtol(arg + 2, &end, 10) : 1;
+        if (arg[2] && (*end || n < 0)) return false;
+        opt_level = n;
+        return true;
+    }
+    if (strncmp(arg, "-f", 2) != 0) return false;
+    char *name = arg + 2;
+    if (!strcmp(name, "time-report")) {
+        time_report = true;
+        return true;
+    }
+    if (!strncmp(name, "align-loops=", 12)) {
+        char *end;
+        align_loops = (int) strtol(name + 12, &end, 10);
+        // 0と1は揃えないことを表す
+        if (*end || (align_loops > 1 && ilog2(align_loops) < 0)) return false;
+        return align_loops >= 0;
+    }
+    if (!strncmp(name, "unroll-loops=", 13)) {
+        char *end;
+        unroll_factor = (int) strtol(name + 13, &end, 10);
+        passes[P_UNROLL].forced = 1;
+        // 1は完全な展開だけを行うことを表す
+        return !*end && unroll_factor >= 1;
+    }
+    if (!strncmp(name, "if-conversion=", 14)) {
+        char *end;
+        if_conv_budget = (int) strtol(name + 14, &end, 10);
+        passes[P_IFCONV].forced = 1;
+        // 両方の値の計算量の合計の上限
+        return !*end && if_conv_budget >= 0;
+    }
+    if (!strcmp(name, "no-align-loops")) {
+        align_loops = 0;
+        return true;
+    }
+    int forced = 1;
+    if (!strncmp(name, "no-", 3)) {
+        name += 3;
+        forced = -1;
+    }
+    for (int i = 0; i < NPASSES; i++) {
+        Pass *p = &passes[i];
+        int len = (int) strlen(p->name);
+        if (strncmp(name, p->name, len) != 0) continue;
+        if (name[len] == '\0') {
+            p->forced = forced;
+            return true;
+        }
+        if (forced > 0 && !strcmp(name + len, "-report")) {
+            p->report = true;
+            return true;
+        }
+    }
+    return false;
+}
+
+// 最適化レベルと個別の指定から各パスの有効・無効を決める。
+// 個別の指定は指定の順序によらず最適化レベルに優先する。
+void opt_init(void) {
+    if (align_loops < 0) align_loops = opt_level >= 2 ? 16 : 0;
+    if (unroll_factor < 0) unroll_factor = 4;
+    for (int i = 0; i < NPASSES; i++) {
+        Pass *p = &passes[i];
+        p->enabled = p->forced ? p->forced > 0 : p->level <= opt_level;
+    }
+}
+
+// -f<name>-reportが指定されていれば、パスの処理内容を標準エラー出力に報告する。
+void opt_report(int pass, char *fmt, ...) {
+    Pass *p = &passes[pass];
+    if (!p->report) return;
+    va_list ap;
+    va_start(ap, fmt);
+    fprintf(stderr, "%s: ", p->name);
+    vfprintf(stderr, fmt, ap);
+    fprintf(stderr, "\n");
+    va_end(ap);
+}
+
+// 全関数に対して有効なパスを順に適用する。
+void optimize(Code *prog) {
+    unit = prog;
+    for (int i = 0; i < NPASSES; i++) {
+        Pass *p = &passes[i];
+        if (!p->enabled || p->run == NULL) continue;
+        clock_t start = clock();
+        for (int j = 0; j < prog->n; j++) {
+            if (prog->function[j]->name) p->run(prog->function[j]);
+        }
+        p->time += (double) (clock() - start) / CLOCKS_PER_SEC;
+    }
+    // 参照されないstaticな関数と変数は全関数を処理してから除く
+    if (optimizing(P_DCE)) dce_unit(prog);
+    if (!time_report) return;
+    fprintf(stderr, "pass                 time(ms)  enabled\n");
+    for (int i = 0; i < NPASSES; i++) {
+        Pass *p = &passes[i];
+        fprintf(stderr, "%-20s %8.3f  %s\n", p->name, p->time * 1000, p->enabled ? "yes" : "no");
+    }
+}
+
+// 翻訳単位で定義された関数を名前で探す。
+Function *find_function(char *name) {
+    for (int i = 0; i < unit->n; i++) {
+        Function *fn = unit->function[i];
+        if (fn->name && fn->code && !strcmp(fn->name, name)) return fn;
+    }
+    return NULL;
+}
+
+// 関数に最適化で使う一時変数を追加する。名前は<prefix>.<通し番号>とする。
+// 式は64ビットで計算するので、charの式や大きさの決まっていない型の値はintの変数に置く。
+Var *new_temp(Function *fn, char *prefix, Type *ty) {
+    if (ty->ty == CHAR || (!isarray(ty) && ty->size == 0)) ty = IntType;
+    static int ntemps;
+    Var *var = calloc(1, sizeof(Var));
+    char *name = calloc(1, strlen(prefix) + 16);
+    sprintf(name, "%s.%d", prefix, ++ntemps);
+    var->str = var->name = name;
+    var->len = (int) strlen(name);
+    var->type = isarray(ty) ? atop(ty) : ty;
+    var->scope = LOCAL;
+    fn->vars = realloc(fn->vars, (fn->nvars + 1) * sizeof(Var *));
+    fn->vars[fn->nvars++] = var;
+    return var;
+}
+
+static void find_call(Node *node, int depth, void *arg) {
+    if (node->kind == ND_FUNCCALL) *(bool *) arg = true;
+}
+
+// 部分木が関数呼び出しを含むかどうかを返す。
+bool has_call(Node *node) {
+    bool call = false;
+    walk(node, 0, find_call, &call);
+    return call;
+}
+
+// 部分木が(入れ子のswitch文に属さない)caseラベルを含むかどうかを返す。
+bool has_case(Node *node) {
+    if (node == NULL) return false;
+    switch (node->kind) {
+        case ND_CASE:
+            return true;
+        case ND_SWITCH:
+            return false;
+        case ND_BLOCK:
+            for (Node *p = node->right; p != NULL; p = p->next) {
+                if (has_case(p)) return true;
+            }
+            return false;
+    }
+    return has_case(node->cond) || has_case(node->body) || has_case(node->els)
+        || has_case(node->initialization) || has_case(node->left) || has_case(node->right);
+}
+
+// 関数が他の関数を呼び出さない葉関数かどうかを返す。
+bool is_leaf(Function *fn) {
+    for (Node *node = fn->code; node != NULL; node = node->next) {
+        if (has_call(node)) return false;
+    }
+    return true;
+}
+
+// 式が副作用を持たないかどうかを返す。
+bool is_pure(Node *node) {
+    if (node == NULL) return true;
+    switch (node->kind) {
+        case ND_ASGMT:
+        case ND_FUNCCALL:
+        case ND_BLOCK:
+            return false;
+    }
+    return is_pure(node->left) && is_pure(node->right);
+}
+
+// 2つの式が構造的に等しいかどうかを返す。
+bool same_node(Node *a, Node *b) {
+    if (a == NULL || b == NULL) return a == b;
+    if (a->kind != b->kind) return false;
+    switch (a->kind) {
+        case ND_NUM:
+            return a->val == b->val;
+        case ND_LVAR:
+            return a->var == b->var;
+        case ND_GVAR:
+        case ND_STR:
+            return !strcmp(a->name, b->name);
+        case ND_ASGMT:
+        case ND_FUNCCALL:
+        case ND_BLOCK:
+            return false;
+    }
+    if (a->type && b->type && a->type->ty != b->type->ty) return false;
+    return same_node(a->left, b->left) && same_node(a->right, b->right);
+}
+
+// レジスタに置けるスカラー型(int, char, ポインタ)かどうかを返す。
+bool is_scalar(Type *ty) {
+    return ty && (ty->ty == INT || ty->ty == CHAR || ty->ty == PTR);
+}
+
+// 比較演算のノードかどうかを返す。
+bool is_cmp(Node *node) {
+    switch (node->kind) {
+        case ND_EQ:
+        case ND_NE:
+        case ND_GT:
+        case ND_GE:
+        case ND_LT:
+        case ND_LE:
+            return true;
+    }
+    return false;
+}
+
+static void find_escaped(Node *node, int depth, void *arg) {
+    if (node->kind == ND_ADDR && node->right->kind == ND_LVAR) {
+        node->right->var->escaped = true;
+    }
+}
+
+// 関数本体でアドレスを取られたローカル変数のescapedに印を付ける。
+void mark_escaped(Function *fn) {
+    for (Node *node = fn->code; node != NULL; node = node->next) {
+        walk(node, 0, find_escaped, NULL);
+    }
+}
+
+// 部分木の全ノードを前順に訪問してfnを呼ぶ。
+// depthはループの入れ子の深さで、for, whileの条件・本体・ステップで1増える。
+void walk(Node *node, int depth, void (*fn)(Node *, int, void *), void *arg) {
+    if (node == NULL) return;
+    fn(node, depth, arg);
+    switch (node->kind) {
+        case ND_BLOCK:
+            for (Node *p = node->right; p != NULL; p = p->next) {
+                walk(p, depth, fn, arg);
+            }
+            return;
+        case ND_FOR:
+        case ND_WHILE:
+            walk(node->initialization, depth, fn, arg);
+            walk(node->cond, depth + 1, fn, arg);
+            walk(node->body, depth + 1, fn, arg);
+            walk(node->step, depth + 1, fn, arg);
+            return;
+        case ND_VLOOP:
+            walk(node->left, depth + 1, fn, arg);
+            walk(node->right, depth + 1, fn, arg);
+            walk(node->cond, depth + 1, fn, arg);
+            walk(node->body, depth + 1, fn, arg);
+            for (int i = 0; i < node->nparams; i++) {
+                walk(node->params[i], depth, fn, arg);
+            }
+            return;
+    }
+    walk(node->cond, depth, fn, arg);
+    walk(node->body, depth, fn, arg);
+    walk(node->els, depth, fn, arg);
+    walk(node->left, depth, fn, arg);
+    walk(node->right, depth, fn, arg);
+    for (int i = 0; i < node->nparams; i++) {
+        walk(node->params[i], depth, fn, arg);
+    }
+}
+
+// 空文の除去と入れ子になったブロックの平坦化
+static Node *simplify_list(Node *list);
+
+static void simplify_expr(Node *node) {
+    if (node == NULL) return;
+    if (node->kind == ND_BLOCK) {
+        node->right = simplify_list(node->right);
+        return;
+    }
+    simplify_expr(node->left);
+    simplify_expr(node->right);
+    for (int i = 0; i < node->nparams; i++) {
+        simplify_expr(node->params[i]);
+    }
+}
+
+static void simplify_stmt(Node *node) {
+    switch (node->kind) {
+        case ND_IF:
+            simplify_expr(node->cond);
+            simplify_stmt(node->body);
+            if (node->els) simplify_stmt(node->els);
+            return;
+        case ND_FOR:
+            if (node->initialization) simplify_stmt(node->initialization);
+            simplify_expr(node->cond);
+            simplify_expr(node->step);
+            simplify_stmt(node->body);
+            return;
+        case ND_WHILE:
+        case ND_SWITCH:
+            simplify_expr(node->cond);
+            simplify_stmt(node->body);
+            return;
+        case ND_CASE:
+            simplify_stmt(node->body);
+            return;
+        case ND_BLOCK:
+            node->right = simplify_list(node->right);
+            return;
+        case ND_RETURN:
+        case ND_EXPR_STMT:
+            simplify_expr(node->right);
+            return;
+    }
+}
+
+// 文の連結リストを作り直して返す。
+static Node *simplify_list(Node *list) {
+    Node head = {0};
+    Node *tail = &head;
+    Node *next;
+    for (Node *node = list; node != NULL; node = next) {
+        next = node->next;
+        node->next = NULL;
+        if (node->kind == ND_NULL) continue;
+        if (node->kind == ND_EXPR_STMT && node->right->kind == ND_NULL) continue;
+        simplify_stmt(node);
+        if (node->kind == ND_BLOCK) {
+            // ブロック内の文を外側のリストへ繋ぎ替える
+            for (Node *p = node->right; p != NULL; p = p->next) {
+                tail = tail->next = p;
+            }
+            continue;
+        }
+        tail = tail->next = node;
+    }
+    tail->next = NULL;
+    return head.next;
+}
+
+static void simplify(Function *fn) {
+    fn->code = simplify_list(fn->code);
+}
@@ -0,0 +1,268 @@
+//
+//  peep.c
+//  tinycc
+//
+//  Created by sanluisrey on 2026/10/19.
+//
+
+#include "tinycc.h"
+
+// 出力待ちの命令列(1行が1要素、削除した行はNULL)
+static char **code;
+static int ncode;
+static int capacity;
+
+// 命令列の末尾に1行追加する。
+void emit(char *fmt, ...) {
+    va_list ap;
+    char *buf;
+    size_t size;
+    FILE *out = open_memstream(&buf, &size);
+    va_start(ap, fmt);
+    vfprintf(out, fmt, ap);
+    va_end(ap);
+    fclose(out);
+    if (size > 0 && buf[size - 1] == '\n') buf[size - 1] = '\0';
+    if (ncode == capacity) {
+        capacity = capacity ? capacity * 2 : 256;
+        code = realloc(code, capacity * sizeof(char *));
+    }
+    code[ncode++] = buf;
+}
+
+// 行が命令ならインデントを除いた本体を、ラベルや疑似命令ならNULLを返す。
+static char *insn(int i) {
+    char *s = code[i];
+    if (s == NULL || strncmp(s, "    ", 4) != 0 || s[4] == '.') return NULL;
+    return s + 4;
+}
+
+static bool is_label(int i) {
+    char *s = code[i];
+    return s && s[0] != ' ' && s[strlen(s) - 1] == ':';
+}
+
+// iの次の(削除されていない)行の添字を返す。
+static int next(int i) {
+    for (i++; i < ncode && code[i] == NULL; i++)
+        ;
+    return i;
+}
+
+static void replace(int i, char *fmt, ...) {
+    va_list ap;
+    char *buf = calloc(1, 64);
+    strcpy(buf, "    ");
+    va_start(ap, fmt);
+    vsnprintf(buf + 4, 60, fmt, ap);
+    va_end(ap);
+    code[i] = buf;
+}
+
+// 命令がレジスタregを参照するかどうか(部分レジスタ名も含む)
+static bool uses_reg(char *s, char *reg) {
+    for (char *p = strstr(s, reg); p; p = strstr(p + 1, reg)) {
+        bool head = p == s || !isalnum(p[-1]);
+        bool tail = !isalnum(p[strlen(reg)]);
+        if (head && tail) return true;
+    }
+    return false;
+}
+
+// 命令がフラグを読むかどうか
+static bool reads_flags(char *s) {
+    if (s == NULL) return true;
+    return (s[0] == 'j' && strncmp(s, "jmp", 3) != 0) || !strncmp(s, "set", 3)
+        || !strncmp(s, "cmov", 4) || !strncmp(s, "adc", 3) || !strncmp(s, "sbb", 3);
+}
+
+// push rax; pop reg => mov reg, rax
+static bool push_pop(int i) {
+    int j = next(i);
+    if (j >= ncode || strcmp(insn(i), "push rax") != 0 || !insn(j)) return false;
+    if (strncmp(insn(j), "pop ", 4) != 0) return false;
+    char *reg = insn(j) + 4;
+    if (!strcmp(reg, "rax")) {
+        code[i] = code[j] = NULL;
+    } else {
+        replace(i, "mov %s, rax", reg);
+        code[j] = NULL;
+    }
+    return true;
+}
+
+// push rax; I1..Ik; pop rdi => mov rdi, rax; I1..Ik
+// (I1..Ikがrdiとスタックに触れず、制御を移さない場合)
+static bool push_sink(int i) {
+    if (strcmp(insn(i), "push rax") != 0) return false;
+    int j = i;
+    for (int k = 0; k < 4; k++) {
+        j = next(j);
+        char *s = j < ncode ? insn(j) : NULL;
+        if (s == NULL) return false;
+        if (!strcmp(s, "pop rdi")) {
+            if (k == 0) return false;
+            replace(i, "mov rdi, rax");
+            code[j] = NULL;
+            return true;
+        }
+        if (uses_reg(s, "rdi") || uses_reg(s, "edi") || uses_reg(s, "dil") || uses_reg(s, "rsp")
+            || !strncmp(s, "push", 4) || !strncmp(s, "pop", 3) || !strncmp(s, "call", 4)
+            || s[0] == 'j' || !strncmp(s, "ret", 3)) {
+            return false;
+        }
+    }
+    return false;
+}
+
+// 行kがraxの指す先からraxへのロード(mov|movsx|movsxd rax, ...[rax])ならその長さを、違えば0を返す。
+static size_t load_rax(int k) {
+    char *s = k < ncode ? insn(k) : NULL;
+    size_t len = s ? strlen(s) : 0;
+    if (s && len > 5 && !strcmp(s + len - 5, "[rax]")
+        && (!strncmp(s, "mov rax, ", 9) || !strncmp(s, "movsx rax, ", 11) || !strncmp(s, "movsxd rax, ", 12))) {
+        return len;
+    }
+    return 0;
+}
+
+// mov rax, rbp; sub rax, N; (mov|movsx|movsxd) rax, ...[rax]
+//   => (mov|movsx|movsxd) rax, ...[rbp-N]
+// 後続のロードがなければ lea rax, [rbp-N]
+// フレームポインタを使わないときの lea rax, [rsp+N]; (ロード) も同様にまとめる。
+static bool frame_addr(int i) {
+    int j = next(i);
+    int n;
+    if (sscanf(insn(i), "lea rax, [rsp+%d]", &n) == 1) {
+        size_t len = load_rax(j);
+        if (!len) return false;
+        replace(i, "%.*s[rsp+%d]", (int) len - 5, insn(j), n);
+        code[j] = NULL;
+        return true;
+    }
+    if (strcmp(insn(i), "mov rax, rbp") != 0 || j >= ncode || !insn(j)) return false;
+    if (sscanf(insn(j), "sub rax, %d", &n) != 1) return false;
+    int k = next(j);
+    size_t len = load_rax(k);
+    if (len) {
+        replace(i, "%.*s[rbp-%d]", (int) len - 5, insn(k), n);
+        code[j] = code[k] = NULL;
+    } else {
+        // subはフラグを変えるが、アドレス計算の直後でフラグを読むことはない
+        replace(i, "lea rax, [rbp-%d]", n);
+        code[j] = NULL;
+    }
+    return true;
+}
+
+// jmp L; (ラベル)*; L: => (ラベル)*; L:
+static bool jump_next(int i) {
+    char *s = insn(i);
+    if (strncmp(s, "jmp ", 4) != 0) return false;
+    char *target = s + 4;
+    size_t len = strlen(target);
+    for (int j = next(i); j < ncode && is_label(j); j = next(j)) {
+        if (strlen(code[j]) == len + 1 && !strncmp(code[j], target, len)) {
+            code[i] = NULL;
+            return true;
+        }
+    }
+    return false;
+}
+
+// mov rax, 0 => xor eax, eax (直後でフラグを読まない場合)
+static bool zero_reg(int i) {
+    if (strcmp(insn(i), "mov rax, 0") != 0) return false;
+    int j = next(i);
+    if (j < ncode && reads_flags(insn(j)) && !is_label(j)) return false;
+    replace(i, "xor eax, eax");
+    return true;
+}
+
+// mov SIZE PTR [X], (al|eax|rax|imm); (movsx|movsxd|mov) rax, SIZE PTR [X]
+//   => mov SIZE PTR [X], ...; (movsx rax, al|movsxd rax, eax|mov rax, imm)
+// 書き込んだ直後に読み直す値は、書き込んだレジスタか即値から得る。
+static bool store_load(int i) {
+    static char *sizes[][3] = {
+        {"BYTE", "al", "movsx"},
+        {"DWORD", "eax", "movsxd"},
+        {"QWORD", "rax", "mov"},
+    };
+    char *s = insn(i);
+    int j = next(i);
+    if (strncmp(s, "mov ", 4) != 0 || j >= ncode || !insn(j)) return false;
+    char *comma = strrchr(s, ',');
+    if (comma == NULL || comma[1] != ' ') return false;
+    char *src = comma + 2;
+    for (int k = 0; k < 3; k++) {
+        size_t len = strlen(sizes[k][0]);
+        if (strncmp(s + 4, sizes[k][0], len) != 0 || strncmp(s + 4 + len, " PTR [", 6) != 0) continue;
+        char load[64];
+        snprintf(load, sizeof(load), "%s rax, %.*s", sizes[k][2], (int) (comma - (s + 4)), s + 4);
+        if (strcmp(insn(j), load) != 0) return false;
+        char *end;
+        long val = strtol(src, &end, 10);
+        if (*end == '\0' && end != src) {
+            replace(j, "mov rax, %ld", k == 0 ? (long) (signed char) val : k == 1 ? (long) (int) val : val);
+        } else if (!strcmp(src, sizes[k][1])) {
+            if (k == 2) code[j] = NULL;
+            else replace(j, "%s rax, %s", sizes[k][2], src);
+        } else {
+            return false;
+        }
+        return true;
+    }
+    return false;
+}
+
+typedef struct Rule Rule;
+struct Rule {
+    char *name;
+    bool (*apply)(int i);
+    int hits;
+};
+
+static Rule rules[] = {
+    {"push-pop", push_pop},
+    {"push-sink", push_sink},
+    {"frame-addr", frame_addr},
+    {"jump-next", jump_next},
+    {"store-load", store_load},
+    {"zero-reg", zero_reg},
+};
+
+#define NRULES ((int) (sizeof(rules) / sizeof(rules[0])))
+
+// 命令列に書き換え規則を変化がなくなるまで適用する。
+static void peephole(void) {
+    bool changed = true;
+    while (changed) {
+        changed = false;
+        for (int i = 0; i < ncode; i++) {
+            for (int r = 0; r < NRULES && insn(i); r++) {
+                if (rules[r].apply(i)) {
+                    rules[r].hits++;
+                    changed = true;
+                }
+            }
+        }
+    }
+}
+
+// 命令列を最適化して出力し、空にする。
+void flush(void) {
+    if (optimizing(P_PEEPHOLE)) {
+        peephole();
+    }
+    for (int i = 0; i < ncode; i++) {
+        if (code[i]) printf("%s\n", code[i]);
+    }
+    ncode = 0;
+}
+
+// 規則ごとの適用回数を報告する。
+void peephole_report(void) {
+    for (int r = 0; r < NRULES; r++) {
+        opt_report(P_PEEPHOLE, "%s: %d", rules[r].name, rules[r].hits);
+    }
+}
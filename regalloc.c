@@ -0,0 +1,67 @@
+//
+//  regalloc.c
+//  tinycc
+//
+//  Created by sanluisrey on 2026/10/19.
+//
+
+#include "tinycc.h"
+
+// アドレスを取られた変数に印を付け、変数ごとの参照回数を数える。
+// ループ内の参照はループの深さに応じて重みを付ける。
+static void count_uses(Node *node, int depth, void *arg) {
+    int *uses = arg;
+    if (node->kind == ND_ADDR && node->right->kind == ND_LVAR) {
+        node->right->var->escaped = true;
+    }
+    if (node->kind == ND_LVAR) {
+        int w = 1;
+        for (int i = 0; i < depth && i < 4; i++) w *= 8;
+        uses[node->var->reg] += w;
+    }
+}
+
+// 葉関数で使うcaller-savedレジスタの番号と、同じレジスタで渡される引数の番号(なければ-1)
+// 番号はcodegen.cのVREGSの並びに合わせる(r10, r11, rsi, rcx, r8, r9)。
+static int leaf_regs[][2] = {{6, -1}, {7, -1}, {8, 1}, {9, 3}, {10, 4}, {11, 5}};
+
+// アドレスを取られないスカラー変数を参照回数の多い順にレジスタへ割り当てる。
+// 割り当てた変数にはスタック上の領域を割り当てない。
+// 葉関数では退避の要らないcaller-savedレジスタを先に使う。ただし仮引数を受け取る
+// 引数レジスタはプロローグで仮引数を移す前に上書きしないよう除く。
+// SSA形式に変換した関数はisel.cで値ごとにレジスタを割り当てるので扱わない。
+void mem2reg(Function *fn) {
+    if (fn->blocks) return;
+    int *uses = calloc(fn->nvars + 1, sizeof(int));
+    // 参照回数の集計中は変数の通し番号をregに入れておく
+    for (int i = 0; i < fn->nvars; i++) {
+        fn->vars[i]->reg = i;
+    }
+    for (Node *node = fn->code; node != NULL; node = node->next) {
+        walk(node, 0, count_uses, uses);
+    }
+    for (int i = 0; i < fn->nvars; i++) {
+        fn->vars[i]->reg = 0;
+    }
+    int regs[NVAR_REGS];
+    int nregs = 0;
+    if (is_leaf(fn)) {
+        for (int i = 0; i < NVAR_REGS - NCALLEE_REGS; i++) {
+            if (leaf_regs[i][1] >= 0 && leaf_regs[i][1] < fn->nparams) continue;
+            regs[nregs++] = leaf_regs[i][0];
+        }
+    }
+    for (int r = 1; r <= NCALLEE_REGS; r++) {
+        regs[nregs++] = r;
+    }
+    for (int k = 0; k < nregs; k++) {
+        int best = -1;
+        for (int i = 0; i < fn->nvars; i++) {
+            Var *v = fn->vars[i];
+            if (v->reg || v->escaped || !is_scalar(v->type)) continue;
+            if (best < 0 || uses[i] > uses[best]) best = i;
+        }
+        if (best < 0 || uses[best] == 0) break;
+        fn->vars[best]->reg = regs[k];
+    }
+}
@@ -0,0 +1,165 @@
+//
+//  stack.c
+//  tinycc
+//
+//  Created by sanluisrey on 2026/10/19.
+//
+
+#include "tinycc.h"
+
+// スタック上の変数の生存区間
+//
+// 関数本体のノードに前順で通し番号を振り、変数ごとに使われうる番号の区間[start, end]を求める。
+// 区間の重ならない変数はコード生成時に同じスタック領域に置く(codegen.cのlayout)。
+//   - アドレスを取られていないスカラー変数は、最初の参照から最後の参照まで。
+//     参照を含むループがあれば、次の反復で読まれうるのでループ全体に広げる。
+//     ただし変数を宣言したブロックがループの中にあれば、反復ごとに別の変数なので広げない。
+//   - 配列とアドレスを取られた変数はポインタ経由でいつ読み書きされるか分からないので、
+//     宣言したブロック全体とする。ブロックの文が最適化で置き換えられて分からなければ関数全体。
+//   - 仮引数は関数の入口で格納するので関数全体。
+
+// 番号を記録するノード(変数を宣言したブロックの最初と最後の文)
+typedef struct Mark Mark;
+struct Mark {
+    Node *node;
+    int start;      // ノードの番号(まだ訪問していなければ-1)
+    int end;        // 部分木の最後の番号
+};
+
+typedef struct Live Live;
+struct Live {
+    Function *fn;
+    int pos;        // 次に振る番号
+    int *start;     // 変数ごとの区間(参照がなければ-1)
+    int *end;
+    Mark *marks;    // ノードのアドレスによるハッシュ表
+    int nmarks;     // 表の大きさ(2の冪)
+};
+
+static Mark *find_mark(Live *l, Node *node, bool insert) {
+    if (node == NULL) return NULL;
+    unsigned long h = ((unsigned long) node >> 4) & (l->nmarks - 1);
+    for (; l->marks[h].node; h = (h + 1) & (l->nmarks - 1)) {
+        if (l->marks[h].node == node) return &l->marks[h];
+    }
+    if (!insert) return NULL;
+    l->marks[h] = (Mark) {node, -1, -1};
+    return &l->marks[h];
+}
+
+// 変数を宣言したブロックの区間を求める。分からなければ偽を返す。
+static bool extent_of(Live *l, Var *var, int *start, int *end) {
+    if (var->extent == NULL) return false;
+    Mark *first = find_mark(l, var->extent->first, false);
+    Mark *last = find_mark(l, var->extent->last, false);
+    if (first == NULL || last == NULL || first->start < 0 || last->end < 0) return false;
+    *start = first->start;
+    *end = last->end;
+    return true;
+}
+
+static void ref(Live *l, Var *var, int pos) {
+    int i = var->index;
+    if (i < 0 || i >= l->fn->nvars || l->fn->vars[i] != var) return;
+    if (l->start[i] < 0) l->start[i] = pos;
+    l->end[i] = pos;
+}
+
+// ループ[start, end]の中で参照する変数の区間をループ全体に広げる。
+static void extend(Live *l, int start, int end) {
+    for (int i = 0; i < l->fn->nvars; i++) {
+        if (l->start[i] < 0 || l->start[i] > end || l->end[i] < start) continue;
+        Mark *first = l->fn->vars[i]->extent ? find_mark(l, l->fn->vars[i]->extent->first, false) : NULL;
+        // ループの中で宣言した変数
+        if (first && first->start > start && l->start[i] >= first->start) continue;
+        if (start < l->start[i]) l->start[i] = start;
+        if (end > l->end[i]) l->end[i] = end;
+    }
+}
+
+static void visit(Live *l, Node *node) {
+    if (node == NULL) return;
+    Mark *m = find_mark(l, node, false);
+    int start = l->pos++;
+    if (m) m->start = start;
+    switch (node->kind) {
+        case ND_LVAR:
+            ref(l, node->var, start);
+            break;
+        case ND_BLOCK:
+            for (Node *p = node->right; p != NULL; p = p->next) {
+                visit(l, p);
+            }
+            break;
+        case ND_FOR:
+        case ND_WHILE:
+        case ND_VLOOP:
+            visit(l, node->initialization);
+            visit(l, node->left);
+            visit(l, node->right);
+            visit(l, node->cond);
+            visit(l, node->body);
+            visit(l, node->step);
+            for (int i = 0; i < node->nparams; i++) {
+                visit(l, node->params[i]);
+            }
+            extend(l, start, l->pos);
+            break;
+        default:
+            visit(l, node->cond);
+            visit(l, node->body);
+            visit(l, node->els);
+            visit(l, node->initialization);
+            visit(l, node->step);
+            visit(l, node->left);
+            visit(l, node->right);
+            for (int i = 0; i < node->nparams; i++) {
+                visit(l, node->params[i]);
+            }
+    }
+    if (m) m->end = l->pos;
+    l->pos++;
+}
+
+// 関数の変数ごとの生存区間をstart, end(fn->varsと同じ順)に求める。
+// 参照のない変数の区間は[-1, -1]とする。
+void live_ranges(Function *fn, int *start, int *end) {
+    Live l = {fn, 0, start, end};
+    l.nmarks = 16;
+    while (l.nmarks < fn->nvars * 4) l.nmarks *= 2;
+    l.marks = calloc(l.nmarks, sizeof(Mark));
+    for (int i = 0; i < fn->nvars; i++) {
+        Var *var = fn->vars[i];
+        var->index = i;
+        start[i] = end[i] = -1;
+        if (var->extent) {
+            find_mark(&l, var->extent->first, true);
+            find_mark(&l, var->extent->last, true);
+        }
+    }
+    mark_escaped(fn);
+    for (Node *node = fn->code; node != NULL; node = node->next) {
+        visit(&l, node);
+    }
+
+    for (int i = 0; i < fn->nvars; i++) {
+        Var *var = fn->vars[i];
+        bool param = false;
+        for (int j = 0; j < fn->nparams; j++) {
+            if (fn->params[j] == var) param = true;
+        }
+        int s, e;
+        if (param) {
+            start[i] = 0;
+            end[i] = l.pos;
+        } else if ((var->escaped || isarray(var->type)) && start[i] >= 0) {
+            if (!extent_of(&l, var, &s, &e)) {
+                s = 0;
+                e = l.pos;
+            }
+            if (s < start[i]) start[i] = s;
+            if (e > end[i]) end[i] = e;
+        }
+    }
+    free(l.marks);
+}
@@ -7,6 +7,19 @@
 
 #include "tinycc.h"
 
+// 解析中のswitch文のcaseの値
+typedef struct Switch Switch;
+struct Switch {
+    Switch *outer;
+    int *vals;
+    int nvals;
+    bool has_default;
+};
+static Switch *cur_switch;
+// breakで抜けられる文(ループとswitch)の入れ子の深さ
+static int breakable;
+// 解析中のブロックの文の範囲(ブロックで宣言したローカル変数の有効範囲)
+Extent *cur_extent;
 
 Node *new_node_if(Node *cond, Node *body, Node *els){
     Node *ret = calloc(1, sizeof(Node));
@@ -62,20 +75,46 @@ Node *new_node_block(Node *list) {
     return ret;
 }
 
+Node *new_node_switch(Node *cond, Node *body) {
+    Node *ret = calloc(1, sizeof(Node));
+    ret->kind = ND_SWITCH;
+    ret->cond = cond;
+    ret->body = body;
+    return ret;
+}
+
+Node *new_node_case(int val, bool is_default, Node *body) {
+    Node *ret = calloc(1, sizeof(Node));
+    ret->kind = ND_CASE;
+    ret->val = val;
+    ret->is_default = is_default;
+    ret->body = body;
+    return ret;
+}
+
+Node *new_node_break() {
+    Node *ret = calloc(1, sizeof(Node));
+    ret->kind = ND_BREAK;
+    return ret;
+}
+
 /*
  stmt           =   expr_stmt
                 |   cmp_stmt
                 |   select_stmt
                 |   jump_stmt
                 |   iter_stmt
+                |   labeled_stmt
  */
 Node *stmt(Token **rest){
     if (equal("{", rest)) {
         return cmp_stmt(rest);
-    } else if(equal_tk(TK_IF, rest)) {
+    } else if(equal_tk(TK_IF, rest) || equal_tk(TK_SWITCH, rest)) {
         return select_stmt(rest);
-    } else if (equal_tk(TK_RETURN, rest)) {
+    } else if (equal_tk(TK_RETURN, rest) || equal_tk(TK_BREAK, rest)) {
         return jump_stmt(rest);
+    } else if (equal_tk(TK_CASE, rest) || equal_tk(TK_DEFAULT, rest)) {
+        return labeled_stmt(rest);
     } else if (equal_tk(TK_WHILE, rest) || equal_tk(TK_FOR, rest)) {
         return iter_stmt(rest);
     } else {
@@ -96,28 +135,34 @@ Node *expr_stmt(Token **rest) {
 Node *cmp_stmt(Token **rest) {
     consume("{", rest);
     enterscope();
-    if (equal_tk(TK_TYPE, rest)) {
+    Extent *outer = cur_extent;
+    Extent *extent = cur_extent = calloc(1, sizeof(Extent));
+    if (equal_tk(TK_TYPE, rest) || equal_tk(TK_STATIC, rest)) {
         ex_decltn(rest);
     }
+    Node *ret;
     if (equal("}", rest)) {
-        if (getlevel() >= LOCAL) {
-            exitscope();
-        }
-        return new_node_block(new_node_null());
+        ret = new_node_null();
     } else {
-        Node *ret = stmt_lst(rest, *rest);
+        ret = stmt_lst(rest, *rest);
         expect("}", rest);
-        if (getlevel() >= LOCAL) {
-            exitscope();
-        }
-        return new_node_block(ret);
     }
+    if (getlevel() >= LOCAL) {
+        exitscope();
+    }
+    cur_extent = outer;
+    extent->first = ret;
+    for (extent->last = ret; extent->last && extent->last->next; extent->last = extent->last->next)
+        ;
+    return new_node_block(ret);
 }
 // stmt_lst       =   stmt
 //                |   stmt_lst stmt
 Node *stmt_lst(Token **rest, Token *tok) {
     if (at_eof(tok) || !strncmp("}", tok->str, 1)) return NULL;
-    if (tok->kind == TK_TYPE) ex_decltn(rest);
+    // 宣言が続く場合はまとめて読み進める
+    while (equal_tk(TK_TYPE, rest) || equal_tk(TK_STATIC, rest)) ex_decltn(rest);
+    if (equal("}", rest)) return NULL;
     Node *car = stmt(rest);
     Node *cdr = stmt_lst(rest, *rest);
     if(cdr != NULL) car->next = cdr;
@@ -125,7 +170,23 @@ Node *stmt_lst(Token **rest, Token *tok) {
 }
 //select_stmt    =   "if(" expr ")" stmt
 //               |   "if(" expr ")" stmt "else" stmt
+//               |   "switch(" expr ")" stmt
 Node *select_stmt(Token **rest) {
+    Token *tok = *rest;
+    if (consume_token(TK_SWITCH, rest)) {
+        expect("(", rest);
+        Node *cond = expr(rest);
+        expect(")", rest);
+        if (!iscint(cond->type)) error_tok(tok, "switch文の条件は整数でなければなりません");
+        Switch sw = {cur_switch};
+        cur_switch = &sw;
+        breakable++;
+        Node *body = stmt(rest);
+        breakable--;
+        cur_switch = sw.outer;
+        free(sw.vals);
+        return new_node_switch(cond, body);
+    }
     if (consume_token(TK_IF, rest)) {
         expect("(", rest);
         Node *cond = expr(rest);
@@ -147,7 +208,9 @@ Node *iter_stmt(Token **rest) {
         expect("(", rest);
         Node *cond = expr(rest);
         expect(")", rest);
+        breakable++;
         Node *body = stmt(rest);
+        breakable--;
         return new_node_while(cond, body);
     } else if(consume_token(TK_FOR, rest)) {
         Node *initialization = NULL;
@@ -167,14 +230,23 @@ Node *iter_stmt(Token **rest) {
             step = expr(rest);
             expect(")", rest);
         }
+        breakable++;
         body = stmt(rest);
+        breakable--;
         return new_node_for(initialization, cond, step, body);
     } else {
         return NULL;
     }
 }
 // jump_stmt      =   "return" expr? ";"
+//                |   "break" ";"
 Node *jump_stmt(Token **rest) {
+    Token *tok = *rest;
+    if (consume_token(TK_BREAK, rest)) {
+        if (breakable == 0) error_tok(tok, "breakはループかswitch文の中でしか使えません");
+        expect(";", rest);
+        return new_node_break();
+    }
     if (consume_token(TK_RETURN, rest)) {
         if (consume(";", rest)) {
             return new_node_return(new_node_null());
@@ -186,3 +258,28 @@ Node *jump_stmt(Token **rest) {
         return NULL;
     }
 }
+
+// labeled_stmt   =   "case" cnst_expr ":" stmt
+//                |   "default" ":" stmt
+Node *labeled_stmt(Token **rest) {
+    Token *tok = *rest;
+    if (consume_token(TK_CASE, rest)) {
+        if (cur_switch == NULL) error_tok(tok, "caseはswitch文の中でしか使えません");
+        int val = const_expr(rest);
+        expect(":", rest);
+        for (int i = 0; i < cur_switch->nvals; i++) {
+            if (cur_switch->vals[i] == val) error_tok(tok, "caseの値%dが重複しています", val);
+        }
+        cur_switch->vals = realloc(cur_switch->vals, (cur_switch->nvals + 1) * sizeof(int));
+        cur_switch->vals[cur_switch->nvals++] = val;
+        return new_node_case(val, false, stmt(rest));
+    } else if (consume_token(TK_DEFAULT, rest)) {
+        if (cur_switch == NULL) error_tok(tok, "defaultはswitch文の中でしか使えません");
+        if (cur_switch->has_default) error_tok(tok, "defaultが重複しています");
+        cur_switch->has_default = true;
+        expect(":", rest);
+        return new_node_case(0, true, stmt(rest));
+    } else {
+        return NULL;
+    }
+}
@@ -21,7 +21,7 @@ assert() {
   expected="$1"
   input="$2"
 
-  echo "$input" | ./tinycc - > tmp.s || exit
+  echo "$input" | ./tinycc $OPT - > tmp.s || exit
   cc -o tmp tmp.s tmp2.o
   ./tmp
   actual="$?"
@@ -40,6 +40,7 @@ assert 41 'int main(){ return  12 + 34 - 5 ; }'
 assert 47 'int main(){ return 5+6*7; }'
 assert 15 'int main(){ return 5*(9-6); }'
 assert 4 'int main(){ return (3+5)/2; }'
+assert 3 'int main(){ return 17%7; }'
 assert 10 'int main(){ return -10+20; }'
 
 assert 0 'int main(){ return 0==1; }'
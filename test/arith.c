@@ -8,9 +8,31 @@ int main() {
   ASSERT(47, 5+6*7);
   ASSERT(15, 5*(9-6));
   ASSERT(4, (3+5)/2);
+  ASSERT(-3, ({ int x; x=-7; x/2; }));
+  ASSERT(3, ({ int x; int y; x=-7; y=-2; x/y; }));
+  ASSERT(2, 17%5);
+  ASSERT(-2, ({ int x; x=-17; x%5; }));
+  ASSERT(-1, ({ int x; int y; x=-7; y=-2; x%y; }));
+  ASSERT(-14, ({ int x; x=-100; x/7; }));
+  ASSERT(-2, ({ int x; x=-100; x%7; }));
+  ASSERT(-12, ({ int x; x=-100; x/8; }));
+  ASSERT(-4, ({ int x; x=-100; x%8; }));
+  ASSERT(33, ({ int x; x=100; x/3; }));
+  ASSERT(-33, ({ int x; x=100; x/-3; }));
+  ASSERT(1, ({ int x; x=100; x%-3; }));
+  ASSERT(214748364, ({ int x; x=2147483647; x/10; }));
+  ASSERT(-214748364, ({ int x; x=-2147483647-1; x/10; }));
   ASSERT(10, -10+20);
-  //ASSERT(10, - -10);
-  //ASSERT(10, - - +10);
+  ASSERT(10, - -10);
+  ASSERT(10, - - +10);
+  ASSERT(-3, ({ int x; x=3; -x; }));
+  ASSERT(12, ({ int x; x=3; x*4; }));
+  ASSERT(12, ({ int x; x=3; 4*x; }));
+  ASSERT(3, ({ int x; x=3; x*1+0; }));
+  ASSERT(0, ({ int x; x=3; x-x; }));
+  ASSERT(0, ({ int x; x=3; x*0; }));
+  ASSERT(10, ({ int x; x=3; x+3+4; }));
+  ASSERT(-5, ({ int x; x=3; x-4-4; }));
 
   ASSERT(0, 0==1);
   ASSERT(1, 42==42);
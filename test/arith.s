@@ -0,0 +1,380 @@
+.intel_syntax noprefix
+.data
+.global .L..0
+.L..0:
+    .byte 79
+    .byte 75
+    .byte 10
+    .byte 0
+.global main
+.text
+main:
+    push rbp
+    mov rbp, rsp
+    push rbx
+    push r12
+    push r13
+    push r14
+    push r15
+    sub rsp, 8
+.main.entry:
+    mov rdi, 0
+    mov rsi, 0
+    call assert
+    movsxd rax, eax
+    mov rdi, 42
+    mov rsi, 42
+    call assert
+    movsxd rax, eax
+    mov rdi, 21
+    mov rsi, 21
+    call assert
+    movsxd rax, eax
+    mov rdi, 41
+    mov rsi, 41
+    call assert
+    movsxd rax, eax
+    mov rdi, 47
+    mov rsi, 47
+    call assert
+    movsxd rax, eax
+    mov rdi, 15
+    mov rsi, 15
+    call assert
+    movsxd rax, eax
+    mov rdi, 4
+    mov rsi, 4
+    call assert
+    movsxd rax, eax
+    mov rbx, -7
+    mov rax, -7
+    mov rdi, rax
+    sar rdi, 63
+    shr rdi, 63
+    add rax, rdi
+    sar rax, 1
+    mov rsi, rax
+    mov rdi, -3
+    call assert
+    movsxd rax, eax
+    mov r12, -7
+    mov r13, -2
+    mov rax, -7
+    mov rdi, rax
+    sar rdi, 63
+    shr rdi, 63
+    add rax, rdi
+    sar rax, 1
+    neg rax
+    mov rsi, rax
+    mov rdi, 3
+    call assert
+    movsxd rax, eax
+    mov rdi, 2
+    mov rsi, 2
+    call assert
+    movsxd rax, eax
+    mov r14, -17
+    mov rax, -17
+    mov rdx, rax
+    mov rdi, rax
+    imul rax, rax, 1717986919
+    sar rax, 32
+    sar rax, 1
+    mov rdi, rax
+    shr rdi, 63
+    add rax, rdi
+    imul rax, rax, 5
+    sub rdx, rax
+    mov rax, rdx
+    mov rsi, rax
+    mov rdi, -2
+    call assert
+    movsxd rax, eax
+    mov r15, -7
+    mov DWORD PTR [rbp-44], -2
+    mov rax, -7
+    mov rdx, rax
+    mov rdi, rax
+    sar rdi, 63
+    shr rdi, 63
+    add rax, rdi
+    sar rax, 1
+    neg rax
+    imul rax, rax, -2
+    sub rdx, rax
+    mov rax, rdx
+    mov rsi, rax
+    mov rdi, -1
+    call assert
+    movsxd rax, eax
+    mov DWORD PTR [rbp-44], -100
+    mov rax, -100
+    mov rdi, rax
+    imul rax, rax, -1840700269
+    sar rax, 32
+    add rax, rdi
+    sar rax, 2
+    mov rdi, rax
+    shr rdi, 63
+    add rax, rdi
+    mov rsi, rax
+    mov rdi, -14
+    call assert
+    movsxd rax, eax
+    mov DWORD PTR [rbp-44], -100
+    mov rax, -100
+    mov rdx, rax
+    mov rdi, rax
+    imul rax, rax, -1840700269
+    sar rax, 32
+    add rax, rdi
+    sar rax, 2
+    mov rdi, rax
+    shr rdi, 63
+    add rax, rdi
+    imul rax, rax, 7
+    sub rdx, rax
+    mov rax, rdx
+    mov rsi, rax
+    mov rdi, -2
+    call assert
+    movsxd rax, eax
+    mov DWORD PTR [rbp-44], -100
+    mov rax, -100
+    mov rdi, rax
+    sar rdi, 63
+    shr rdi, 61
+    add rax, rdi
+    sar rax, 3
+    mov rsi, rax
+    mov rdi, -12
+    call assert
+    movsxd rax, eax
+    mov DWORD PTR [rbp-44], -100
+    mov rax, -100
+    mov rdx, rax
+    mov rdi, rax
+    sar rdi, 63
+    shr rdi, 61
+    add rax, rdi
+    sar rax, 3
+    imul rax, rax, 8
+    sub rdx, rax
+    mov rax, rdx
+    mov rsi, rax
+    mov rdi, -4
+    call assert
+    movsxd rax, eax
+    mov DWORD PTR [rbp-44], 100
+    mov rax, 100
+    mov rdi, rax
+    imul rax, rax, 1431655766
+    sar rax, 32
+    mov rdi, rax
+    shr rdi, 63
+    add rax, rdi
+    mov rsi, rax
+    mov rdi, 33
+    call assert
+    movsxd rax, eax
+    mov DWORD PTR [rbp-44], 100
+    mov rax, 100
+    mov rdi, rax
+    imul rax, rax, 1431655765
+    sar rax, 32
+    sub rax, rdi
+    sar rax, 1
+    mov rdi, rax
+    shr rdi, 63
+    add rax, rdi
+    mov rsi, rax
+    mov rdi, -33
+    call assert
+    movsxd rax, eax
+    mov DWORD PTR [rbp-44], 100
+    mov rax, 100
+    mov rdx, rax
+    mov rdi, rax
+    imul rax, rax, 1431655765
+    sar rax, 32
+    sub rax, rdi
+    sar rax, 1
+    mov rdi, rax
+    shr rdi, 63
+    add rax, rdi
+    imul rax, rax, -3
+    sub rdx, rax
+    mov rax, rdx
+    mov rsi, rax
+    mov rdi, 1
+    call assert
+    movsxd rax, eax
+    mov DWORD PTR [rbp-44], 2147483647
+    mov rax, 2147483647
+    mov rdi, rax
+    imul rax, rax, 1717986919
+    sar rax, 32
+    sar rax, 2
+    mov rdi, rax
+    shr rdi, 63
+    add rax, rdi
+    mov rsi, rax
+    mov rdi, 214748364
+    call assert
+    movsxd rax, eax
+    mov DWORD PTR [rbp-44], -2147483648
+    mov rax, -2147483648
+    mov rdi, rax
+    imul rax, rax, 1717986919
+    sar rax, 32
+    sar rax, 2
+    mov rdi, rax
+    shr rdi, 63
+    add rax, rdi
+    mov rsi, rax
+    mov rdi, -214748364
+    call assert
+    movsxd rax, eax
+    mov rdi, 10
+    mov rsi, 10
+    call assert
+    movsxd rax, eax
+    mov rdi, 10
+    mov rsi, 10
+    call assert
+    movsxd rax, eax
+    mov rdi, 10
+    mov rsi, 10
+    call assert
+    movsxd rax, eax
+    mov DWORD PTR [rbp-44], 3
+    mov rax, 3
+    neg rax
+    mov rsi, rax
+    mov rdi, -3
+    call assert
+    movsxd rax, eax
+    mov DWORD PTR [rbp-44], 3
+    mov rax, 3
+    shl rax, 2
+    mov rsi, rax
+    mov rdi, 12
+    call assert
+    movsxd rax, eax
+    mov DWORD PTR [rbp-44], 3
+    mov rax, 3
+    shl rax, 2
+    mov rsi, rax
+    mov rdi, 12
+    call assert
+    movsxd rax, eax
+    mov DWORD PTR [rbp-44], 3
+    mov rax, 3
+    mov rsi, rax
+    mov rdi, 3
+    call assert
+    movsxd rax, eax
+    mov DWORD PTR [rbp-44], 3
+    xor eax, eax
+    mov rsi, rax
+    mov rdi, 0
+    call assert
+    movsxd rax, eax
+    mov DWORD PTR [rbp-44], 3
+    xor eax, eax
+    mov rsi, rax
+    mov rdi, 0
+    call assert
+    movsxd rax, eax
+    mov DWORD PTR [rbp-44], 3
+    mov rax, 3
+    add rax, 7
+    mov rsi, rax
+    mov rdi, 10
+    call assert
+    movsxd rax, eax
+    mov DWORD PTR [rbp-44], 3
+    mov rax, 3
+    add rax, -8
+    mov rsi, rax
+    mov rdi, -5
+    call assert
+    movsxd rax, eax
+    mov rdi, 0
+    mov rsi, 0
+    call assert
+    movsxd rax, eax
+    mov rdi, 1
+    mov rsi, 1
+    call assert
+    movsxd rax, eax
+    mov rdi, 1
+    mov rsi, 1
+    call assert
+    movsxd rax, eax
+    mov rdi, 0
+    mov rsi, 0
+    call assert
+    movsxd rax, eax
+    mov rdi, 1
+    mov rsi, 1
+    call assert
+    movsxd rax, eax
+    mov rdi, 0
+    mov rsi, 0
+    call assert
+    movsxd rax, eax
+    mov rdi, 0
+    mov rsi, 0
+    call assert
+    movsxd rax, eax
+    mov rdi, 1
+    mov rsi, 1
+    call assert
+    movsxd rax, eax
+    mov rdi, 1
+    mov rsi, 1
+    call assert
+    movsxd rax, eax
+    mov rdi, 0
+    mov rsi, 0
+    call assert
+    movsxd rax, eax
+    mov rdi, 1
+    mov rsi, 1
+    call assert
+    movsxd rax, eax
+    mov rdi, 0
+    mov rsi, 0
+    call assert
+    movsxd rax, eax
+    mov rdi, 0
+    mov rsi, 0
+    call assert
+    movsxd rax, eax
+    mov rdi, 1
+    mov rsi, 1
+    call assert
+    movsxd rax, eax
+    mov rdi, 1
+    mov rsi, 1
+    call assert
+    movsxd rax, eax
+    mov rdi, 0
+    mov rsi, 0
+    call assert
+    movsxd rax, eax
+    lea rdi, [rip+.L..0]
+    call printf
+    movsxd rax, eax
+    xor eax, eax
+.main.return:
+    lea rsp, [rbp-40]
+    pop r15
+    pop r14
+    pop r13
+    pop r12
+    pop rbx
+    pop rbp
+    ret
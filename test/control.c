@@ -1,5 +1,58 @@
 #include "test.h"
 
+int gl;
+int ga[8];
+int gv[37];
+char gc[41];
+
+// 入口の条件が偽に畳み込まれ、本体が自身からしか到達しないループ
+int loop_never() {
+  int i; int s;
+  s = 1; i = 9;
+  while (i < 3) i = i + 1;
+  return s + i;
+}
+
+// 本体に到達しないループ
+int loop_zero(int n) {
+  int s;
+  s = n;
+  while (0) s = s + 1;
+  for (; 0; ) s = s * 2;
+  return s;
+}
+
+// 他のループの中にある本体に到達しないループ
+int loop_nested_zero(int n) {
+  int i; int j; int s;
+  s = 0;
+  for (i = 0; i < n; i = i + 1) {
+    while (0) s = s + 100;
+    for (; 0; ) { s = s - 1; i = i + 5; }
+    j = 5;
+    while (j < 3) j = j + 1;
+    s = s + i + j;
+  }
+  return s + i;
+}
+
+// 条件が常に真のループ
+int loop_always(int n) {
+  int i;
+  i = 0;
+  while (1) { i = i + n; if (i > 20) break; }
+  for (; 1; ) { i = i - 1; if (i < 15) break; }
+  return i;
+}
+
+// returnの後の本体の残りに到達しないループ
+int loop_return(int n) {
+  int i;
+  i = 100;
+  while (n > 0) { return n + i; i = i + 1; n = n - 1; }
+  return i;
+}
+
 int main() {
     ASSERT(3, ({ if (0) 2; 3; }));
     ASSERT(3, ({ if (1-1) 2; 3; }));
@@ -13,6 +66,62 @@ int main() {
     ASSERT(10, ({ int i; i=0; while(i<10) i=i+1; i; }));
     ASSERT(10, ({ int i;i =0; while(i<10) i=i+1; i; }));
     ASSERT(55, ({ int i; i=0; int j; j=0; while(i<=10) {j=i+j; i=i+1;} j; }));
+    ASSERT(2, ({ int x; int y; x=3; y=2; if (x > y) 2; else 1; }));
+    ASSERT(1, ({ int x; int y; x=2; y=2; if (x > y) 2; else 1; }));
+    ASSERT(2, ({ int x; int y; x=2; y=2; if (x >= y) 2; else 1; }));
+    ASSERT(1, ({ int x; int y; x=1; y=2; if (x >= y) 2; else 1; }));
+    ASSERT(2, ({ int x; int y; x=1; y=2; if (x < y) 2; else 1; }));
+    ASSERT(1, ({ int x; int y; x=2; y=2; if (x < y) 2; else 1; }));
+    ASSERT(2, ({ int x; int y; x=2; y=2; if (x <= y) 2; else 1; }));
+    ASSERT(1, ({ int x; int y; x=3; y=2; if (x <= y) 2; else 1; }));
+    ASSERT(2, ({ int x; x=-1; if (x < 0) 2; else 1; }));
+    ASSERT(2, ({ int x; x=5; if (x) 2; else 1; }));
+    ASSERT(10, ({ int i; i=20; while(i>10) i=i-1; i; }));
+    ASSERT(9, ({ int i; int j; j=0; for (i=10; i>=2; i=i-1) j=j+1; j; }));
+    ASSERT(90, ({ int a[10]; int i; int s; for (i=0; i<10; i=i+1) a[i]=i; gl=2; s=0; for (i=0; i<10; i=i+1) s=s+a[i]*gl; s; }));
+    ASSERT(15, ({ int *p; int i; int s; p=&gl; gl=1; s=0; for (i=0; i<5; i=i+1) { s=s+gl; *p=gl+1; } s; }));
+    ASSERT(66, ({ int x[3][4]; int i; int j; int s; for (i=0; i<3; i=i+1) for (j=0; j<4; j=j+1) x[i][j]=i*4+j; s=0; for (i=0; i<3; i=i+1) for (j=0; j<4; j=j+1) s=s+x[i][j]; s; }));
+    ASSERT(25, ({ int a[10]; int i; int s; i=0; while (i<10) { a[i]=i; i=i+1; } s=0; i=8; while (i>=0) { s=s+a[i+1]; i=i-2; } s; }));
+    ASSERT(28, ({ int i; for (i=0; i<8; i=i+1) ga[i]=i; for (i=1; i<8; i=i+1) ga[i]=ga[i]+ga[i-1]; ga[7]; }));
+    ASSERT(3, ({ int *p; int i; int s; p=0; s=3; for (i=0; i<0; i=i+1) s=s+*p; s; }));
+    ASSERT(703, ({ int i; int s; for (i=0; i<37; i=i+1) gv[i]=i+1; s=0; for (i=0; i<37; i=i+1) s=s+gv[i]; s; }));
+    ASSERT(1406, ({ int i; int s; for (i=0; i<37; i=i+1) gv[i]=gv[i]*2; s=0; for (i=0; i<37; i=i+1) s=s+gv[i]; s; }));
+    ASSERT(12, ({ int i; int s; for (i=0; i<37; i=i+1) gv[i]=i-3; s=0; for (i=0; i<37; i=i+1) s=s+gv[i]*gv[i]; s/1000; }));
+    ASSERT(-41, ({ int i; int s; for (i=0; i<41; i=i+1) gc[i]=-i; s=0; for (i=1; i<=40; i=i+1) s=s+gc[i]; s/20; }));
+    ASSERT(14, ({ int i; int s; for (i=0; i<41; i=i+1) gc[i]=i%3; s=0; for (i=0; i<41; i=i+1) if (gc[i]==1) s=s+1; s; }));
+    ASSERT(1, ({ int i; int *p; int *q; for (i=0; i<37; i=i+1) gv[i]=i; p=gv; q=gv+2; for (i=0; i<35; i=i+1) q[i]=p[i]; gv[36]+gv[35]+gv[0]; }));
+    ASSERT(85, ({ int i; int *p; int *q; for (i=0; i<37; i=i+1) gv[i]=i; p=gv; q=gv+20; for (i=0; i<17; i=i+1) p[i]=q[i]+p[i]; gv[16]+gv[15]-gv[17]; }));
+    ASSERT(1079, ({ int i; int s; for (i=0; i<37; i=i+1) gv[i]=i*3; s=0; for (i=0; i<26; i=i+1) s=s+gv[i+1]-gv[i]+gv[i]; s+i; }));
+    ASSERT(405513, ({ int i; int s; s=0; for (i=36; i>=1; i=i-3) s=s*2+gv[i]; s+i; }));
+    ASSERT(232, ({ int i; int s; s=0; for (i=0; i!=12; i=i+2) s=s+i*i; s+i; }));
+    ASSERT(68, ({ int i; int j; int s; s=0; for (i=0; i<3; i=i+1) for (j=0; j<5; j=j+1) s=s+i*2+j; s+i+j; }));
+    ASSERT(7, ({ int x; x = 5; if (0) x = 1; x = 7; x; }));
+    ASSERT(4, ({ int x; int y; x = 1; while (0) x = 2; y = x; for (; 0; ) y = 3; x = x + y + 2; x; }));
+    ASSERT(9, ({ int x; int y; y = 3; x = y = gl = 9; y; }));
+    ASSERT(20, ({ int x; int r; x = 2; switch (x) { case 1: r = 10; break; case 2: r = 20; break; default: r = 30; } r; }));
+    ASSERT(5, ({ int r; r = 5; switch (7) { case 1: r = 1; } r; }));
+    ASSERT(541, ({ int i; int s; s = 0; for (i = -1; i < 10; i = i + 1) switch (i) { case 0: s = s + 1; case 1: s = s + 2; break; case 2: s = s + 4; break; case 3: case 4: s = s + 8; break; case 6: s = s + 16; break; default: s = s + 100; } s; }));
+    ASSERT(22, ({ int i; int s; s = 0; for (i = 0; i < 3000; i = i + 1) switch (i * 7) { case 0: s = s + 1; break; case 14: s = s + 2; break; case 700: s = s + 3; break; case 7000: s = s + 4; break; case 20993: s = s + 5; break; case -7: s = s + 6; break; case 21: s = s + 7; break; } s; }));
+    ASSERT(12, ({ int i; int s; s = 0; for (i = 0; i < 4; i = i + 1) switch (i) { case 1 < 2: s = s + 2; break; case 2 == 2 + 1: s = s + 1; break; case 3 * 4 - 9: s = s + 9; } s; }));
+    ASSERT(15, ({ int i; for (i = 0; i < 100; i = i + 1) if (i * i > 200) break; i; }));
+    ASSERT(15, ({ int i; int j; int s; s = 0; for (i = 0; i < 5; i = i + 1) for (j = 0; j < 5; j = j + 1) { if (j > i) break; s = s + 1; } s; }));
+    ASSERT(58, ({ int i; int s; s = 0; for (i = 0; i < 5; i = i + 1) { switch (i) { case 2: break; default: s = s + i; } s = s + 10; } s; }));
+    ASSERT(21, ({ int n; n = 0; while (1) { n = n + 3; if (n > 20) break; } n; }));
+    ASSERT(9, ({ int x; int y; x = 4; y = 9; if (x < y) x = y; x; }));
+    ASSERT(5, ({ int i; int n; n = 0; for (i = 0; i < 10; i = i + 1) { if (i % 2 == 0) n = n + 1; } n; }));
+    ASSERT(-10, ({ int i; int s; int d; s = 0; for (i = 0; i < 10; i = i + 1) { if (i < 5) d = -i; else d = i - 5; s = s + d - 1; } s; }));
+    ASSERT(1, ({ int x; int b; x = 3; if (x == 3) b = 1; else b = 0; b; }));
+    ASSERT(3, ({ int x; for (x = 0; x < 3; x = x + 1) if (0) x = 2; x; }));
+    ASSERT(4, ({ int x; x = 0; while (x < 4) { x = x + 1; if (x > 9) while (0) x = 7; } x; }));
+    ASSERT(5, ({ int x; x = 5; switch (x) { case 5: for (;0;) x = 1; } x; }));
+    ASSERT(0, ({ char c; int i; int s; c = 5; s = 0; for (i = 0; i < 3; i = i + 1) s = s + (i > c * 255); s; }));
+    ASSERT(0, ({ char c; int s; c = 5; s = 0; s = s + (1 > c * 255); s = s + (2 > c * 255); s = s + (3 > c * 255); s; }));
+    ASSERT(10, loop_never());
+    ASSERT(5, loop_zero(5));
+    ASSERT(30, loop_nested_zero(4));
+    ASSERT(14, loop_always(3));
+    ASSERT(103, loop_return(3));
+    ASSERT(100, loop_return(0));
     printf("OK\n");
     return 0;
 }
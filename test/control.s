@@ -0,0 +1,3530 @@
+.intel_syntax noprefix
+.data
+.global .L..0
+.L..0:
+    .byte 79
+    .byte 75
+    .byte 10
+    .byte 0
+.data
+.global gl
+gl:
+.zero 4
+.data
+.global ga
+ga:
+.zero 32
+.data
+.global gv
+gv:
+.zero 148
+.data
+.global gc
+gc:
+.zero 328
+.global loop_never
+.text
+loop_never:
+.loop_never.entry:
+    mov r11, 1
+    mov r10, 9
+    mov rax, r10
+    cmp rax, 3
+    jge .Lend1
+    .p2align 4
+.Lbegin1:
+    mov rax, r10
+    add rax, 1
+    movsxd r10, eax
+    mov rax, r10
+    cmp rax, 3
+    jl .Lbegin1
+.Lend1:
+    mov rax, r10
+    mov rdi, rax
+    mov rax, r11
+    add rax, rdi
+.loop_never.return:
+    ret
+.global loop_zero
+.text
+loop_zero:
+    movsxd r11, edi
+.loop_zero.entry:
+    mov rax, r11
+    movsxd r10, eax
+    mov rax, r10
+.loop_zero.return:
+    ret
+.global loop_nested_zero
+.text
+loop_nested_zero:
+    movsxd rcx, edi
+.loop_nested_zero.entry:
+    mov rsi, 0
+    mov r11, 0
+    mov rax, rcx
+    mov rdi, rax
+    mov rax, r11
+    cmp rax, rdi
+    jge .Lend2
+    .p2align 4
+.Lbegin2:
+    mov r10, 5
+    mov rax, r10
+    cmp rax, 3
+    jge .Lend3
+    .p2align 4
+.Lbegin3:
+    mov rax, r10
+    add rax, 1
+    movsxd r10, eax
+    mov rax, r10
+    cmp rax, 3
+    jl .Lbegin3
+.Lend3:
+    mov rax, r10
+    push rax
+    mov rax, r11
+    mov rdi, rax
+    mov rax, rsi
+    add rax, rdi
+    pop rdi
+    add rax, rdi
+    movsxd rsi, eax
+    mov rax, r11
+    add rax, 1
+    movsxd r11, eax
+    mov rax, rcx
+    mov rdi, rax
+    mov rax, r11
+    cmp rax, rdi
+    jl .Lbegin2
+.Lend2:
+    mov rax, r11
+    mov rdi, rax
+    mov rax, rsi
+    add rax, rdi
+.loop_nested_zero.return:
+    ret
+.global loop_always
+.text
+loop_always:
+    movsxd r11, edi
+.loop_always.entry:
+    mov r10, 0
+    .p2align 4
+.Lbegin4:
+    mov rax, r11
+    mov rdi, rax
+    mov rax, r10
+    add rax, rdi
+    movsxd r10, eax
+    mov rax, r10
+    cmp rax, 20
+    jle .Lelse5
+    jmp .Lend4
+.Lelse5:
+.Lend5:
+    jmp .Lbegin4
+.Lend4:
+    .p2align 4
+.Lbegin6:
+    mov rax, r10
+    add rax, -1
+    movsxd r10, eax
+    mov rax, r10
+    cmp rax, 15
+    jge .Lelse7
+    jmp .Lend6
+.Lelse7:
+.Lend7:
+    jmp .Lbegin6
+.Lend6:
+    mov rax, r10
+.loop_always.return:
+    ret
+.global loop_return
+.text
+loop_return:
+    movsxd r10, edi
+.loop_return.entry:
+    mov r11, 100
+    mov rax, r10
+    cmp rax, 0
+    jle .Lend8
+    .p2align 4
+.Lbegin8:
+    mov rax, r11
+    mov rdi, rax
+    mov rax, r10
+    add rax, rdi
+    jmp .loop_return.return
+    mov rax, r10
+    cmp rax, 0
+    jg .Lbegin8
+.Lend8:
+    mov rax, r11
+.loop_return.return:
+    ret
+.global main
+.text
+main:
+    push rbp
+    mov rbp, rsp
+    push rbx
+    push r12
+    push r13
+    push r14
+    push r15
+    sub rsp, 72
+    mov rax, 3
+    mov rsi, rax
+    mov rdi, 3
+    call assert
+    movsxd rax, eax
+    mov rax, 3
+    mov rsi, rax
+    mov rdi, 3
+    call assert
+    movsxd rax, eax
+    mov rax, 4
+    mov DWORD PTR [rbp-44], eax
+    movsxd rax, eax
+    mov rsi, rax
+    mov rdi, 4
+    call assert
+    movsxd rax, eax
+    mov rax, 3
+    mov rsi, rax
+    mov rdi, 3
+    call assert
+    movsxd rax, eax
+    mov DWORD PTR [rbp-48], 0
+    inc DWORD PTR [rbp-48]
+    add DWORD PTR [rbp-48], 2
+    add DWORD PTR [rbp-48], 3
+    add DWORD PTR [rbp-48], 4
+    add DWORD PTR [rbp-48], 5
+    add DWORD PTR [rbp-48], 6
+    add DWORD PTR [rbp-48], 7
+    add DWORD PTR [rbp-48], 8
+    add DWORD PTR [rbp-48], 9
+    add DWORD PTR [rbp-48], 10
+    mov rax, 11
+    mov DWORD PTR [rbp-44], eax
+    movsxd rax, DWORD PTR [rbp-48]
+    mov rsi, rax
+    mov rdi, 55
+    call assert
+    movsxd rax, eax
+    mov DWORD PTR [rbp-44], 0
+    xor eax, eax
+    cmp rax, 10
+    jge .Lend9
+    .p2align 4
+.Lbegin9:
+    movsxd rax, DWORD PTR [rbp-44]
+    add rax, 1
+    mov DWORD PTR [rbp-44], eax
+    movsxd rax, eax
+    cmp rax, 10
+    jl .Lbegin9
+.Lend9:
+    movsxd rax, DWORD PTR [rbp-44]
+    mov rsi, rax
+    mov rdi, 10
+    call assert
+    movsxd rax, eax
+    mov rax, 3
+    mov rsi, rax
+    mov rdi, 3
+    call assert
+    movsxd rax, eax
+    mov rax, 5
+    mov rsi, rax
+    mov rdi, 5
+    call assert
+    movsxd rax, eax
+    mov DWORD PTR [rbp-44], 0
+    xor eax, eax
+    cmp rax, 10
+    jge .Lend10
+    .p2align 4
+.Lbegin10:
+    movsxd rax, DWORD PTR [rbp-44]
+    add rax, 1
+    mov DWORD PTR [rbp-44], eax
+    movsxd rax, eax
+    cmp rax, 10
+    jl .Lbegin10
+.Lend10:
+    movsxd rax, DWORD PTR [rbp-44]
+    mov rsi, rax
+    mov rdi, 10
+    call assert
+    movsxd rax, eax
+    mov DWORD PTR [rbp-44], 0
+    xor eax, eax
+    cmp rax, 10
+    jge .Lend11
+    .p2align 4
+.Lbegin11:
+    movsxd rax, DWORD PTR [rbp-44]
+    add rax, 1
+    mov DWORD PTR [rbp-44], eax
+    movsxd rax, eax
+    cmp rax, 10
+    jl .Lbegin11
+.Lend11:
+    movsxd rax, DWORD PTR [rbp-44]
+    mov rsi, rax
+    mov rdi, 10
+    call assert
+    movsxd rax, eax
+    mov DWORD PTR [rbp-44], 0
+    mov DWORD PTR [rbp-48], 0
+    movsxd rax, DWORD PTR [rbp-44]
+    cmp rax, 10
+    jg .Lend12
+    .p2align 4
+.Lbegin12:
+    movsxd rax, DWORD PTR [rbp-44]
+    add DWORD PTR [rbp-48], eax
+    movsxd rax, DWORD PTR [rbp-44]
+    add rax, 1
+    mov DWORD PTR [rbp-44], eax
+    movsxd rax, eax
+    cmp rax, 10
+    jle .Lbegin12
+.Lend12:
+    movsxd rax, DWORD PTR [rbp-48]
+    mov rsi, rax
+    mov rdi, 55
+    call assert
+    movsxd rax, eax
+    mov DWORD PTR [rbp-44], 3
+    mov DWORD PTR [rbp-44], 2
+    mov rax, 3
+    cmp rax, 2
+    jle .Lelse13
+    mov rax, 2
+    jmp .Lend13
+.Lelse13:
+    mov rax, 1
+.Lend13:
+    mov rsi, rax
+    mov rdi, 2
+    call assert
+    movsxd rax, eax
+    mov DWORD PTR [rbp-44], 2
+    mov DWORD PTR [rbp-44], 2
+    mov rax, 2
+    cmp rax, 2
+    jle .Lelse14
+    mov rax, 2
+    jmp .Lend14
+.Lelse14:
+    mov rax, 1
+.Lend14:
+    mov rsi, rax
+    mov rdi, 1
+    call assert
+    movsxd rax, eax
+    mov DWORD PTR [rbp-44], 2
+    mov DWORD PTR [rbp-44], 2
+    mov rax, 2
+    cmp rax, 2
+    jl .Lelse15
+    mov rax, 2
+    jmp .Lend15
+.Lelse15:
+    mov rax, 1
+.Lend15:
+    mov rsi, rax
+    mov rdi, 2
+    call assert
+    movsxd rax, eax
+    mov DWORD PTR [rbp-44], 1
+    mov DWORD PTR [rbp-44], 2
+    mov rax, 1
+    cmp rax, 2
+    jl .Lelse16
+    mov rax, 2
+    jmp .Lend16
+.Lelse16:
+    mov rax, 1
+.Lend16:
+    mov rsi, rax
+    mov rdi, 1
+    call assert
+    movsxd rax, eax
+    mov DWORD PTR [rbp-44], 1
+    mov DWORD PTR [rbp-44], 2
+    mov rax, 1
+    cmp rax, 2
+    jge .Lelse17
+    mov rax, 2
+    jmp .Lend17
+.Lelse17:
+    mov rax, 1
+.Lend17:
+    mov rsi, rax
+    mov rdi, 2
+    call assert
+    movsxd rax, eax
+    mov DWORD PTR [rbp-44], 2
+    mov DWORD PTR [rbp-44], 2
+    mov rax, 2
+    cmp rax, 2
+    jge .Lelse18
+    mov rax, 2
+    jmp .Lend18
+.Lelse18:
+    mov rax, 1
+.Lend18:
+    mov rsi, rax
+    mov rdi, 1
+    call assert
+    movsxd rax, eax
+    mov DWORD PTR [rbp-44], 2
+    mov DWORD PTR [rbp-44], 2
+    mov rax, 2
+    cmp rax, 2
+    jg .Lelse19
+    mov rax, 2
+    jmp .Lend19
+.Lelse19:
+    mov rax, 1
+.Lend19:
+    mov rsi, rax
+    mov rdi, 2
+    call assert
+    movsxd rax, eax
+    mov DWORD PTR [rbp-44], 3
+    mov DWORD PTR [rbp-44], 2
+    mov rax, 3
+    cmp rax, 2
+    jg .Lelse20
+    mov rax, 2
+    jmp .Lend20
+.Lelse20:
+    mov rax, 1
+.Lend20:
+    mov rsi, rax
+    mov rdi, 1
+    call assert
+    movsxd rax, eax
+    mov DWORD PTR [rbp-44], -1
+    mov rax, -1
+    cmp rax, 0
+    jge .Lelse21
+    mov rax, 2
+    jmp .Lend21
+.Lelse21:
+    mov rax, 1
+.Lend21:
+    mov rsi, rax
+    mov rdi, 2
+    call assert
+    movsxd rax, eax
+    mov DWORD PTR [rbp-44], 5
+    mov rax, 2
+    mov rsi, rax
+    mov rdi, 2
+    call assert
+    movsxd rax, eax
+    mov DWORD PTR [rbp-44], 20
+    mov rax, 20
+    cmp rax, 10
+    jle .Lend22
+    .p2align 4
+.Lbegin22:
+    movsxd rax, DWORD PTR [rbp-44]
+    add rax, -1
+    mov DWORD PTR [rbp-44], eax
+    movsxd rax, eax
+    cmp rax, 10
+    jg .Lbegin22
+.Lend22:
+    movsxd rax, DWORD PTR [rbp-44]
+    mov rsi, rax
+    mov rdi, 10
+    call assert
+    movsxd rax, eax
+    mov DWORD PTR [rbp-48], 0
+    inc DWORD PTR [rbp-48]
+    inc DWORD PTR [rbp-48]
+    inc DWORD PTR [rbp-48]
+    inc DWORD PTR [rbp-48]
+    inc DWORD PTR [rbp-48]
+    inc DWORD PTR [rbp-48]
+    inc DWORD PTR [rbp-48]
+    inc DWORD PTR [rbp-48]
+    inc DWORD PTR [rbp-48]
+    mov rax, 1
+    mov DWORD PTR [rbp-44], eax
+    movsxd rax, DWORD PTR [rbp-48]
+    mov rsi, rax
+    mov rdi, 9
+    call assert
+    movsxd rax, eax
+    mov DWORD PTR [rbp-88], 0
+    mov DWORD PTR [rbp-84], 1
+    mov DWORD PTR [rbp-80], 2
+    mov DWORD PTR [rbp-76], 3
+    mov DWORD PTR [rbp-72], 4
+    mov DWORD PTR [rbp-68], 5
+    mov DWORD PTR [rbp-64], 6
+    mov DWORD PTR [rbp-60], 7
+    mov DWORD PTR [rbp-56], 8
+    mov rax, 9
+    mov DWORD PTR [rbp-52], eax
+    mov DWORD PTR [rip+gl], 2
+    mov DWORD PTR [rbp-96], 0
+    mov DWORD PTR [rbp-92], 0
+    movsxd rax, DWORD PTR [rip+gl]
+    movd xmm8, eax
+    pshufd xmm8, xmm8, 0
+    pxor xmm14, xmm14
+    mov rax, 10
+    mov rdi, rax
+    movsxd rax, DWORD PTR [rbp-92]
+    add rax, 3
+    cmp rax, rdi
+    jge .Lvend23
+    .p2align 4
+.Lvbegin23:
+    movsxd rax, DWORD PTR [rbp-92]
+    movdqu xmm0, XMMWORD PTR [rbp+rax*4-88]
+    movdqa xmm1, xmm8
+    movdqa xmm2, xmm0
+    pmuludq xmm2, xmm1
+    psrlq xmm0, 32
+    psrlq xmm1, 32
+    pmuludq xmm0, xmm1
+    pshufd xmm2, xmm2, 8
+    pshufd xmm0, xmm0, 8
+    punpckldq xmm2, xmm0
+    movdqa xmm0, xmm2
+    paddd xmm14, xmm0
+    add DWORD PTR [rbp-92], 4
+    mov rax, 10
+    mov rdi, rax
+    movsxd rax, DWORD PTR [rbp-92]
+    add rax, 3
+    cmp rax, rdi
+    jl .Lvbegin23
+.Lvend23:
+    pshufd xmm0, xmm14, 78
+    paddd xmm14, xmm0
+    pshufd xmm0, xmm14, 177
+    paddd xmm14, xmm0
+    movd eax, xmm14
+    add DWORD PTR [rbp-96], eax
+    movsxd rax, DWORD PTR [rip+gl]
+    mov DWORD PTR [rbp-100], eax
+    movsxd rax, DWORD PTR [rbp-92]
+    shl rax, 2
+    mov rdi, rax
+    lea rax, [rbp-88]
+    add rax, rdi
+    mov QWORD PTR [rbp-48], rax
+    movsxd rax, DWORD PTR [rbp-92]
+    cmp rax, 10
+    jge .Lend24
+    .p2align 4
+.Lbegin24:
+    movsxd rax, DWORD PTR [rbp-100]
+    mov rdi, rax
+    mov rax, QWORD PTR [rbp-48]
+    movsxd rax, DWORD PTR [rax]
+    imul rax, rdi
+    add DWORD PTR [rbp-96], eax
+    mov rax, QWORD PTR [rbp-48]
+    add rax, 4
+    mov QWORD PTR [rbp-48], rax
+    inc DWORD PTR [rbp-92]
+    movsxd rax, DWORD PTR [rbp-92]
+    cmp rax, 10
+    jl .Lbegin24
+.Lend24:
+    movsxd rax, DWORD PTR [rbp-96]
+    mov rsi, rax
+    mov rdi, 90
+    call assert
+    movsxd rax, eax
+    lea rax, [rip+gl]
+    mov QWORD PTR [rbp-48], rax
+    mov DWORD PTR [rip+gl], 1
+    mov DWORD PTR [rbp-52], 0
+    movsxd rax, DWORD PTR [rip+gl]
+    mov DWORD PTR [rbp-56], eax
+    movsxd rax, eax
+    add DWORD PTR [rbp-52], eax
+    mov rax, QWORD PTR [rbp-48]
+    lea rax, [rax]
+    mov rdi, rax
+    movsxd rax, DWORD PTR [rbp-56]
+    add rax, 1
+    mov DWORD PTR [rdi], eax
+    movsxd rax, DWORD PTR [rip+gl]
+    mov DWORD PTR [rbp-56], eax
+    movsxd rax, eax
+    add DWORD PTR [rbp-52], eax
+    mov rax, QWORD PTR [rbp-48]
+    lea rax, [rax]
+    mov rdi, rax
+    movsxd rax, DWORD PTR [rbp-56]
+    add rax, 1
+    mov DWORD PTR [rdi], eax
+    movsxd rax, DWORD PTR [rip+gl]
+    mov DWORD PTR [rbp-56], eax
+    movsxd rax, eax
+    add DWORD PTR [rbp-52], eax
+    mov rax, QWORD PTR [rbp-48]
+    lea rax, [rax]
+    mov rdi, rax
+    movsxd rax, DWORD PTR [rbp-56]
+    add rax, 1
+    mov DWORD PTR [rdi], eax
+    movsxd rax, DWORD PTR [rip+gl]
+    mov DWORD PTR [rbp-56], eax
+    movsxd rax, eax
+    add DWORD PTR [rbp-52], eax
+    mov rax, QWORD PTR [rbp-48]
+    lea rax, [rax]
+    mov rdi, rax
+    movsxd rax, DWORD PTR [rbp-56]
+    add rax, 1
+    mov DWORD PTR [rdi], eax
+    movsxd rax, DWORD PTR [rip+gl]
+    mov DWORD PTR [rbp-56], eax
+    movsxd rax, eax
+    add DWORD PTR [rbp-52], eax
+    mov rax, QWORD PTR [rbp-48]
+    lea rax, [rax]
+    mov rdi, rax
+    movsxd rax, DWORD PTR [rbp-56]
+    add rax, 1
+    mov DWORD PTR [rdi], eax
+    mov rax, 5
+    mov DWORD PTR [rbp-44], eax
+    movsxd rax, DWORD PTR [rbp-52]
+    mov rsi, rax
+    mov rdi, 15
+    call assert
+    movsxd rax, eax
+    mov DWORD PTR [rbp-108], 0
+    xor eax, eax
+    shl rax, 2
+    shl rax, 2
+    mov rdi, rax
+    lea rax, [rbp-104]
+    add rax, rdi
+    mov QWORD PTR [rbp-56], rax
+    movsxd rax, DWORD PTR [rbp-108]
+    cmp rax, 3
+    jge .Lend25
+    .p2align 4
+.Lbegin25:
+    mov rax, QWORD PTR [rbp-56]
+    mov QWORD PTR [rbp-48], rax
+    mov rax, QWORD PTR [rbp-56]
+    lea rax, [rax]
+    mov rdi, rax
+    movsxd rax, DWORD PTR [rbp-108]
+    shl rax, 2
+    mov DWORD PTR [rdi], eax
+    mov rax, QWORD PTR [rbp-56]
+    lea rax, [rax+4]
+    mov rdi, rax
+    movsxd rax, DWORD PTR [rbp-108]
+    shl rax, 2
+    add rax, 1
+    mov DWORD PTR [rdi], eax
+    mov rax, QWORD PTR [rbp-56]
+    lea rax, [rax+8]
+    mov rdi, rax
+    movsxd rax, DWORD PTR [rbp-108]
+    shl rax, 2
+    add rax, 2
+    mov DWORD PTR [rdi], eax
+    mov rax, QWORD PTR [rbp-56]
+    lea rax, [rax+12]
+    mov rdi, rax
+    movsxd rax, DWORD PTR [rbp-108]
+    shl rax, 2
+    add rax, 3
+    mov DWORD PTR [rdi], eax
+    mov rax, QWORD PTR [rbp-56]
+    add rax, 16
+    mov QWORD PTR [rbp-56], rax
+    inc DWORD PTR [rbp-108]
+    movsxd rax, DWORD PTR [rbp-108]
+    cmp rax, 3
+    jl .Lbegin25
+.Lend25:
+    mov DWORD PTR [rbp-56], 0
+    mov DWORD PTR [rbp-52], 0
+    pxor xmm14, xmm14
+    mov rax, 4
+    mov rdi, rax
+    movsxd rax, DWORD PTR [rbp-52]
+    add rax, 3
+    cmp rax, rdi
+    jge .Lvend26
+    .p2align 4
+.Lvbegin26:
+    movsxd rax, DWORD PTR [rbp-52]
+    movdqu xmm0, XMMWORD PTR [rbp+rax*4-104]
+    paddd xmm14, xmm0
+    add DWORD PTR [rbp-52], 4
+    mov rax, 4
+    mov rdi, rax
+    movsxd rax, DWORD PTR [rbp-52]
+    add rax, 3
+    cmp rax, rdi
+    jl .Lvbegin26
+.Lvend26:
+    pshufd xmm0, xmm14, 78
+    paddd xmm14, xmm0
+    pshufd xmm0, xmm14, 177
+    paddd xmm14, xmm0
+    movd eax, xmm14
+    add DWORD PTR [rbp-56], eax
+    movsxd rax, DWORD PTR [rbp-52]
+    shl rax, 2
+    mov rdi, rax
+    lea rax, [rbp-104]
+    add rax, rdi
+    mov QWORD PTR [rbp-48], rax
+    movsxd rax, DWORD PTR [rbp-52]
+    cmp rax, 4
+    jge .Lend27
+    .p2align 4
+.Lbegin27:
+    mov rax, QWORD PTR [rbp-48]
+    movsxd rax, DWORD PTR [rax]
+    add DWORD PTR [rbp-56], eax
+    mov rax, QWORD PTR [rbp-48]
+    add rax, 4
+    mov QWORD PTR [rbp-48], rax
+    inc DWORD PTR [rbp-52]
+    movsxd rax, DWORD PTR [rbp-52]
+    cmp rax, 4
+    jl .Lbegin27
+.Lend27:
+    mov DWORD PTR [rbp-52], 0
+    pxor xmm14, xmm14
+    mov rax, 4
+    mov rdi, rax
+    movsxd rax, DWORD PTR [rbp-52]
+    add rax, 3
+    cmp rax, rdi
+    jge .Lvend28
+    .p2align 4
+.Lvbegin28:
+    movsxd rax, DWORD PTR [rbp-52]
+    movdqu xmm0, XMMWORD PTR [rbp+rax*4-88]
+    paddd xmm14, xmm0
+    add DWORD PTR [rbp-52], 4
+    mov rax, 4
+    mov rdi, rax
+    movsxd rax, DWORD PTR [rbp-52]
+    add rax, 3
+    cmp rax, rdi
+    jl .Lvbegin28
+.Lvend28:
+    pshufd xmm0, xmm14, 78
+    paddd xmm14, xmm0
+    pshufd xmm0, xmm14, 177
+    paddd xmm14, xmm0
+    movd eax, xmm14
+    add DWORD PTR [rbp-56], eax
+    movsxd rax, DWORD PTR [rbp-52]
+    shl rax, 2
+    mov rdi, rax
+    lea rax, [rbp-88]
+    add rax, rdi
+    mov QWORD PTR [rbp-48], rax
+    movsxd rax, DWORD PTR [rbp-52]
+    cmp rax, 4
+    jge .Lend29
+    .p2align 4
+.Lbegin29:
+    mov rax, QWORD PTR [rbp-48]
+    movsxd rax, DWORD PTR [rax]
+    add DWORD PTR [rbp-56], eax
+    mov rax, QWORD PTR [rbp-48]
+    add rax, 4
+    mov QWORD PTR [rbp-48], rax
+    inc DWORD PTR [rbp-52]
+    movsxd rax, DWORD PTR [rbp-52]
+    cmp rax, 4
+    jl .Lbegin29
+.Lend29:
+    mov DWORD PTR [rbp-52], 0
+    pxor xmm14, xmm14
+    mov rax, 4
+    mov rdi, rax
+    movsxd rax, DWORD PTR [rbp-52]
+    add rax, 3
+    cmp rax, rdi
+    jge .Lvend30
+    .p2align 4
+.Lvbegin30:
+    movsxd rax, DWORD PTR [rbp-52]
+    movdqu xmm0, XMMWORD PTR [rbp+rax*4-72]
+    paddd xmm14, xmm0
+    add DWORD PTR [rbp-52], 4
+    mov rax, 4
+    mov rdi, rax
+    movsxd rax, DWORD PTR [rbp-52]
+    add rax, 3
+    cmp rax, rdi
+    jl .Lvbegin30
+.Lvend30:
+    pshufd xmm0, xmm14, 78
+    paddd xmm14, xmm0
+    pshufd xmm0, xmm14, 177
+    paddd xmm14, xmm0
+    movd eax, xmm14
+    add DWORD PTR [rbp-56], eax
+    movsxd rax, DWORD PTR [rbp-52]
+    shl rax, 2
+    mov rdi, rax
+    lea rax, [rbp-72]
+    add rax, rdi
+    mov QWORD PTR [rbp-48], rax
+    movsxd rax, DWORD PTR [rbp-52]
+    cmp rax, 4
+    jge .Lend31
+    .p2align 4
+.Lbegin31:
+    mov rax, QWORD PTR [rbp-48]
+    movsxd rax, DWORD PTR [rax]
+    add DWORD PTR [rbp-56], eax
+    mov rax, QWORD PTR [rbp-48]
+    add rax, 4
+    mov QWORD PTR [rbp-48], rax
+    inc DWORD PTR [rbp-52]
+    movsxd rax, DWORD PTR [rbp-52]
+    cmp rax, 4
+    jl .Lbegin31
+.Lend31:
+    mov rax, 3
+    mov DWORD PTR [rbp-108], eax
+    movsxd rax, DWORD PTR [rbp-56]
+    mov rsi, rax
+    mov rdi, 66
+    call assert
+    movsxd rax, eax
+    mov DWORD PTR [rbp-92], 0
+    xor eax, eax
+    shl rax, 2
+    mov rdi, rax
+    lea rax, [rbp-88]
+    add rax, rdi
+    mov QWORD PTR [rbp-48], rax
+    movsxd rax, DWORD PTR [rbp-92]
+    cmp rax, 10
+    jge .Lend32
+    .p2align 4
+.Lbegin32:
+    mov rax, QWORD PTR [rbp-48]
+    lea rax, [rax]
+    mov rdi, rax
+    movsxd rax, DWORD PTR [rbp-92]
+    mov DWORD PTR [rdi], eax
+    inc DWORD PTR [rbp-92]
+    mov rax, QWORD PTR [rbp-48]
+    add rax, 4
+    mov QWORD PTR [rbp-48], rax
+    movsxd rax, DWORD PTR [rbp-92]
+    cmp rax, 10
+    jl .Lbegin32
+.Lend32:
+    mov DWORD PTR [rbp-96], 0
+    mov DWORD PTR [rbp-92], 8
+    mov rax, 8
+    shl rax, 2
+    mov rdi, rax
+    lea rax, [rbp-88]
+    add rax, rdi
+    mov QWORD PTR [rbp-48], rax
+    movsxd rax, DWORD PTR [rbp-92]
+    cmp rax, 0
+    jl .Lend33
+    .p2align 4
+.Lbegin33:
+    mov rax, QWORD PTR [rbp-48]
+    movsxd rax, DWORD PTR [rax+4]
+    add DWORD PTR [rbp-96], eax
+    add DWORD PTR [rbp-92], -2
+    mov rax, QWORD PTR [rbp-48]
+    add rax, -8
+    mov QWORD PTR [rbp-48], rax
+    movsxd rax, DWORD PTR [rbp-92]
+    cmp rax, 0
+    jge .Lbegin33
+.Lend33:
+    movsxd rax, DWORD PTR [rbp-96]
+    mov rsi, rax
+    mov rdi, 25
+    call assert
+    movsxd rax, eax
+    mov DWORD PTR [rip+ga], 0
+    mov DWORD PTR [rip+ga+4], 1
+    mov DWORD PTR [rip+ga+8], 2
+    mov DWORD PTR [rip+ga+12], 3
+    mov DWORD PTR [rip+ga+16], 4
+    mov DWORD PTR [rip+ga+20], 5
+    mov DWORD PTR [rip+ga+24], 6
+    mov rax, 7
+    mov DWORD PTR [rip+ga+28], eax
+    mov DWORD PTR [rbp-84], 1
+    mov rax, 1
+    shl rax, 2
+    mov rdi, rax
+    lea rax, [rip+ga]
+    add rax, rdi
+    mov QWORD PTR [rbp-80], rax
+    movsxd rax, DWORD PTR [rbp-84]
+    add rax, 3
+    cmp rax, 8
+    jge .Lend34
+    .p2align 4
+.Lbegin34:
+    mov rax, QWORD PTR [rbp-80]
+    mov QWORD PTR [rbp-72], rax
+    mov rax, QWORD PTR [rbp-80]
+    movsxd rax, DWORD PTR [rax-4]
+    push rax
+    mov rax, QWORD PTR [rbp-80]
+    pop rdx
+    add DWORD PTR [rax], edx
+    mov rax, QWORD PTR [rbp-80]
+    add rax, 4
+    mov QWORD PTR [rbp-48], rax
+    mov rax, QWORD PTR [rbp-80]
+    movsxd rax, DWORD PTR [rax]
+    push rax
+    mov rax, QWORD PTR [rbp-48]
+    pop rdx
+    add DWORD PTR [rax], edx
+    mov rax, QWORD PTR [rbp-80]
+    add rax, 8
+    mov QWORD PTR [rbp-56], rax
+    mov rax, QWORD PTR [rbp-48]
+    movsxd rax, DWORD PTR [rax]
+    push rax
+    mov rax, QWORD PTR [rbp-56]
+    pop rdx
+    add DWORD PTR [rax], edx
+    mov rax, QWORD PTR [rbp-80]
+    add rax, 12
+    mov QWORD PTR [rbp-64], rax
+    mov rax, QWORD PTR [rbp-56]
+    movsxd rax, DWORD PTR [rax]
+    push rax
+    mov rax, QWORD PTR [rbp-64]
+    pop rdx
+    add DWORD PTR [rax], edx
+    mov rax, QWORD PTR [rbp-80]
+    add rax, 16
+    mov QWORD PTR [rbp-80], rax
+    add DWORD PTR [rbp-84], 4
+    movsxd rax, DWORD PTR [rbp-84]
+    add rax, 3
+    cmp rax, 8
+    jl .Lbegin34
+.Lend34:
+    movsxd rax, DWORD PTR [rbp-84]
+    shl rax, 2
+    mov rdi, rax
+    lea rax, [rip+ga]
+    add rax, rdi
+    mov QWORD PTR [rbp-48], rax
+    movsxd rax, DWORD PTR [rbp-84]
+    cmp rax, 8
+    jge .Lend35
+    .p2align 4
+.Lbegin35:
+    mov rax, QWORD PTR [rbp-48]
+    movsxd rax, DWORD PTR [rax-4]
+    push rax
+    mov rax, QWORD PTR [rbp-48]
+    pop rdx
+    add DWORD PTR [rax], edx
+    mov rax, QWORD PTR [rbp-48]
+    add rax, 4
+    mov QWORD PTR [rbp-48], rax
+    inc DWORD PTR [rbp-84]
+    movsxd rax, DWORD PTR [rbp-84]
+    cmp rax, 8
+    jl .Lbegin35
+.Lend35:
+    movsxd rax, DWORD PTR [rip+ga+28]
+    mov rsi, rax
+    mov rdi, 28
+    call assert
+    movsxd rax, eax
+    mov QWORD PTR [rbp-48], 0
+    mov DWORD PTR [rbp-48], 3
+    xor eax, eax
+    mov DWORD PTR [rbp-44], eax
+    movsxd rax, DWORD PTR [rbp-48]
+    mov rsi, rax
+    mov rdi, 3
+    call assert
+    movsxd rax, eax
+    mov DWORD PTR [rbp-60], 0
+    xor eax, eax
+    shl rax, 2
+    mov rdi, rax
+    lea rax, [rip+gv]
+    add rax, rdi
+    mov QWORD PTR [rbp-56], rax
+    movsxd rax, DWORD PTR [rbp-60]
+    add rax, 3
+    cmp rax, 37
+    jge .Lend36
+    .p2align 4
+.Lbegin36:
+    mov rax, QWORD PTR [rbp-56]
+    mov QWORD PTR [rbp-48], rax
+    mov rax, QWORD PTR [rbp-56]
+    lea rax, [rax]
+    mov rdi, rax
+    movsxd rax, DWORD PTR [rbp-60]
+    add rax, 1
+    mov DWORD PTR [rdi], eax
+    mov rax, QWORD PTR [rbp-56]
+    lea rax, [rax+4]
+    mov rdi, rax
+    movsxd rax, DWORD PTR [rbp-60]
+    add rax, 2
+    mov DWORD PTR [rdi], eax
+    mov rax, QWORD PTR [rbp-56]
+    lea rax, [rax+8]
+    mov rdi, rax
+    movsxd rax, DWORD PTR [rbp-60]
+    add rax, 3
+    mov DWORD PTR [rdi], eax
+    mov rax, QWORD PTR [rbp-56]
+    lea rax, [rax+12]
+    mov rdi, rax
+    movsxd rax, DWORD PTR [rbp-60]
+    add rax, 4
+    mov DWORD PTR [rdi], eax
+    mov rax, QWORD PTR [rbp-56]
+    add rax, 16
+    mov QWORD PTR [rbp-56], rax
+    add DWORD PTR [rbp-60], 4
+    movsxd rax, DWORD PTR [rbp-60]
+    add rax, 3
+    cmp rax, 37
+    jl .Lbegin36
+.Lend36:
+    movsxd rax, DWORD PTR [rbp-60]
+    shl rax, 2
+    mov rdi, rax
+    lea rax, [rip+gv]
+    add rax, rdi
+    mov QWORD PTR [rbp-48], rax
+    movsxd rax, DWORD PTR [rbp-60]
+    cmp rax, 37
+    jge .Lend37
+    .p2align 4
+.Lbegin37:
+    mov rax, QWORD PTR [rbp-48]
+    lea rax, [rax]
+    mov rdi, rax
+    movsxd rax, DWORD PTR [rbp-60]
+    add rax, 1
+    mov DWORD PTR [rdi], eax
+    mov rax, QWORD PTR [rbp-48]
+    add rax, 4
+    mov QWORD PTR [rbp-48], rax
+    inc DWORD PTR [rbp-60]
+    movsxd rax, DWORD PTR [rbp-60]
+    cmp rax, 37
+    jl .Lbegin37
+.Lend37:
+    mov DWORD PTR [rbp-52], 0
+    mov DWORD PTR [rbp-60], 0
+    pxor xmm14, xmm14
+    mov rax, 37
+    mov rdi, rax
+    movsxd rax, DWORD PTR [rbp-60]
+    add rax, 3
+    cmp rax, rdi
+    jge .Lvend38
+    .p2align 4
+.Lvbegin38:
+    movsxd rax, DWORD PTR [rbp-60]
+    mov rdi, rax
+    lea rax, [rip+gv]
+    movdqu xmm0, XMMWORD PTR [rax+rdi*4]
+    paddd xmm14, xmm0
+    add DWORD PTR [rbp-60], 4
+    mov rax, 37
+    mov rdi, rax
+    movsxd rax, DWORD PTR [rbp-60]
+    add rax, 3
+    cmp rax, rdi
+    jl .Lvbegin38
+.Lvend38:
+    pshufd xmm0, xmm14, 78
+    paddd xmm14, xmm0
+    pshufd xmm0, xmm14, 177
+    paddd xmm14, xmm0
+    movd eax, xmm14
+    add DWORD PTR [rbp-52], eax
+    movsxd rax, DWORD PTR [rbp-60]
+    shl rax, 2
+    mov rdi, rax
+    lea rax, [rip+gv]
+    add rax, rdi
+    mov QWORD PTR [rbp-48], rax
+    movsxd rax, DWORD PTR [rbp-60]
+    cmp rax, 37
+    jge .Lend39
+    .p2align 4
+.Lbegin39:
+    mov rax, QWORD PTR [rbp-48]
+    movsxd rax, DWORD PTR [rax]
+    add DWORD PTR [rbp-52], eax
+    mov rax, QWORD PTR [rbp-48]
+    add rax, 4
+    mov QWORD PTR [rbp-48], rax
+    inc DWORD PTR [rbp-60]
+    movsxd rax, DWORD PTR [rbp-60]
+    cmp rax, 37
+    jl .Lbegin39
+.Lend39:
+    movsxd rax, DWORD PTR [rbp-52]
+    mov rsi, rax
+    mov rdi, 703
+    call assert
+    movsxd rax, eax
+    mov DWORD PTR [rbp-52], 0
+    mov rax, 37
+    mov rdi, rax
+    movsxd rax, DWORD PTR [rbp-52]
+    add rax, 3
+    cmp rax, rdi
+    jge .Lvend40
+    .p2align 4
+.Lvbegin40:
+    movsxd rax, DWORD PTR [rbp-52]
+    mov rdi, rax
+    lea rax, [rip+gv]
+    movdqu xmm0, XMMWORD PTR [rax+rdi*4]
+    pslld xmm0, 1
+    movsxd rax, DWORD PTR [rbp-52]
+    mov rdi, rax
+    lea rax, [rip+gv]
+    movdqu XMMWORD PTR [rax+rdi*4], xmm0
+    add DWORD PTR [rbp-52], 4
+    mov rax, 37
+    mov rdi, rax
+    movsxd rax, DWORD PTR [rbp-52]
+    add rax, 3
+    cmp rax, rdi
+    jl .Lvbegin40
+.Lvend40:
+    movsxd rax, DWORD PTR [rbp-52]
+    shl rax, 2
+    mov rdi, rax
+    lea rax, [rip+gv]
+    add rax, rdi
+    mov QWORD PTR [rbp-48], rax
+    movsxd rax, DWORD PTR [rbp-52]
+    cmp rax, 37
+    jge .Lend41
+    .p2align 4
+.Lbegin41:
+    mov rax, QWORD PTR [rbp-48]
+    lea rax, [rax]
+    mov rdi, rax
+    mov rax, QWORD PTR [rbp-48]
+    movsxd rax, DWORD PTR [rax]
+    shl rax, 1
+    mov DWORD PTR [rdi], eax
+    mov rax, QWORD PTR [rbp-48]
+    add rax, 4
+    mov QWORD PTR [rbp-48], rax
+    inc DWORD PTR [rbp-52]
+    movsxd rax, DWORD PTR [rbp-52]
+    cmp rax, 37
+    jl .Lbegin41
+.Lend41:
+    mov DWORD PTR [rbp-56], 0
+    mov DWORD PTR [rbp-52], 0
+    pxor xmm14, xmm14
+    mov rax, 37
+    mov rdi, rax
+    movsxd rax, DWORD PTR [rbp-52]
+    add rax, 3
+    cmp rax, rdi
+    jge .Lvend42
+    .p2align 4
+.Lvbegin42:
+    movsxd rax, DWORD PTR [rbp-52]
+    mov rdi, rax
+    lea rax, [rip+gv]
+    movdqu xmm0, XMMWORD PTR [rax+rdi*4]
+    paddd xmm14, xmm0
+    add DWORD PTR [rbp-52], 4
+    mov rax, 37
+    mov rdi, rax
+    movsxd rax, DWORD PTR [rbp-52]
+    add rax, 3
+    cmp rax, rdi
+    jl .Lvbegin42
+.Lvend42:
+    pshufd xmm0, xmm14, 78
+    paddd xmm14, xmm0
+    pshufd xmm0, xmm14, 177
+    paddd xmm14, xmm0
+    movd eax, xmm14
+    add DWORD PTR [rbp-56], eax
+    movsxd rax, DWORD PTR [rbp-52]
+    shl rax, 2
+    mov rdi, rax
+    lea rax, [rip+gv]
+    add rax, rdi
+    mov QWORD PTR [rbp-48], rax
+    movsxd rax, DWORD PTR [rbp-52]
+    cmp rax, 37
+    jge .Lend43
+    .p2align 4
+.Lbegin43:
+    mov rax, QWORD PTR [rbp-48]
+    movsxd rax, DWORD PTR [rax]
+    add DWORD PTR [rbp-56], eax
+    mov rax, QWORD PTR [rbp-48]
+    add rax, 4
+    mov QWORD PTR [rbp-48], rax
+    inc DWORD PTR [rbp-52]
+    movsxd rax, DWORD PTR [rbp-52]
+    cmp rax, 37
+    jl .Lbegin43
+.Lend43:
+    movsxd rax, DWORD PTR [rbp-56]
+    mov rsi, rax
+    mov rdi, 1406
+    call assert
+    movsxd rax, eax
+    mov DWORD PTR [rbp-60], 0
+    xor eax, eax
+    shl rax, 2
+    mov rdi, rax
+    lea rax, [rip+gv]
+    add rax, rdi
+    mov QWORD PTR [rbp-56], rax
+    movsxd rax, DWORD PTR [rbp-60]
+    add rax, 3
+    cmp rax, 37
+    jge .Lend44
+    .p2align 4
+.Lbegin44:
+    mov rax, QWORD PTR [rbp-56]
+    mov QWORD PTR [rbp-48], rax
+    mov rax, QWORD PTR [rbp-56]
+    lea rax, [rax]
+    mov rdi, rax
+    movsxd rax, DWORD PTR [rbp-60]
+    add rax, -3
+    mov DWORD PTR [rdi], eax
+    mov rax, QWORD PTR [rbp-56]
+    lea rax, [rax+4]
+    mov rdi, rax
+    movsxd rax, DWORD PTR [rbp-60]
+    add rax, -2
+    mov DWORD PTR [rdi], eax
+    mov rax, QWORD PTR [rbp-56]
+    lea rax, [rax+8]
+    mov rdi, rax
+    movsxd rax, DWORD PTR [rbp-60]
+    add rax, -1
+    mov DWORD PTR [rdi], eax
+    mov rax, QWORD PTR [rbp-56]
+    lea rax, [rax+12]
+    mov rdi, rax
+    movsxd rax, DWORD PTR [rbp-60]
+    mov DWORD PTR [rdi], eax
+    mov rax, QWORD PTR [rbp-56]
+    add rax, 16
+    mov QWORD PTR [rbp-56], rax
+    add DWORD PTR [rbp-60], 4
+    movsxd rax, DWORD PTR [rbp-60]
+    add rax, 3
+    cmp rax, 37
+    jl .Lbegin44
+.Lend44:
+    movsxd rax, DWORD PTR [rbp-60]
+    shl rax, 2
+    mov rdi, rax
+    lea rax, [rip+gv]
+    add rax, rdi
+    mov QWORD PTR [rbp-48], rax
+    movsxd rax, DWORD PTR [rbp-60]
+    cmp rax, 37
+    jge .Lend45
+    .p2align 4
+.Lbegin45:
+    mov rax, QWORD PTR [rbp-48]
+    lea rax, [rax]
+    mov rdi, rax
+    movsxd rax, DWORD PTR [rbp-60]
+    add rax, -3
+    mov DWORD PTR [rdi], eax
+    mov rax, QWORD PTR [rbp-48]
+    add rax, 4
+    mov QWORD PTR [rbp-48], rax
+    inc DWORD PTR [rbp-60]
+    movsxd rax, DWORD PTR [rbp-60]
+    cmp rax, 37
+    jl .Lbegin45
+.Lend45:
+    mov DWORD PTR [rbp-52], 0
+    mov DWORD PTR [rbp-60], 0
+    pxor xmm14, xmm14
+    mov rax, 37
+    mov rdi, rax
+    movsxd rax, DWORD PTR [rbp-60]
+    add rax, 3
+    cmp rax, rdi
+    jge .Lvend46
+    .p2align 4
+.Lvbegin46:
+    movsxd rax, DWORD PTR [rbp-60]
+    mov rdi, rax
+    lea rax, [rip+gv]
+    movdqu xmm0, XMMWORD PTR [rax+rdi*4]
+    movsxd rax, DWORD PTR [rbp-60]
+    mov rdi, rax
+    lea rax, [rip+gv]
+    movdqu xmm1, XMMWORD PTR [rax+rdi*4]
+    movdqa xmm2, xmm0
+    pmuludq xmm2, xmm1
+    psrlq xmm0, 32
+    psrlq xmm1, 32
+    pmuludq xmm0, xmm1
+    pshufd xmm2, xmm2, 8
+    pshufd xmm0, xmm0, 8
+    punpckldq xmm2, xmm0
+    movdqa xmm0, xmm2
+    paddd xmm14, xmm0
+    add DWORD PTR [rbp-60], 4
+    mov rax, 37
+    mov rdi, rax
+    movsxd rax, DWORD PTR [rbp-60]
+    add rax, 3
+    cmp rax, rdi
+    jl .Lvbegin46
+.Lvend46:
+    pshufd xmm0, xmm14, 78
+    paddd xmm14, xmm0
+    pshufd xmm0, xmm14, 177
+    paddd xmm14, xmm0
+    movd eax, xmm14
+    add DWORD PTR [rbp-52], eax
+    movsxd rax, DWORD PTR [rbp-60]
+    shl rax, 2
+    mov rdi, rax
+    lea rax, [rip+gv]
+    add rax, rdi
+    mov QWORD PTR [rbp-48], rax
+    movsxd rax, DWORD PTR [rbp-60]
+    cmp rax, 37
+    jge .Lend47
+    .p2align 4
+.Lbegin47:
+    mov rax, QWORD PTR [rbp-48]
+    movsxd rax, DWORD PTR [rax]
+    mov rdi, rax
+    mov rax, QWORD PTR [rbp-48]
+    movsxd rax, DWORD PTR [rax]
+    imul rax, rdi
+    add DWORD PTR [rbp-52], eax
+    mov rax, QWORD PTR [rbp-48]
+    add rax, 4
+    mov QWORD PTR [rbp-48], rax
+    inc DWORD PTR [rbp-60]
+    movsxd rax, DWORD PTR [rbp-60]
+    cmp rax, 37
+    jl .Lbegin47
+.Lend47:
+    movsxd rax, DWORD PTR [rbp-52]
+    mov rdi, rax
+    imul rax, rax, 274877907
+    sar rax, 32
+    sar rax, 6
+    mov rdi, rax
+    shr rdi, 63
+    add rax, rdi
+    mov rsi, rax
+    mov rdi, 12
+    call assert
+    movsxd rax, eax
+    mov r14, 0
+    lea rax, [rip+gc]
+    add rax, 0
+    mov QWORD PTR [rbp-56], rax
+    mov rax, r14
+    add rax, 3
+    cmp rax, 41
+    jge .Lend48
+    .p2align 4
+.Lbegin48:
+    mov rax, QWORD PTR [rbp-56]
+    mov QWORD PTR [rbp-48], rax
+    mov rax, QWORD PTR [rbp-56]
+    lea rax, [rax]
+    mov rdi, rax
+    mov rax, r14
+    neg rax
+    mov BYTE PTR [rdi], al
+    mov rax, QWORD PTR [rbp-56]
+    lea rax, [rax+1]
+    mov rdi, rax
+    mov rax, r14
+    add rax, 1
+    neg rax
+    mov BYTE PTR [rdi], al
+    mov rax, QWORD PTR [rbp-56]
+    lea rax, [rax+2]
+    mov rdi, rax
+    mov rax, r14
+    add rax, 2
+    neg rax
+    mov BYTE PTR [rdi], al
+    mov rax, QWORD PTR [rbp-56]
+    lea rax, [rax+3]
+    mov rdi, rax
+    mov rax, r14
+    add rax, 3
+    neg rax
+    mov BYTE PTR [rdi], al
+    mov rax, QWORD PTR [rbp-56]
+    add rax, 4
+    mov QWORD PTR [rbp-56], rax
+    mov rax, r14
+    add rax, 4
+    movsxd r14, eax
+    mov rax, r14
+    add rax, 3
+    cmp rax, 41
+    jl .Lbegin48
+.Lend48:
+    mov rax, r14
+    mov rdi, rax
+    lea rax, [rip+gc]
+    add rax, rdi
+    mov QWORD PTR [rbp-48], rax
+    mov rax, r14
+    cmp rax, 41
+    jge .Lend49
+    .p2align 4
+.Lbegin49:
+    mov rax, QWORD PTR [rbp-48]
+    lea rax, [rax]
+    mov rdi, rax
+    mov rax, r14
+    neg rax
+    mov BYTE PTR [rdi], al
+    mov rax, QWORD PTR [rbp-48]
+    add rax, 1
+    mov QWORD PTR [rbp-48], rax
+    mov rax, r14
+    add rax, 1
+    movsxd r14, eax
+    mov rax, r14
+    cmp rax, 41
+    jl .Lbegin49
+.Lend49:
+    mov DWORD PTR [rbp-60], 0
+    mov r14, 1
+    pxor xmm14, xmm14
+    mov eax, -2139062144
+    movd xmm15, eax
+    pshufd xmm15, xmm15, 0
+    mov eax, 1024
+    movq xmm13, rax
+    punpcklqdq xmm13, xmm13
+    mov rax, 40
+    mov rdi, rax
+    mov rax, r14
+    add rax, 15
+    cmp rax, rdi
+    jg .Lvend50
+    .p2align 4
+.Lvbegin50:
+    mov rax, r14
+    mov rdi, rax
+    lea rax, [rip+gc]
+    movdqu xmm0, XMMWORD PTR [rax+rdi*1]
+    pxor xmm0, xmm15
+    pxor xmm1, xmm1
+    psadbw xmm0, xmm1
+    paddq xmm14, xmm0
+    psubq xmm14, xmm13
+    add r14, 16
+    mov rax, 40
+    mov rdi, rax
+    mov rax, r14
+    add rax, 15
+    cmp rax, rdi
+    jle .Lvbegin50
+.Lvend50:
+    pshufd xmm0, xmm14, 78
+    paddq xmm14, xmm0
+    movq rax, xmm14
+    add DWORD PTR [rbp-60], eax
+    mov rax, r14
+    mov rdi, rax
+    lea rax, [rip+gc]
+    add rax, rdi
+    mov QWORD PTR [rbp-56], rax
+    mov rax, r14
+    add rax, 3
+    cmp rax, 40
+    jg .Lend51
+    .p2align 4
+.Lbegin51:
+    mov rax, QWORD PTR [rbp-56]
+    mov QWORD PTR [rbp-48], rax
+    mov rax, QWORD PTR [rbp-56]
+    movsx rax, BYTE PTR [rax]
+    add DWORD PTR [rbp-60], eax
+    mov rax, QWORD PTR [rbp-56]
+    movsx rax, BYTE PTR [rax+1]
+    add DWORD PTR [rbp-60], eax
+    mov rax, QWORD PTR [rbp-56]
+    movsx rax, BYTE PTR [rax+2]
+    add DWORD PTR [rbp-60], eax
+    mov rax, QWORD PTR [rbp-56]
+    movsx rax, BYTE PTR [rax+3]
+    add DWORD PTR [rbp-60], eax
+    mov rax, QWORD PTR [rbp-56]
+    add rax, 4
+    mov QWORD PTR [rbp-56], rax
+    mov rax, r14
+    add rax, 4
+    movsxd r14, eax
+    mov rax, r14
+    add rax, 3
+    cmp rax, 40
+    jle .Lbegin51
+.Lend51:
+    mov rax, r14
+    mov rdi, rax
+    lea rax, [rip+gc]
+    add rax, rdi
+    mov QWORD PTR [rbp-48], rax
+    mov rax, r14
+    cmp rax, 40
+    jg .Lend52
+    .p2align 4
+.Lbegin52:
+    mov rax, QWORD PTR [rbp-48]
+    movsx rax, BYTE PTR [rax]
+    add DWORD PTR [rbp-60], eax
+    mov rax, QWORD PTR [rbp-48]
+    add rax, 1
+    mov QWORD PTR [rbp-48], rax
+    mov rax, r14
+    add rax, 1
+    movsxd r14, eax
+    mov rax, r14
+    cmp rax, 40
+    jle .Lbegin52
+.Lend52:
+    movsxd rax, DWORD PTR [rbp-60]
+    mov rdi, rax
+    imul rax, rax, 1717986919
+    sar rax, 32
+    sar rax, 3
+    mov rdi, rax
+    shr rdi, 63
+    add rax, rdi
+    mov rsi, rax
+    mov rdi, -41
+    call assert
+    movsxd rax, eax
+    mov r15, 0
+    lea rax, [rip+gc]
+    add rax, 0
+    mov QWORD PTR [rbp-56], rax
+    mov rax, r15
+    add rax, 3
+    cmp rax, 41
+    jge .Lend53
+    .p2align 4
+.Lbegin53:
+    mov rax, QWORD PTR [rbp-56]
+    mov QWORD PTR [rbp-48], rax
+    mov rax, QWORD PTR [rbp-56]
+    lea rax, [rax]
+    push rax
+    mov rax, r15
+    mov rdx, rax
+    mov rdi, rax
+    imul rax, rax, 1431655766
+    sar rax, 32
+    mov rdi, rax
+    shr rdi, 63
+    add rax, rdi
+    imul rax, rax, 3
+    sub rdx, rax
+    mov rax, rdx
+    pop rdi
+    mov BYTE PTR [rdi], al
+    mov rax, QWORD PTR [rbp-56]
+    lea rax, [rax+1]
+    push rax
+    mov rax, r15
+    add rax, 1
+    mov rdx, rax
+    mov rdi, rax
+    imul rax, rax, 1431655766
+    sar rax, 32
+    mov rdi, rax
+    shr rdi, 63
+    add rax, rdi
+    imul rax, rax, 3
+    sub rdx, rax
+    mov rax, rdx
+    pop rdi
+    mov BYTE PTR [rdi], al
+    mov rax, QWORD PTR [rbp-56]
+    lea rax, [rax+2]
+    push rax
+    mov rax, r15
+    add rax, 2
+    mov rdx, rax
+    mov rdi, rax
+    imul rax, rax, 1431655766
+    sar rax, 32
+    mov rdi, rax
+    shr rdi, 63
+    add rax, rdi
+    imul rax, rax, 3
+    sub rdx, rax
+    mov rax, rdx
+    pop rdi
+    mov BYTE PTR [rdi], al
+    mov rax, QWORD PTR [rbp-56]
+    lea rax, [rax+3]
+    push rax
+    mov rax, r15
+    add rax, 3
+    mov rdx, rax
+    mov rdi, rax
+    imul rax, rax, 1431655766
+    sar rax, 32
+    mov rdi, rax
+    shr rdi, 63
+    add rax, rdi
+    imul rax, rax, 3
+    sub rdx, rax
+    mov rax, rdx
+    pop rdi
+    mov BYTE PTR [rdi], al
+    mov rax, QWORD PTR [rbp-56]
+    add rax, 4
+    mov QWORD PTR [rbp-56], rax
+    mov rax, r15
+    add rax, 4
+    movsxd r15, eax
+    mov rax, r15
+    add rax, 3
+    cmp rax, 41
+    jl .Lbegin53
+.Lend53:
+    mov rax, r15
+    mov rdi, rax
+    lea rax, [rip+gc]
+    add rax, rdi
+    mov QWORD PTR [rbp-48], rax
+    mov rax, r15
+    cmp rax, 41
+    jge .Lend54
+    .p2align 4
+.Lbegin54:
+    mov rax, QWORD PTR [rbp-48]
+    lea rax, [rax]
+    push rax
+    mov rax, r15
+    mov rdx, rax
+    mov rdi, rax
+    imul rax, rax, 1431655766
+    sar rax, 32
+    mov rdi, rax
+    shr rdi, 63
+    add rax, rdi
+    imul rax, rax, 3
+    sub rdx, rax
+    mov rax, rdx
+    pop rdi
+    mov BYTE PTR [rdi], al
+    mov rax, QWORD PTR [rbp-48]
+    add rax, 1
+    mov QWORD PTR [rbp-48], rax
+    mov rax, r15
+    add rax, 1
+    movsxd r15, eax
+    mov rax, r15
+    cmp rax, 41
+    jl .Lbegin54
+.Lend54:
+    mov DWORD PTR [rbp-60], 0
+    mov r15, 0
+    mov rax, 1
+    movd xmm8, eax
+    punpcklbw xmm8, xmm8
+    pshuflw xmm8, xmm8, 0
+    pshufd xmm8, xmm8, 0
+    pxor xmm14, xmm14
+    mov rax, 41
+    mov rdi, rax
+    mov rax, r15
+    add rax, 15
+    cmp rax, rdi
+    jge .Lvend55
+    .p2align 4
+.Lvbegin55:
+    mov rax, r15
+    mov rdi, rax
+    lea rax, [rip+gc]
+    movdqu xmm0, XMMWORD PTR [rax+rdi*1]
+    movdqa xmm1, xmm8
+    pcmpeqb xmm0, xmm1
+    pxor xmm1, xmm1
+    psubb xmm1, xmm0
+    pxor xmm0, xmm0
+    psadbw xmm1, xmm0
+    paddq xmm14, xmm1
+    add r15, 16
+    mov rax, 41
+    mov rdi, rax
+    mov rax, r15
+    add rax, 15
+    cmp rax, rdi
+    jl .Lvbegin55
+.Lvend55:
+    pshufd xmm0, xmm14, 78
+    paddq xmm14, xmm0
+    movq rax, xmm14
+    add DWORD PTR [rbp-60], eax
+    mov rax, r15
+    mov rdi, rax
+    lea rax, [rip+gc]
+    add rax, rdi
+    mov QWORD PTR [rbp-56], rax
+    mov rax, r15
+    add rax, 3
+    cmp rax, 41
+    jge .Lend56
+    .p2align 4
+.Lbegin56:
+    mov rax, QWORD PTR [rbp-56]
+    mov QWORD PTR [rbp-48], rax
+    movsxd rax, DWORD PTR [rbp-60]
+    push rax
+    movsxd rax, DWORD PTR [rbp-60]
+    add rax, 1
+    mov rdi, rax
+    mov rax, QWORD PTR [rbp-56]
+    movsx rax, BYTE PTR [rax]
+    cmp rax, 1
+    pop rax
+    cmove rax, rdi
+    mov DWORD PTR [rbp-60], eax
+    movsxd rax, eax
+    push rax
+    movsxd rax, DWORD PTR [rbp-60]
+    add rax, 1
+    mov rdi, rax
+    mov rax, QWORD PTR [rbp-56]
+    movsx rax, BYTE PTR [rax+1]
+    cmp rax, 1
+    pop rax
+    cmove rax, rdi
+    mov DWORD PTR [rbp-60], eax
+    movsxd rax, eax
+    push rax
+    movsxd rax, DWORD PTR [rbp-60]
+    add rax, 1
+    mov rdi, rax
+    mov rax, QWORD PTR [rbp-56]
+    movsx rax, BYTE PTR [rax+2]
+    cmp rax, 1
+    pop rax
+    cmove rax, rdi
+    mov DWORD PTR [rbp-60], eax
+    movsxd rax, eax
+    push rax
+    movsxd rax, DWORD PTR [rbp-60]
+    add rax, 1
+    mov rdi, rax
+    mov rax, QWORD PTR [rbp-56]
+    movsx rax, BYTE PTR [rax+3]
+    cmp rax, 1
+    pop rax
+    cmove rax, rdi
+    mov DWORD PTR [rbp-60], eax
+    mov rax, QWORD PTR [rbp-56]
+    add rax, 4
+    mov QWORD PTR [rbp-56], rax
+    mov rax, r15
+    add rax, 4
+    movsxd r15, eax
+    mov rax, r15
+    add rax, 3
+    cmp rax, 41
+    jl .Lbegin56
+.Lend56:
+    mov rax, r15
+    mov rdi, rax
+    lea rax, [rip+gc]
+    add rax, rdi
+    mov QWORD PTR [rbp-48], rax
+    mov rax, r15
+    cmp rax, 41
+    jge .Lend57
+    .p2align 4
+.Lbegin57:
+    movsxd rax, DWORD PTR [rbp-60]
+    push rax
+    movsxd rax, DWORD PTR [rbp-60]
+    add rax, 1
+    mov rdi, rax
+    mov rax, QWORD PTR [rbp-48]
+    movsx rax, BYTE PTR [rax]
+    cmp rax, 1
+    pop rax
+    cmove rax, rdi
+    mov DWORD PTR [rbp-60], eax
+    mov rax, QWORD PTR [rbp-48]
+    add rax, 1
+    mov QWORD PTR [rbp-48], rax
+    mov rax, r15
+    add rax, 1
+    movsxd r15, eax
+    mov rax, r15
+    cmp rax, 41
+    jl .Lbegin57
+.Lend57:
+    movsxd rax, DWORD PTR [rbp-60]
+    mov rsi, rax
+    mov rdi, 14
+    call assert
+    movsxd rax, eax
+    mov r12, 0
+    xor eax, eax
+    shl rax, 2
+    mov rdi, rax
+    lea rax, [rip+gv]
+    add rax, rdi
+    mov QWORD PTR [rbp-56], rax
+    mov rax, r12
+    add rax, 3
+    cmp rax, 37
+    jge .Lend58
+    .p2align 4
+.Lbegin58:
+    mov rax, QWORD PTR [rbp-56]
+    mov QWORD PTR [rbp-48], rax
+    mov rax, QWORD PTR [rbp-56]
+    lea rax, [rax]
+    mov rdi, rax
+    mov rax, r12
+    mov DWORD PTR [rdi], eax
+    mov rax, QWORD PTR [rbp-56]
+    lea rax, [rax+4]
+    mov rdi, rax
+    mov rax, r12
+    add rax, 1
+    mov DWORD PTR [rdi], eax
+    mov rax, QWORD PTR [rbp-56]
+    lea rax, [rax+8]
+    mov rdi, rax
+    mov rax, r12
+    add rax, 2
+    mov DWORD PTR [rdi], eax
+    mov rax, QWORD PTR [rbp-56]
+    lea rax, [rax+12]
+    mov rdi, rax
+    mov rax, r12
+    add rax, 3
+    mov DWORD PTR [rdi], eax
+    mov rax, QWORD PTR [rbp-56]
+    add rax, 16
+    mov QWORD PTR [rbp-56], rax
+    mov rax, r12
+    add rax, 4
+    movsxd r12, eax
+    mov rax, r12
+    add rax, 3
+    cmp rax, 37
+    jl .Lbegin58
+.Lend58:
+    mov rax, r12
+    shl rax, 2
+    mov rdi, rax
+    lea rax, [rip+gv]
+    add rax, rdi
+    mov QWORD PTR [rbp-48], rax
+    mov rax, r12
+    cmp rax, 37
+    jge .Lend59
+    .p2align 4
+.Lbegin59:
+    mov rax, QWORD PTR [rbp-48]
+    lea rax, [rax]
+    mov rdi, rax
+    mov rax, r12
+    mov DWORD PTR [rdi], eax
+    mov rax, QWORD PTR [rbp-48]
+    add rax, 4
+    mov QWORD PTR [rbp-48], rax
+    mov rax, r12
+    add rax, 1
+    movsxd r12, eax
+    mov rax, r12
+    cmp rax, 37
+    jl .Lbegin59
+.Lend59:
+    lea rax, [rip+gv]
+    mov QWORD PTR [rbp-48], rax
+    lea rax, [rip+gv]
+    add rax, 8
+    mov QWORD PTR [rbp-56], rax
+    mov r12, 0
+    mov rax, r12
+    shl rax, 2
+    mov rdi, rax
+    mov rax, QWORD PTR [rbp-56]
+    add rax, rdi
+    push rax
+    mov rax, r12
+    shl rax, 2
+    mov rdi, rax
+    mov rax, QWORD PTR [rbp-48]
+    add rax, rdi
+    pop rdi
+    sub rdi, rax
+    sub rdi, 1
+    cmp rdi, 15
+    jb .Lvend60
+    mov rax, 35
+    mov rdi, rax
+    mov rax, r12
+    add rax, 3
+    cmp rax, rdi
+    jge .Lvend60
+    .p2align 4
+.Lvbegin60:
+    mov rax, r12
+    mov rdi, rax
+    mov rax, QWORD PTR [rbp-48]
+    movdqu xmm0, XMMWORD PTR [rax+rdi*4]
+    mov rax, r12
+    mov rdi, rax
+    mov rax, QWORD PTR [rbp-56]
+    movdqu XMMWORD PTR [rax+rdi*4], xmm0
+    add r12, 4
+    mov rax, 35
+    mov rdi, rax
+    mov rax, r12
+    add rax, 3
+    cmp rax, rdi
+    jl .Lvbegin60
+.Lvend60:
+    mov rax, r12
+    shl rax, 2
+    mov rdi, rax
+    mov rax, QWORD PTR [rbp-56]
+    add rax, rdi
+    mov QWORD PTR [rbp-80], rax
+    mov rax, r12
+    shl rax, 2
+    mov rdi, rax
+    mov rax, QWORD PTR [rbp-48]
+    add rax, rdi
+    mov QWORD PTR [rbp-88], rax
+    mov rax, r12
+    add rax, 3
+    cmp rax, 35
+    jge .Lend61
+    .p2align 4
+.Lbegin61:
+    mov rax, QWORD PTR [rbp-80]
+    mov QWORD PTR [rbp-64], rax
+    mov rax, QWORD PTR [rbp-88]
+    mov QWORD PTR [rbp-72], rax
+    mov rax, QWORD PTR [rbp-80]
+    lea rax, [rax]
+    mov rdi, rax
+    mov rax, QWORD PTR [rbp-88]
+    movsxd rax, DWORD PTR [rax]
+    mov DWORD PTR [rdi], eax
+    mov rax, QWORD PTR [rbp-80]
+    lea rax, [rax+4]
+    mov rdi, rax
+    mov rax, QWORD PTR [rbp-88]
+    movsxd rax, DWORD PTR [rax+4]
+    mov DWORD PTR [rdi], eax
+    mov rax, QWORD PTR [rbp-80]
+    lea rax, [rax+8]
+    mov rdi, rax
+    mov rax, QWORD PTR [rbp-88]
+    movsxd rax, DWORD PTR [rax+8]
+    mov DWORD PTR [rdi], eax
+    mov rax, QWORD PTR [rbp-80]
+    lea rax, [rax+12]
+    mov rdi, rax
+    mov rax, QWORD PTR [rbp-88]
+    movsxd rax, DWORD PTR [rax+12]
+    mov DWORD PTR [rdi], eax
+    add QWORD PTR [rbp-88], 16
+    mov rax, QWORD PTR [rbp-80]
+    add rax, 16
+    mov QWORD PTR [rbp-80], rax
+    mov rax, r12
+    add rax, 4
+    movsxd r12, eax
+    mov rax, r12
+    add rax, 3
+    cmp rax, 35
+    jl .Lbegin61
+.Lend61:
+    mov rax, r12
+    shl rax, 2
+    mov rdi, rax
+    mov rax, QWORD PTR [rbp-56]
+    add rax, rdi
+    mov QWORD PTR [rbp-64], rax
+    mov rax, r12
+    shl rax, 2
+    mov rdi, rax
+    mov rax, QWORD PTR [rbp-48]
+    add rax, rdi
+    mov QWORD PTR [rbp-56], rax
+    mov rax, r12
+    cmp rax, 35
+    jge .Lend62
+    .p2align 4
+.Lbegin62:
+    mov rax, QWORD PTR [rbp-64]
+    lea rax, [rax]
+    mov rdi, rax
+    mov rax, QWORD PTR [rbp-56]
+    movsxd rax, DWORD PTR [rax]
+    mov DWORD PTR [rdi], eax
+    add QWORD PTR [rbp-56], 4
+    mov rax, QWORD PTR [rbp-64]
+    add rax, 4
+    mov QWORD PTR [rbp-64], rax
+    mov rax, r12
+    add rax, 1
+    movsxd r12, eax
+    mov rax, r12
+    cmp rax, 35
+    jl .Lbegin62
+.Lend62:
+    movsxd rax, DWORD PTR [rip+gv]
+    push rax
+    movsxd rax, DWORD PTR [rip+gv+140]
+    mov rdi, rax
+    movsxd rax, DWORD PTR [rip+gv+144]
+    add rax, rdi
+    pop rdi
+    add rax, rdi
+    mov rsi, rax
+    mov rdi, 1
+    call assert
+    movsxd rax, eax
+    mov rbx, 0
+    xor eax, eax
+    shl rax, 2
+    mov rdi, rax
+    lea rax, [rip+gv]
+    add rax, rdi
+    mov QWORD PTR [rbp-56], rax
+    mov rax, rbx
+    add rax, 3
+    cmp rax, 37
+    jge .Lend63
+    .p2align 4
+.Lbegin63:
+    mov rax, QWORD PTR [rbp-56]
+    mov QWORD PTR [rbp-48], rax
+    mov rax, QWORD PTR [rbp-56]
+    lea rax, [rax]
+    mov rdi, rax
+    mov rax, rbx
+    mov DWORD PTR [rdi], eax
+    mov rax, QWORD PTR [rbp-56]
+    lea rax, [rax+4]
+    mov rdi, rax
+    mov rax, rbx
+    add rax, 1
+    mov DWORD PTR [rdi], eax
+    mov rax, QWORD PTR [rbp-56]
+    lea rax, [rax+8]
+    mov rdi, rax
+    mov rax, rbx
+    add rax, 2
+    mov DWORD PTR [rdi], eax
+    mov rax, QWORD PTR [rbp-56]
+    lea rax, [rax+12]
+    mov rdi, rax
+    mov rax, rbx
+    add rax, 3
+    mov DWORD PTR [rdi], eax
+    mov rax, QWORD PTR [rbp-56]
+    add rax, 16
+    mov QWORD PTR [rbp-56], rax
+    mov rax, rbx
+    add rax, 4
+    movsxd rbx, eax
+    mov rax, rbx
+    add rax, 3
+    cmp rax, 37
+    jl .Lbegin63
+.Lend63:
+    mov rax, rbx
+    shl rax, 2
+    mov rdi, rax
+    lea rax, [rip+gv]
+    add rax, rdi
+    mov QWORD PTR [rbp-48], rax
+    mov rax, rbx
+    cmp rax, 37
+    jge .Lend64
+    .p2align 4
+.Lbegin64:
+    mov rax, QWORD PTR [rbp-48]
+    lea rax, [rax]
+    mov rdi, rax
+    mov rax, rbx
+    mov DWORD PTR [rdi], eax
+    mov rax, QWORD PTR [rbp-48]
+    add rax, 4
+    mov QWORD PTR [rbp-48], rax
+    mov rax, rbx
+    add rax, 1
+    movsxd rbx, eax
+    mov rax, rbx
+    cmp rax, 37
+    jl .Lbegin64
+.Lend64:
+    lea rax, [rip+gv]
+    mov QWORD PTR [rbp-48], rax
+    lea rax, [rip+gv]
+    add rax, 80
+    mov QWORD PTR [rbp-56], rax
+    mov rbx, 0
+    mov rax, rbx
+    shl rax, 2
+    mov rdi, rax
+    mov rax, QWORD PTR [rbp-48]
+    add rax, rdi
+    push rax
+    mov rax, rbx
+    shl rax, 2
+    mov rdi, rax
+    mov rax, QWORD PTR [rbp-56]
+    add rax, rdi
+    pop rdi
+    sub rdi, rax
+    sub rdi, 1
+    cmp rdi, 15
+    jb .Lvend65
+    mov rax, 17
+    mov rdi, rax
+    mov rax, rbx
+    add rax, 3
+    cmp rax, rdi
+    jge .Lvend65
+    .p2align 4
+.Lvbegin65:
+    mov rax, rbx
+    mov rdi, rax
+    mov rax, QWORD PTR [rbp-56]
+    movdqu xmm0, XMMWORD PTR [rax+rdi*4]
+    mov rax, rbx
+    mov rdi, rax
+    mov rax, QWORD PTR [rbp-48]
+    movdqu xmm1, XMMWORD PTR [rax+rdi*4]
+    paddd xmm0, xmm1
+    mov rax, rbx
+    mov rdi, rax
+    mov rax, QWORD PTR [rbp-48]
+    movdqu XMMWORD PTR [rax+rdi*4], xmm0
+    add rbx, 4
+    mov rax, 17
+    mov rdi, rax
+    mov rax, rbx
+    add rax, 3
+    cmp rax, rdi
+    jl .Lvbegin65
+.Lvend65:
+    mov rax, rbx
+    shl rax, 2
+    mov rdi, rax
+    mov rax, QWORD PTR [rbp-48]
+    add rax, rdi
+    mov QWORD PTR [rbp-104], rax
+    mov rax, rbx
+    shl rax, 2
+    mov rdi, rax
+    mov rax, QWORD PTR [rbp-56]
+    add rax, rdi
+    mov QWORD PTR [rbp-112], rax
+    mov rax, rbx
+    add rax, 3
+    cmp rax, 17
+    jge .Lend66
+    .p2align 4
+.Lbegin66:
+    mov rax, QWORD PTR [rbp-104]
+    mov QWORD PTR [rbp-88], rax
+    mov rax, QWORD PTR [rbp-112]
+    mov QWORD PTR [rbp-96], rax
+    mov rax, QWORD PTR [rbp-112]
+    movsxd rax, DWORD PTR [rax]
+    push rax
+    mov rax, QWORD PTR [rbp-104]
+    pop rdx
+    add DWORD PTR [rax], edx
+    mov rax, QWORD PTR [rbp-104]
+    add rax, 4
+    mov QWORD PTR [rbp-64], rax
+    mov rax, QWORD PTR [rbp-112]
+    movsxd rax, DWORD PTR [rax+4]
+    push rax
+    mov rax, QWORD PTR [rbp-64]
+    pop rdx
+    add DWORD PTR [rax], edx
+    mov rax, QWORD PTR [rbp-104]
+    add rax, 8
+    mov QWORD PTR [rbp-72], rax
+    mov rax, QWORD PTR [rbp-112]
+    movsxd rax, DWORD PTR [rax+8]
+    push rax
+    mov rax, QWORD PTR [rbp-72]
+    pop rdx
+    add DWORD PTR [rax], edx
+    mov rax, QWORD PTR [rbp-104]
+    add rax, 12
+    mov QWORD PTR [rbp-80], rax
+    mov rax, QWORD PTR [rbp-112]
+    movsxd rax, DWORD PTR [rax+12]
+    push rax
+    mov rax, QWORD PTR [rbp-80]
+    pop rdx
+    add DWORD PTR [rax], edx
+    add QWORD PTR [rbp-112], 16
+    mov rax, QWORD PTR [rbp-104]
+    add rax, 16
+    mov QWORD PTR [rbp-104], rax
+    mov rax, rbx
+    add rax, 4
+    movsxd rbx, eax
+    mov rax, rbx
+    add rax, 3
+    cmp rax, 17
+    jl .Lbegin66
+.Lend66:
+    mov rax, rbx
+    shl rax, 2
+    mov rdi, rax
+    mov rax, QWORD PTR [rbp-48]
+    add rax, rdi
+    mov QWORD PTR [rbp-64], rax
+    mov rax, rbx
+    shl rax, 2
+    mov rdi, rax
+    mov rax, QWORD PTR [rbp-56]
+    add rax, rdi
+    mov QWORD PTR [rbp-48], rax
+    mov rax, rbx
+    cmp rax, 17
+    jge .Lend67
+    .p2align 4
+.Lbegin67:
+    mov rax, QWORD PTR [rbp-48]
+    movsxd rax, DWORD PTR [rax]
+    push rax
+    mov rax, QWORD PTR [rbp-64]
+    pop rdx
+    add DWORD PTR [rax], edx
+    add QWORD PTR [rbp-48], 4
+    mov rax, QWORD PTR [rbp-64]
+    add rax, 4
+    mov QWORD PTR [rbp-64], rax
+    mov rax, rbx
+    add rax, 1
+    movsxd rbx, eax
+    mov rax, rbx
+    cmp rax, 17
+    jl .Lbegin67
+.Lend67:
+    movsxd rax, DWORD PTR [rip+gv+68]
+    push rax
+    movsxd rax, DWORD PTR [rip+gv+60]
+    mov rdi, rax
+    movsxd rax, DWORD PTR [rip+gv+64]
+    add rax, rdi
+    pop rdi
+    sub rax, rdi
+    mov rsi, rax
+    mov rdi, 85
+    call assert
+    movsxd rax, eax
+    mov DWORD PTR [rbp-60], 0
+    xor eax, eax
+    shl rax, 2
+    mov rdi, rax
+    lea rax, [rip+gv]
+    add rax, rdi
+    mov QWORD PTR [rbp-56], rax
+    movsxd rax, DWORD PTR [rbp-60]
+    add rax, 3
+    cmp rax, 37
+    jge .Lend68
+    .p2align 4
+.Lbegin68:
+    mov rax, QWORD PTR [rbp-56]
+    mov QWORD PTR [rbp-48], rax
+    movsxd rax, DWORD PTR [rbp-60]
+    lea rax, [rax+rax*2]
+    mov DWORD PTR [rbp-64], eax
+    mov rax, QWORD PTR [rbp-56]
+    lea rax, [rax]
+    mov rdi, rax
+    movsxd rax, DWORD PTR [rbp-64]
+    mov DWORD PTR [rdi], eax
+    mov rax, QWORD PTR [rbp-56]
+    lea rax, [rax+4]
+    mov rdi, rax
+    movsxd rax, DWORD PTR [rbp-64]
+    add rax, 3
+    mov DWORD PTR [rdi], eax
+    mov rax, QWORD PTR [rbp-56]
+    lea rax, [rax+8]
+    mov rdi, rax
+    movsxd rax, DWORD PTR [rbp-64]
+    add rax, 6
+    mov DWORD PTR [rdi], eax
+    mov rax, QWORD PTR [rbp-56]
+    lea rax, [rax+12]
+    mov rdi, rax
+    movsxd rax, DWORD PTR [rbp-64]
+    add rax, 9
+    mov DWORD PTR [rdi], eax
+    mov rax, QWORD PTR [rbp-56]
+    add rax, 16
+    mov QWORD PTR [rbp-56], rax
+    add DWORD PTR [rbp-60], 4
+    movsxd rax, DWORD PTR [rbp-60]
+    add rax, 3
+    cmp rax, 37
+    jl .Lbegin68
+.Lend68:
+    movsxd rax, DWORD PTR [rbp-60]
+    shl rax, 2
+    mov rdi, rax
+    lea rax, [rip+gv]
+    add rax, rdi
+    mov QWORD PTR [rbp-48], rax
+    movsxd rax, DWORD PTR [rbp-60]
+    cmp rax, 37
+    jge .Lend69
+    .p2align 4
+.Lbegin69:
+    mov rax, QWORD PTR [rbp-48]
+    lea rax, [rax]
+    mov rdi, rax
+    movsxd rax, DWORD PTR [rbp-60]
+    lea rax, [rax+rax*2]
+    mov DWORD PTR [rdi], eax
+    mov rax, QWORD PTR [rbp-48]
+    add rax, 4
+    mov QWORD PTR [rbp-48], rax
+    inc DWORD PTR [rbp-60]
+    movsxd rax, DWORD PTR [rbp-60]
+    cmp rax, 37
+    jl .Lbegin69
+.Lend69:
+    mov DWORD PTR [rbp-64], 0
+    mov DWORD PTR [rbp-60], 0
+    xor eax, eax
+    shl rax, 2
+    mov rdi, rax
+    lea rax, [rip+gv]
+    add rax, rdi
+    mov QWORD PTR [rbp-56], rax
+    movsxd rax, DWORD PTR [rbp-60]
+    add rax, 3
+    cmp rax, 26
+    jge .Lend70
+    .p2align 4
+.Lbegin70:
+    mov rax, QWORD PTR [rbp-56]
+    mov QWORD PTR [rbp-48], rax
+    mov rax, QWORD PTR [rbp-56]
+    movsxd rax, DWORD PTR [rax+4]
+    mov DWORD PTR [rbp-68], eax
+    mov rax, QWORD PTR [rbp-56]
+    movsxd rax, DWORD PTR [rax]
+    mov DWORD PTR [rbp-80], eax
+    movsxd rax, eax
+    push rax
+    movsxd rax, DWORD PTR [rbp-80]
+    push rax
+    movsxd rax, DWORD PTR [rbp-68]
+    mov rdi, rax
+    movsxd rax, DWORD PTR [rbp-64]
+    add rax, rdi
+    pop rdi
+    sub rax, rdi
+    pop rdi
+    add rax, rdi
+    mov DWORD PTR [rbp-64], eax
+    mov rax, QWORD PTR [rbp-56]
+    movsxd rax, DWORD PTR [rax+8]
+    mov DWORD PTR [rbp-72], eax
+    movsxd rax, DWORD PTR [rbp-68]
+    push rax
+    movsxd rax, DWORD PTR [rbp-68]
+    push rax
+    movsxd rax, DWORD PTR [rbp-72]
+    mov rdi, rax
+    movsxd rax, DWORD PTR [rbp-64]
+    add rax, rdi
+    pop rdi
+    sub rax, rdi
+    pop rdi
+    add rax, rdi
+    mov DWORD PTR [rbp-64], eax
+    mov rax, QWORD PTR [rbp-56]
+    movsxd rax, DWORD PTR [rax+12]
+    mov DWORD PTR [rbp-76], eax
+    movsxd rax, DWORD PTR [rbp-72]
+    push rax
+    movsxd rax, DWORD PTR [rbp-72]
+    push rax
+    movsxd rax, DWORD PTR [rbp-76]
+    mov rdi, rax
+    movsxd rax, DWORD PTR [rbp-64]
+    add rax, rdi
+    pop rdi
+    sub rax, rdi
+    pop rdi
+    add rax, rdi
+    mov DWORD PTR [rbp-64], eax
+    movsxd rax, DWORD PTR [rbp-76]
+    push rax
+    movsxd rax, DWORD PTR [rbp-76]
+    push rax
+    mov rax, QWORD PTR [rbp-56]
+    movsxd rax, DWORD PTR [rax+16]
+    mov rdi, rax
+    movsxd rax, DWORD PTR [rbp-64]
+    add rax, rdi
+    pop rdi
+    sub rax, rdi
+    pop rdi
+    add rax, rdi
+    mov DWORD PTR [rbp-64], eax
+    mov rax, QWORD PTR [rbp-56]
+    add rax, 16
+    mov QWORD PTR [rbp-56], rax
+    add DWORD PTR [rbp-60], 4
+    movsxd rax, DWORD PTR [rbp-60]
+    add rax, 3
+    cmp rax, 26
+    jl .Lbegin70
+.Lend70:
+    movsxd rax, DWORD PTR [rbp-60]
+    shl rax, 2
+    mov rdi, rax
+    lea rax, [rip+gv]
+    add rax, rdi
+    mov QWORD PTR [rbp-48], rax
+    movsxd rax, DWORD PTR [rbp-60]
+    cmp rax, 26
+    jge .Lend71
+    .p2align 4
+.Lbegin71:
+    mov rax, QWORD PTR [rbp-48]
+    movsxd rax, DWORD PTR [rax]
+    push rax
+    mov rax, QWORD PTR [rbp-48]
+    movsxd rax, DWORD PTR [rax]
+    push rax
+    mov rax, QWORD PTR [rbp-48]
+    movsxd rax, DWORD PTR [rax+4]
+    mov rdi, rax
+    movsxd rax, DWORD PTR [rbp-64]
+    add rax, rdi
+    pop rdi
+    sub rax, rdi
+    pop rdi
+    add rax, rdi
+    mov DWORD PTR [rbp-64], eax
+    mov rax, QWORD PTR [rbp-48]
+    add rax, 4
+    mov QWORD PTR [rbp-48], rax
+    inc DWORD PTR [rbp-60]
+    movsxd rax, DWORD PTR [rbp-60]
+    cmp rax, 26
+    jl .Lbegin71
+.Lend71:
+    movsxd rax, DWORD PTR [rbp-60]
+    mov rdi, rax
+    movsxd rax, DWORD PTR [rbp-64]
+    add rax, rdi
+    mov rsi, rax
+    mov rdi, 1079
+    call assert
+    movsxd rax, eax
+    mov DWORD PTR [rbp-48], 0
+    movsxd rax, DWORD PTR [rip+gv+144]
+    mov rdi, rax
+    movsxd rax, DWORD PTR [rbp-48]
+    shl rax, 1
+    add rax, rdi
+    mov DWORD PTR [rbp-48], eax
+    movsxd rax, DWORD PTR [rip+gv+132]
+    mov rdi, rax
+    movsxd rax, DWORD PTR [rbp-48]
+    shl rax, 1
+    add rax, rdi
+    mov DWORD PTR [rbp-48], eax
+    movsxd rax, DWORD PTR [rip+gv+120]
+    mov rdi, rax
+    movsxd rax, DWORD PTR [rbp-48]
+    shl rax, 1
+    add rax, rdi
+    mov DWORD PTR [rbp-48], eax
+    movsxd rax, DWORD PTR [rip+gv+108]
+    mov rdi, rax
+    movsxd rax, DWORD PTR [rbp-48]
+    shl rax, 1
+    add rax, rdi
+    mov DWORD PTR [rbp-48], eax
+    movsxd rax, DWORD PTR [rip+gv+96]
+    mov rdi, rax
+    movsxd rax, DWORD PTR [rbp-48]
+    shl rax, 1
+    add rax, rdi
+    mov DWORD PTR [rbp-48], eax
+    movsxd rax, DWORD PTR [rip+gv+84]
+    mov rdi, rax
+    movsxd rax, DWORD PTR [rbp-48]
+    shl rax, 1
+    add rax, rdi
+    mov DWORD PTR [rbp-48], eax
+    movsxd rax, DWORD PTR [rip+gv+72]
+    mov rdi, rax
+    movsxd rax, DWORD PTR [rbp-48]
+    shl rax, 1
+    add rax, rdi
+    mov DWORD PTR [rbp-48], eax
+    movsxd rax, DWORD PTR [rip+gv+60]
+    mov rdi, rax
+    movsxd rax, DWORD PTR [rbp-48]
+    shl rax, 1
+    add rax, rdi
+    mov DWORD PTR [rbp-48], eax
+    movsxd rax, DWORD PTR [rip+gv+48]
+    mov rdi, rax
+    movsxd rax, DWORD PTR [rbp-48]
+    shl rax, 1
+    add rax, rdi
+    mov DWORD PTR [rbp-48], eax
+    movsxd rax, DWORD PTR [rip+gv+36]
+    mov rdi, rax
+    movsxd rax, DWORD PTR [rbp-48]
+    shl rax, 1
+    add rax, rdi
+    mov DWORD PTR [rbp-48], eax
+    movsxd rax, DWORD PTR [rip+gv+24]
+    mov rdi, rax
+    movsxd rax, DWORD PTR [rbp-48]
+    shl rax, 1
+    add rax, rdi
+    mov DWORD PTR [rbp-48], eax
+    movsxd rax, DWORD PTR [rip+gv+12]
+    mov rdi, rax
+    movsxd rax, DWORD PTR [rbp-48]
+    shl rax, 1
+    add rax, rdi
+    mov DWORD PTR [rbp-48], eax
+    xor eax, eax
+    mov DWORD PTR [rbp-44], eax
+    movsxd rax, eax
+    mov rdi, rax
+    movsxd rax, DWORD PTR [rbp-48]
+    add rax, rdi
+    mov rsi, rax
+    mov rdi, 405513
+    call assert
+    movsxd rax, eax
+    mov DWORD PTR [rbp-48], 0
+    add DWORD PTR [rbp-48], 4
+    add DWORD PTR [rbp-48], 16
+    add DWORD PTR [rbp-48], 36
+    add DWORD PTR [rbp-48], 64
+    add DWORD PTR [rbp-48], 100
+    mov rax, 12
+    mov DWORD PTR [rbp-44], eax
+    movsxd rax, eax
+    mov rdi, rax
+    movsxd rax, DWORD PTR [rbp-48]
+    add rax, rdi
+    mov rsi, rax
+    mov rdi, 232
+    call assert
+    movsxd rax, eax
+    mov DWORD PTR [rbp-52], 0
+    xor eax, eax
+    mov DWORD PTR [rbp-44], eax
+    movsxd rax, eax
+    cmp rax, 3
+    jge .Lend72
+    .p2align 4
+.Lbegin72:
+    movsxd rax, DWORD PTR [rbp-44]
+    shl rax, 1
+    add DWORD PTR [rbp-52], eax
+    movsxd rax, DWORD PTR [rbp-44]
+    shl rax, 1
+    mov rdi, rax
+    movsxd rax, DWORD PTR [rbp-52]
+    add rax, rdi
+    add rax, 1
+    mov DWORD PTR [rbp-52], eax
+    movsxd rax, DWORD PTR [rbp-44]
+    shl rax, 1
+    mov rdi, rax
+    movsxd rax, DWORD PTR [rbp-52]
+    add rax, rdi
+    add rax, 2
+    mov DWORD PTR [rbp-52], eax
+    movsxd rax, DWORD PTR [rbp-44]
+    shl rax, 1
+    mov rdi, rax
+    movsxd rax, DWORD PTR [rbp-52]
+    add rax, rdi
+    add rax, 3
+    mov DWORD PTR [rbp-52], eax
+    movsxd rax, DWORD PTR [rbp-44]
+    shl rax, 1
+    mov rdi, rax
+    movsxd rax, DWORD PTR [rbp-52]
+    add rax, rdi
+    add rax, 4
+    mov DWORD PTR [rbp-52], eax
+    mov rax, 5
+    mov DWORD PTR [rbp-48], eax
+    inc DWORD PTR [rbp-44]
+    movsxd rax, DWORD PTR [rbp-44]
+    cmp rax, 3
+    jl .Lbegin72
+.Lend72:
+    movsxd rax, DWORD PTR [rbp-48]
+    push rax
+    movsxd rax, DWORD PTR [rbp-44]
+    mov rdi, rax
+    movsxd rax, DWORD PTR [rbp-52]
+    add rax, rdi
+    pop rdi
+    add rax, rdi
+    mov rsi, rax
+    mov rdi, 68
+    call assert
+    movsxd rax, eax
+    mov DWORD PTR [rbp-44], 7
+    mov rax, 7
+    mov rsi, rax
+    mov rdi, 7
+    call assert
+    movsxd rax, eax
+    mov DWORD PTR [rbp-44], 1
+    mov rax, 1
+    mov DWORD PTR [rbp-48], eax
+    movsxd rax, eax
+    mov rdi, rax
+    movsxd rax, DWORD PTR [rbp-44]
+    add rax, rdi
+    add rax, 2
+    mov DWORD PTR [rbp-44], eax
+    movsxd rax, eax
+    mov rsi, rax
+    mov rdi, 4
+    call assert
+    movsxd rax, eax
+    mov DWORD PTR [rbp-48], 3
+    mov rax, 9
+    mov DWORD PTR [rip+gl], eax
+    mov DWORD PTR [rbp-48], eax
+    mov DWORD PTR [rbp-44], eax
+    movsxd rax, DWORD PTR [rbp-48]
+    mov rsi, rax
+    mov rdi, 9
+    call assert
+    movsxd rax, eax
+    mov DWORD PTR [rbp-44], 2
+    mov rax, 2
+    cmp eax, 1
+    je .Lcase74
+    cmp eax, 2
+    je .Lcase75
+    jmp .Lcase76
+.Lcase74:
+    mov rax, 10
+    mov DWORD PTR [rbp-44], eax
+    jmp .Lend73
+.Lcase75:
+    mov rax, 20
+    mov DWORD PTR [rbp-44], eax
+    jmp .Lend73
+.Lcase76:
+    mov rax, 30
+    mov DWORD PTR [rbp-44], eax
+.Lend73:
+    movsxd rax, DWORD PTR [rbp-44]
+    mov rsi, rax
+    mov rdi, 20
+    call assert
+    movsxd rax, eax
+    mov DWORD PTR [rbp-44], 5
+    mov rax, 7
+    cmp eax, 1
+    je .Lcase78
+    jmp .Lend77
+.Lcase78:
+    mov rax, 1
+    mov DWORD PTR [rbp-44], eax
+.Lend77:
+    movsxd rax, DWORD PTR [rbp-44]
+    mov rsi, rax
+    mov rdi, 5
+    call assert
+    movsxd rax, eax
+    mov DWORD PTR [rbp-48], 0
+    mov rax, -1
+    mov DWORD PTR [rbp-44], eax
+    movsxd rax, eax
+    cmp rax, 10
+    jge .Lend79
+    .p2align 4
+.Lbegin79:
+    movsxd rax, DWORD PTR [rbp-44]
+    cmp eax, 6
+    ja .Lcase87
+    lea rdx, [rip+.Ltable88]
+    movsxd rax, DWORD PTR [rdx+rax*4]
+    add rax, rdx
+    jmp rax
+    .section .rodata
+    .p2align 2
+.Ltable88:
+    .long .Lcase81-.Ltable88
+    .long .Lcase82-.Ltable88
+    .long .Lcase83-.Ltable88
+    .long .Lcase84-.Ltable88
+    .long .Lcase85-.Ltable88
+    .long .Lcase87-.Ltable88
+    .long .Lcase86-.Ltable88
+    .text
+.Lcase81:
+    movsxd rax, DWORD PTR [rbp-48]
+    add rax, 1
+    mov DWORD PTR [rbp-48], eax
+.Lcase82:
+    movsxd rax, DWORD PTR [rbp-48]
+    add rax, 2
+    mov DWORD PTR [rbp-48], eax
+    jmp .Lend80
+.Lcase83:
+    movsxd rax, DWORD PTR [rbp-48]
+    add rax, 4
+    mov DWORD PTR [rbp-48], eax
+    jmp .Lend80
+.Lcase84:
+.Lcase85:
+    movsxd rax, DWORD PTR [rbp-48]
+    add rax, 8
+    mov DWORD PTR [rbp-48], eax
+    jmp .Lend80
+.Lcase86:
+    movsxd rax, DWORD PTR [rbp-48]
+    add rax, 16
+    mov DWORD PTR [rbp-48], eax
+    jmp .Lend80
+.Lcase87:
+    movsxd rax, DWORD PTR [rbp-48]
+    add rax, 100
+    mov DWORD PTR [rbp-48], eax
+.Lend80:
+    inc DWORD PTR [rbp-44]
+    movsxd rax, DWORD PTR [rbp-44]
+    cmp rax, 10
+    jl .Lbegin79
+.Lend79:
+    movsxd rax, DWORD PTR [rbp-48]
+    mov rsi, rax
+    mov rdi, 541
+    call assert
+    movsxd rax, eax
+    mov DWORD PTR [rbp-48], 0
+    xor eax, eax
+    mov DWORD PTR [rbp-44], eax
+    movsxd rax, eax
+    cmp rax, 3000
+    jge .Lend89
+    .p2align 4
+.Lbegin89:
+    movsxd rax, DWORD PTR [rbp-44]
+    imul rax, rax, 7
+    cmp eax, 21
+    je .Lcase97
+    jg .Lsplit98
+    cmp eax, -7
+    je .Lcase96
+    cmp eax, 0
+    je .Lcase91
+    cmp eax, 14
+    je .Lcase92
+    jmp .Lend90
+.Lsplit98:
+    cmp eax, 700
+    je .Lcase93
+    cmp eax, 7000
+    je .Lcase94
+    cmp eax, 20993
+    je .Lcase95
+    jmp .Lend90
+.Lcase91:
+    movsxd rax, DWORD PTR [rbp-48]
+    add rax, 1
+    mov DWORD PTR [rbp-48], eax
+    jmp .Lend90
+.Lcase92:
+    movsxd rax, DWORD PTR [rbp-48]
+    add rax, 2
+    mov DWORD PTR [rbp-48], eax
+    jmp .Lend90
+.Lcase93:
+    movsxd rax, DWORD PTR [rbp-48]
+    add rax, 3
+    mov DWORD PTR [rbp-48], eax
+    jmp .Lend90
+.Lcase94:
+    movsxd rax, DWORD PTR [rbp-48]
+    add rax, 4
+    mov DWORD PTR [rbp-48], eax
+    jmp .Lend90
+.Lcase95:
+    movsxd rax, DWORD PTR [rbp-48]
+    add rax, 5
+    mov DWORD PTR [rbp-48], eax
+    jmp .Lend90
+.Lcase96:
+    movsxd rax, DWORD PTR [rbp-48]
+    add rax, 6
+    mov DWORD PTR [rbp-48], eax
+    jmp .Lend90
+.Lcase97:
+    movsxd rax, DWORD PTR [rbp-48]
+    add rax, 7
+    mov DWORD PTR [rbp-48], eax
+.Lend90:
+    inc DWORD PTR [rbp-44]
+    movsxd rax, DWORD PTR [rbp-44]
+    cmp rax, 3000
+    jl .Lbegin89
+.Lend89:
+    movsxd rax, DWORD PTR [rbp-48]
+    mov rsi, rax
+    mov rdi, 22
+    call assert
+    movsxd rax, eax
+    mov DWORD PTR [rbp-48], 0
+    xor eax, eax
+    cmp eax, 0
+    je .Lcase101
+    cmp eax, 1
+    je .Lcase100
+    cmp eax, 3
+    je .Lcase102
+    jmp .Lend99
+.Lcase100:
+    movsxd rax, DWORD PTR [rbp-48]
+    add rax, 2
+    mov DWORD PTR [rbp-48], eax
+    jmp .Lend99
+.Lcase101:
+    movsxd rax, DWORD PTR [rbp-48]
+    add rax, 1
+    mov DWORD PTR [rbp-48], eax
+    jmp .Lend99
+.Lcase102:
+    movsxd rax, DWORD PTR [rbp-48]
+    add rax, 9
+    mov DWORD PTR [rbp-48], eax
+.Lend99:
+    mov rax, 1
+    cmp eax, 0
+    je .Lcase105
+    cmp eax, 1
+    je .Lcase104
+    cmp eax, 3
+    je .Lcase106
+    jmp .Lend103
+.Lcase104:
+    movsxd rax, DWORD PTR [rbp-48]
+    add rax, 2
+    mov DWORD PTR [rbp-48], eax
+    jmp .Lend103
+.Lcase105:
+    movsxd rax, DWORD PTR [rbp-48]
+    add rax, 1
+    mov DWORD PTR [rbp-48], eax
+    jmp .Lend103
+.Lcase106:
+    movsxd rax, DWORD PTR [rbp-48]
+    add rax, 9
+    mov DWORD PTR [rbp-48], eax
+.Lend103:
+    mov rax, 2
+    cmp eax, 0
+    je .Lcase109
+    cmp eax, 1
+    je .Lcase108
+    cmp eax, 3
+    je .Lcase110
+    jmp .Lend107
+.Lcase108:
+    movsxd rax, DWORD PTR [rbp-48]
+    add rax, 2
+    mov DWORD PTR [rbp-48], eax
+    jmp .Lend107
+.Lcase109:
+    movsxd rax, DWORD PTR [rbp-48]
+    add rax, 1
+    mov DWORD PTR [rbp-48], eax
+    jmp .Lend107
+.Lcase110:
+    movsxd rax, DWORD PTR [rbp-48]
+    add rax, 9
+    mov DWORD PTR [rbp-48], eax
+.Lend107:
+    mov rax, 3
+    cmp eax, 0
+    je .Lcase113
+    cmp eax, 1
+    je .Lcase112
+    cmp eax, 3
+    je .Lcase114
+    jmp .Lend111
+.Lcase112:
+    movsxd rax, DWORD PTR [rbp-48]
+    add rax, 2
+    mov DWORD PTR [rbp-48], eax
+    jmp .Lend111
+.Lcase113:
+    movsxd rax, DWORD PTR [rbp-48]
+    add rax, 1
+    mov DWORD PTR [rbp-48], eax
+    jmp .Lend111
+.Lcase114:
+    movsxd rax, DWORD PTR [rbp-48]
+    add rax, 9
+    mov DWORD PTR [rbp-48], eax
+.Lend111:
+    mov rax, 4
+    mov DWORD PTR [rbp-44], eax
+    movsxd rax, DWORD PTR [rbp-48]
+    mov rsi, rax
+    mov rdi, 12
+    call assert
+    movsxd rax, eax
+    xor eax, eax
+    mov DWORD PTR [rbp-44], eax
+    movsxd rax, eax
+    cmp rax, 100
+    jge .Lend115
+    .p2align 4
+.Lbegin115:
+    movsxd rax, DWORD PTR [rbp-44]
+    mov rdi, rax
+    movsxd rax, DWORD PTR [rbp-44]
+    imul rax, rdi
+    cmp rax, 200
+    jle .Lelse116
+    jmp .Lend115
+.Lelse116:
+.Lend116:
+    inc DWORD PTR [rbp-44]
+    movsxd rax, DWORD PTR [rbp-44]
+    cmp rax, 100
+    jl .Lbegin115
+.Lend115:
+    movsxd rax, DWORD PTR [rbp-44]
+    mov rsi, rax
+    mov rdi, 15
+    call assert
+    movsxd rax, eax
+    mov DWORD PTR [rbp-48], 0
+    xor eax, eax
+    mov DWORD PTR [rbp-44], eax
+    movsxd rax, eax
+    cmp rax, 5
+    jge .Lend117
+    .p2align 4
+.Lbegin117:
+    movsxd rax, DWORD PTR [rbp-44]
+    cmp rax, 0
+    jle .Lelse118
+    jmp .Lend117
+.Lelse118:
+.Lend118:
+    movsxd rax, DWORD PTR [rbp-48]
+    add rax, 1
+    mov DWORD PTR [rbp-48], eax
+    inc DWORD PTR [rbp-44]
+    movsxd rax, DWORD PTR [rbp-44]
+    cmp rax, 5
+    jl .Lbegin117
+.Lend117:
+    xor eax, eax
+    mov DWORD PTR [rbp-44], eax
+    movsxd rax, eax
+    cmp rax, 5
+    jge .Lend119
+    .p2align 4
+.Lbegin119:
+    movsxd rax, DWORD PTR [rbp-44]
+    cmp rax, 1
+    jle .Lelse120
+    jmp .Lend119
+.Lelse120:
+.Lend120:
+    movsxd rax, DWORD PTR [rbp-48]
+    add rax, 1
+    mov DWORD PTR [rbp-48], eax
+    inc DWORD PTR [rbp-44]
+    movsxd rax, DWORD PTR [rbp-44]
+    cmp rax, 5
+    jl .Lbegin119
+.Lend119:
+    xor eax, eax
+    mov DWORD PTR [rbp-44], eax
+    movsxd rax, eax
+    cmp rax, 5
+    jge .Lend121
+    .p2align 4
+.Lbegin121:
+    movsxd rax, DWORD PTR [rbp-44]
+    cmp rax, 2
+    jle .Lelse122
+    jmp .Lend121
+.Lelse122:
+.Lend122:
+    movsxd rax, DWORD PTR [rbp-48]
+    add rax, 1
+    mov DWORD PTR [rbp-48], eax
+    inc DWORD PTR [rbp-44]
+    movsxd rax, DWORD PTR [rbp-44]
+    cmp rax, 5
+    jl .Lbegin121
+.Lend121:
+    xor eax, eax
+    mov DWORD PTR [rbp-44], eax
+    movsxd rax, eax
+    cmp rax, 5
+    jge .Lend123
+    .p2align 4
+.Lbegin123:
+    movsxd rax, DWORD PTR [rbp-44]
+    cmp rax, 3
+    jle .Lelse124
+    jmp .Lend123
+.Lelse124:
+.Lend124:
+    movsxd rax, DWORD PTR [rbp-48]
+    add rax, 1
+    mov DWORD PTR [rbp-48], eax
+    inc DWORD PTR [rbp-44]
+    movsxd rax, DWORD PTR [rbp-44]
+    cmp rax, 5
+    jl .Lbegin123
+.Lend123:
+    xor eax, eax
+    mov DWORD PTR [rbp-44], eax
+    movsxd rax, eax
+    cmp rax, 5
+    jge .Lend125
+    .p2align 4
+.Lbegin125:
+    movsxd rax, DWORD PTR [rbp-44]
+    cmp rax, 4
+    jle .Lelse126
+    jmp .Lend125
+.Lelse126:
+.Lend126:
+    movsxd rax, DWORD PTR [rbp-48]
+    add rax, 1
+    mov DWORD PTR [rbp-48], eax
+    inc DWORD PTR [rbp-44]
+    movsxd rax, DWORD PTR [rbp-44]
+    cmp rax, 5
+    jl .Lbegin125
+.Lend125:
+    mov rax, 5
+    mov DWORD PTR [rbp-44], eax
+    movsxd rax, DWORD PTR [rbp-48]
+    mov rsi, rax
+    mov rdi, 15
+    call assert
+    movsxd rax, eax
+    mov DWORD PTR [rbp-48], 0
+    xor eax, eax
+    cmp eax, 2
+    je .Lcase128
+    jmp .Lcase129
+.Lcase128:
+    jmp .Lend127
+.Lcase129:
+    movsxd rax, DWORD PTR [rbp-48]
+    mov DWORD PTR [rbp-48], eax
+.Lend127:
+    movsxd rax, DWORD PTR [rbp-48]
+    add rax, 10
+    mov DWORD PTR [rbp-48], eax
+    mov rax, 1
+    cmp eax, 2
+    je .Lcase131
+    jmp .Lcase132
+.Lcase131:
+    jmp .Lend130
+.Lcase132:
+    movsxd rax, DWORD PTR [rbp-48]
+    add rax, 1
+    mov DWORD PTR [rbp-48], eax
+.Lend130:
+    movsxd rax, DWORD PTR [rbp-48]
+    add rax, 10
+    mov DWORD PTR [rbp-48], eax
+    mov rax, 2
+    cmp eax, 2
+    je .Lcase134
+    jmp .Lcase135
+.Lcase134:
+    jmp .Lend133
+.Lcase135:
+    movsxd rax, DWORD PTR [rbp-48]
+    add rax, 2
+    mov DWORD PTR [rbp-48], eax
+.Lend133:
+    movsxd rax, DWORD PTR [rbp-48]
+    add rax, 10
+    mov DWORD PTR [rbp-48], eax
+    mov rax, 3
+    cmp eax, 2
+    je .Lcase137
+    jmp .Lcase138
+.Lcase137:
+    jmp .Lend136
+.Lcase138:
+    movsxd rax, DWORD PTR [rbp-48]
+    add rax, 3
+    mov DWORD PTR [rbp-48], eax
+.Lend136:
+    movsxd rax, DWORD PTR [rbp-48]
+    add rax, 10
+    mov DWORD PTR [rbp-48], eax
+    mov rax, 4
+    cmp eax, 2
+    je .Lcase140
+    jmp .Lcase141
+.Lcase140:
+    jmp .Lend139
+.Lcase141:
+    movsxd rax, DWORD PTR [rbp-48]
+    add rax, 4
+    mov DWORD PTR [rbp-48], eax
+.Lend139:
+    movsxd rax, DWORD PTR [rbp-48]
+    add rax, 10
+    mov DWORD PTR [rbp-48], eax
+    mov rax, 5
+    mov DWORD PTR [rbp-44], eax
+    movsxd rax, DWORD PTR [rbp-48]
+    mov rsi, rax
+    mov rdi, 58
+    call assert
+    movsxd rax, eax
+    mov DWORD PTR [rbp-44], 0
+    .p2align 4
+.Lbegin142:
+    add DWORD PTR [rbp-44], 3
+    movsxd rax, DWORD PTR [rbp-44]
+    cmp rax, 20
+    jle .Lelse143
+    jmp .Lend142
+.Lelse143:
+.Lend143:
+    jmp .Lbegin142
+.Lend142:
+    movsxd rax, DWORD PTR [rbp-44]
+    mov rsi, rax
+    mov rdi, 21
+    call assert
+    movsxd rax, eax
+    mov DWORD PTR [rbp-44], 9
+    mov rax, 4
+    cmp rax, 9
+    mov rdi, 9
+    cmovl rax, rdi
+    mov DWORD PTR [rbp-44], eax
+    movsxd rax, eax
+    mov rsi, rax
+    mov rdi, 9
+    call assert
+    movsxd rax, eax
+    mov DWORD PTR [rbp-48], 0
+    xor eax, eax
+    add rax, 1
+    mov DWORD PTR [rbp-48], eax
+    movsxd rax, eax
+    add rax, 1
+    mov DWORD PTR [rbp-48], eax
+    movsxd rax, eax
+    add rax, 1
+    mov DWORD PTR [rbp-48], eax
+    movsxd rax, eax
+    add rax, 1
+    mov DWORD PTR [rbp-48], eax
+    movsxd rax, eax
+    add rax, 1
+    mov DWORD PTR [rbp-48], eax
+    mov rax, 10
+    mov DWORD PTR [rbp-44], eax
+    movsxd rax, DWORD PTR [rbp-48]
+    mov rsi, rax
+    mov rdi, 5
+    call assert
+    movsxd rax, eax
+    mov DWORD PTR [rbp-44], 0
+    mov r13, 0
+    mov rax, r13
+    add rax, 3
+    cmp rax, 10
+    jge .Lend144
+    .p2align 4
+.Lbegin144:
+    mov rax, r13
+    add rax, -5
+    push rax
+    mov rax, r13
+    neg rax
+    mov rdi, rax
+    mov rax, r13
+    cmp rax, 5
+    pop rax
+    cmovl rax, rdi
+    mov DWORD PTR [rbp-48], eax
+    movsxd rax, eax
+    mov rdi, rax
+    movsxd rax, DWORD PTR [rbp-44]
+    add rax, rdi
+    add rax, -1
+    mov DWORD PTR [rbp-44], eax
+    mov rax, r13
+    add rax, -4
+    push rax
+    mov rax, r13
+    add rax, 1
+    neg rax
+    mov rdi, rax
+    mov rax, r13
+    add rax, 1
+    cmp rax, 5
+    pop rax
+    cmovl rax, rdi
+    mov DWORD PTR [rbp-48], eax
+    movsxd rax, eax
+    mov rdi, rax
+    movsxd rax, DWORD PTR [rbp-44]
+    add rax, rdi
+    add rax, -1
+    mov DWORD PTR [rbp-44], eax
+    mov rax, r13
+    add rax, -3
+    push rax
+    mov rax, r13
+    add rax, 2
+    neg rax
+    mov rdi, rax
+    mov rax, r13
+    add rax, 2
+    cmp rax, 5
+    pop rax
+    cmovl rax, rdi
+    mov DWORD PTR [rbp-48], eax
+    movsxd rax, eax
+    mov rdi, rax
+    movsxd rax, DWORD PTR [rbp-44]
+    add rax, rdi
+    add rax, -1
+    mov DWORD PTR [rbp-44], eax
+    mov rax, r13
+    add rax, -2
+    push rax
+    mov rax, r13
+    add rax, 3
+    neg rax
+    mov rdi, rax
+    mov rax, r13
+    add rax, 3
+    cmp rax, 5
+    pop rax
+    cmovl rax, rdi
+    mov DWORD PTR [rbp-48], eax
+    movsxd rax, eax
+    mov rdi, rax
+    movsxd rax, DWORD PTR [rbp-44]
+    add rax, rdi
+    add rax, -1
+    mov DWORD PTR [rbp-44], eax
+    mov rax, r13
+    add rax, 4
+    movsxd r13, eax
+    mov rax, r13
+    add rax, 3
+    cmp rax, 10
+    jl .Lbegin144
+.Lend144:
+    mov rax, r13
+    cmp rax, 10
+    jge .Lend145
+    .p2align 4
+.Lbegin145:
+    mov rax, r13
+    add rax, -5
+    push rax
+    mov rax, r13
+    neg rax
+    mov rdi, rax
+    mov rax, r13
+    cmp rax, 5
+    pop rax
+    cmovl rax, rdi
+    mov DWORD PTR [rbp-48], eax
+    movsxd rax, eax
+    mov rdi, rax
+    movsxd rax, DWORD PTR [rbp-44]
+    add rax, rdi
+    add rax, -1
+    mov DWORD PTR [rbp-44], eax
+    mov rax, r13
+    add rax, 1
+    movsxd r13, eax
+    mov rax, r13
+    cmp rax, 10
+    jl .Lbegin145
+.Lend145:
+    movsxd rax, DWORD PTR [rbp-44]
+    mov rsi, rax
+    mov rdi, -10
+    call assert
+    movsxd rax, eax
+    mov DWORD PTR [rbp-44], 3
+    mov rax, 3
+    cmp rax, 3
+    sete al
+    movzb rax, al
+    mov DWORD PTR [rbp-44], eax
+    movsxd rax, eax
+    mov rsi, rax
+    mov rdi, 1
+    call assert
+    movsxd rax, eax
+    xor eax, eax
+    mov DWORD PTR [rbp-44], eax
+    movsxd rax, eax
+    cmp rax, 3
+    jge .Lend146
+    .p2align 4
+.Lbegin146:
+    inc DWORD PTR [rbp-44]
+    movsxd rax, DWORD PTR [rbp-44]
+    cmp rax, 3
+    jl .Lbegin146
+.Lend146:
+    movsxd rax, DWORD PTR [rbp-44]
+    mov rsi, rax
+    mov rdi, 3
+    call assert
+    movsxd rax, eax
+    mov DWORD PTR [rbp-44], 0
+    xor eax, eax
+    cmp rax, 4
+    jge .Lend147
+    .p2align 4
+.Lbegin147:
+    inc DWORD PTR [rbp-44]
+    movsxd rax, DWORD PTR [rbp-44]
+    cmp rax, 9
+    jle .Lelse148
+.Lelse148:
+.Lend148:
+    movsxd rax, DWORD PTR [rbp-44]
+    cmp rax, 4
+    jl .Lbegin147
+.Lend147:
+    movsxd rax, DWORD PTR [rbp-44]
+    mov rsi, rax
+    mov rdi, 4
+    call assert
+    movsxd rax, eax
+    mov DWORD PTR [rbp-44], 5
+    mov rax, 5
+    cmp eax, 5
+    je .Lcase150
+.Lcase150:
+.Lend149:
+    movsxd rax, DWORD PTR [rbp-44]
+    mov rsi, rax
+    mov rdi, 5
+    call assert
+    movsxd rax, eax
+    mov BYTE PTR [rbp-49], 5
+    mov DWORD PTR [rbp-48], 0
+    movsx rax, BYTE PTR [rbp-49]
+    imul rax, rax, 255
+    mov DWORD PTR [rbp-44], eax
+    movsxd rax, eax
+    cmp rax, 0
+    setl al
+    movzb rax, al
+    add DWORD PTR [rbp-48], eax
+    movsxd rax, DWORD PTR [rbp-44]
+    cmp rax, 1
+    setl al
+    movzb rax, al
+    add DWORD PTR [rbp-48], eax
+    movsxd rax, DWORD PTR [rbp-44]
+    cmp rax, 2
+    setl al
+    movzb rax, al
+    add DWORD PTR [rbp-48], eax
+    mov rax, 3
+    mov DWORD PTR [rbp-44], eax
+    movsxd rax, DWORD PTR [rbp-48]
+    mov rsi, rax
+    mov rdi, 0
+    call assert
+    movsxd rax, eax
+    mov BYTE PTR [rbp-41], 5
+    mov rax, 5
+    imul rax, rax, 255
+    mov DWORD PTR [rbp-48], eax
+    movsxd rax, eax
+    cmp rax, 1
+    setl al
+    movzb rax, al
+    add rax, 0
+    mov DWORD PTR [rbp-44], eax
+    movsxd rax, DWORD PTR [rbp-48]
+    cmp rax, 2
+    setl al
+    movzb rax, al
+    add DWORD PTR [rbp-44], eax
+    movsxd rax, DWORD PTR [rbp-48]
+    cmp rax, 3
+    setl al
+    movzb rax, al
+    add DWORD PTR [rbp-44], eax
+    movsxd rax, DWORD PTR [rbp-44]
+    mov rsi, rax
+    mov rdi, 0
+    call assert
+    movsxd rax, eax
+    mov rdi, 10
+    mov rsi, 10
+    call assert
+    movsxd rax, eax
+    mov rdi, 5
+    mov rsi, 5
+    call assert
+    movsxd rax, eax
+    mov rdi, 30
+    mov rsi, 30
+    call assert
+    movsxd rax, eax
+    mov DWORD PTR [rbp-44], 3
+    mov DWORD PTR [rbp-48], 0
+    .p2align 4
+.Lbegin151:
+    movsxd rax, DWORD PTR [rbp-44]
+    add DWORD PTR [rbp-48], eax
+    movsxd rax, DWORD PTR [rbp-48]
+    cmp rax, 20
+    jle .Lelse152
+    jmp .Lend151
+.Lelse152:
+.Lend152:
+    jmp .Lbegin151
+.Lend151:
+    .p2align 4
+.Lbegin153:
+    dec DWORD PTR [rbp-48]
+    movsxd rax, DWORD PTR [rbp-48]
+    cmp rax, 15
+    jge .Lelse154
+    jmp .Lend153
+.Lelse154:
+.Lend154:
+    jmp .Lbegin153
+.Lend153:
+    movsxd rax, DWORD PTR [rbp-48]
+.loop_always.i1.return:
+    mov rsi, rax
+    mov rdi, 14
+    call assert
+    movsxd rax, eax
+    mov rdi, 103
+    mov rsi, 103
+    call assert
+    movsxd rax, eax
+    mov rdi, 100
+    mov rsi, 100
+    call assert
+    movsxd rax, eax
+    lea rdi, [rip+.L..0]
+    call printf
+    movsxd rax, eax
+    xor eax, eax
+.main.return:
+    lea rsp, [rbp-40]
+    pop r15
+    pop r14
+    pop r13
+    pop r12
+    pop rbx
+    pop rbp
+    ret
@@ -26,12 +26,201 @@ int sub_char(char a, char b, char c) {
   return a - b - c;
 }
 
+int max2(int x, int y) {
+  if (x > y)
+    return x;
+  return y;
+}
+
+int sum_to(int n) {
+  int s;
+  int i;
+  s = 0;
+  for (i = 1; i <= n; i = i + 1)
+    s = s + i;
+  return s;
+}
+
+int twice(int x) {
+  return add2(x, x);
+}
+
+int sum_tail(int n, int acc) {
+  if (n == 0)
+    return acc;
+  return sum_tail(n - 1, acc + n);
+}
+
+int is_odd(int n);
+
+int is_even(int n) {
+  if (n == 0)
+    return 1;
+  return is_odd(n - 1);
+}
+
+int is_odd(int n) {
+  if (n == 0)
+    return 0;
+  return is_even(n - 1);
+}
+
+int char_tail(char c, int n) {
+  if (n == 0)
+    return c;
+  return char_tail(c + 1, n - 1);
+}
+
+int addr_tail(int x) {
+  int y;
+  y = x * 2;
+  return addx(&y, x);
+}
+
+int ret_in_expr(int x) {
+  return add2(10, ({ if (x > 0) return x; 3; }));
+}
+
+int add8(int a, int b, int c, int d, int e, int f, int g, char h) {
+  return a + b*2 + c*3 + d*4 + e*5 + f*6 + g*7 + h*8;
+}
+
+int swap_sub(int x, int y) {
+  return sub2(y, x);
+}
+
 int fib(int x) {
   if (x<=1)
     return 1;
   return fib(x-1) + fib(x-2);
 }
 
+static int counter;
+static int unused_counter;
+
+static int bump(int x) {
+  counter = counter + x;
+  return counter;
+}
+
+static int never_called(int x) {
+  return bump(x) + unused_counter;
+}
+
+int dead_code(int x) {
+  int y;
+  y = x * 100;
+  if (0)
+    return -1;
+  y = x + 1;
+  return y;
+  y = 5;
+  return y;
+}
+
+int find_char(char *p, int n, char c) {
+  int i;
+  for (i = 0; i < n; i = i + 1)
+    if (p[i] == c)
+      return i;
+  return -1;
+}
+
+int dispatch(int op, int a, int b) {
+  switch (op) {
+    case 0: return a + b;
+    case 1: return a - b;
+    case 2: return a * b;
+    case 3: return a / b;
+    case 4: return a % b;
+    default: return -1;
+  }
+}
+
+int clamp(int x, int lo, int hi) {
+  if (x < lo) return lo;
+  if (x > hi) return hi;
+  return x;
+}
+
+int arr_min(int *a, int n) {
+  int i;
+  int m;
+  m = a[0];
+  for (i = 1; i < n; i = i + 1)
+    if (a[i] < m)
+      m = a[i];
+  return m;
+}
+
+int sign(int x) {
+  int s;
+  if (x > 0) s = 1; else s = 0;
+  if (x < 0) s = -1;
+  return s;
+}
+
+int hist[8];
+
+int histogram(char *s, int n) {
+  int i;
+  for (i = 0; i < n; i = i + 1)
+    hist[s[i] % 8] = hist[s[i] % 8] + 1;
+  return hist[1] * 10 + hist[0];
+}
+
+static int sum_sq(int n) {
+  int s;
+  int i;
+  s = 0;
+  for (i = 1; i <= n; i = i + 1)
+    s = s + i * i;
+  return s;
+}
+
+static int set_counter(int x) {
+  counter = x;
+  return x;
+}
+
+// ループの外に出した比較の値がスタックに置かれる
+int hoist_cmp(int p0, int q) {
+  int i; int s; int a; int b; int c; int d; int e; int f; int g; int h; int j; int k;
+  s = 0; a = 1; b = 2; c = 3; d = 4; e = 5; f = 6; g = 7; h = 8; j = 9; k = 10;
+  for (i = 0; i < 3; i = i + 1) {
+    s = s + (p0 < (7 != q));
+    a = a + b; b = b + c; c = c + d; d = d + e; e = e + f;
+    f = f + g; g = g + h; h = h + j; j = j + k; k = k + a;
+  }
+  return s + a + b + c + d + e + f + g + h + j + k;
+}
+
+// 呼び出し側の変数を退避したレジスタに置く
+int hoist_caller(int x) {
+  int a; int b; int c; int d; int e; int f; int g; int h; int j; int k; int r;
+  a = x + 1; b = x + 2; c = x + 3; d = x + 4; e = x + 5;
+  f = x + 6; g = x + 7; h = x + 8; j = x + 9; k = x + 10;
+  r = hoist_cmp(0, x);
+  return r + a + b + c + d + e + f + g + h + j + k;
+}
+
+// ループを回るたびに変数の値を入れ替える(φ関数の巡回する代入)
+int rotate3(int n) {
+  int x; int y; int z; int t;
+  x = 1; y = 2; z = 3;
+  while (n > 0) { t = x; x = y; y = z; z = t; n = n - 1; }
+  return x * 100 + y * 10 + z;
+}
+
+// 呼び出しをまたいで生きる値がレジスタに収まらない
+int spill_call(int n) {
+  int a; int b; int c; int d; int e; int f; int g; int h; int s;
+  a = n; b = n * 2; c = n * 3; d = n * 4; e = n * 5; f = n * 6; g = n * 7; h = n * 8;
+  s = add6(a, b, c, d, e, f) + sum_sq(n);
+  s = s + add8(h, g, f, e, d, c, b, a);
+  return s + a + b + c + d + e + f + g + h;
+}
+
 int main() {
     ASSERT(3, ret3());
     ASSERT(8, add2(3, 5));
@@ -44,8 +233,57 @@ int main() {
     ASSERT(7, add2(3,4));
     ASSERT(1, sub2(4,3));
     ASSERT(55, fib(9));
+    ASSERT(7, max2(7, 3));
+    ASSERT(7, max2(3, 7));
+    ASSERT(55, sum_to(10));
+    ASSERT(10, twice(5));
+    ASSERT(30, ({ int i; int t; t=0; for (i=0; i<5; i=i+1) t = t + max2(i, 6); t; }));
+    ASSERT(18, max2(sum_to(3), twice(max2(4, 9))));
+    ASSERT(705082704, sum_tail(100000, 0));
+    ASSERT(1, is_even(100000));
+    ASSERT(0, is_odd(100000));
+    ASSERT(-126, char_tail(120, 10));
+    ASSERT(15, addr_tail(5));
+    ASSERT(7, ret_in_expr(7));
+    ASSERT(13, ret_in_expr(0));
+    ASSERT(204, add8(1, 2, 3, 4, 5, 6, 7, 8));
+    ASSERT(60, add8(add8(1, 1, 1, 1, 1, 1, 1, 1), 0, 0, 0, 0, 0, 0, add2(1, 2)));
+    ASSERT(-52, add8(1, 2, 3, 4, 5, 6, 7, 1000));
+    ASSERT(3, swap_sub(2, 5));
+    ASSERT(9, ({ int x; int y; x=4; y=5; add2(x, sub2(y + x, x)) ; }));
 
     ASSERT(1, ({ sub_char(7, 3, 3); }));
+    ASSERT(3, bump(3));
+    ASSERT(7, bump(4));
+    ASSERT(7, counter);
+    ASSERT(6, dead_code(5));
+    ASSERT(37, ({ char s[50]; int i; for (i=0; i<50; i=i+1) s[i]=i; find_char(s, 50, 37); }));
+    ASSERT(-1, ({ char s[50]; int i; for (i=0; i<50; i=i+1) s[i]=i; find_char(s, 20, 37); }));
+    ASSERT(-1, ({ char s[50]; int i; for (i=0; i<50; i=i+1) s[i]=i; find_char(s, 50, 60); }));
+    ASSERT(121393, fib(25));
+    ASSERT(338350, sum_sq(100));
+    ASSERT(36, sum_sq(3) * 2 + fib(5));
+    ASSERT(-156, sub_char(200, 100, 0));
+    ASSERT(9, set_counter(9));
+    ASSERT(9, counter);
+    ASSERT(7, dispatch(0, 3, 4));
+    ASSERT(-1, dispatch(1, 3, 4));
+    ASSERT(12, dispatch(2, 3, 4));
+    ASSERT(3, dispatch(4, 11, 4));
+    ASSERT(-1, dispatch(9, 3, 4));
+    ASSERT(-3, clamp(-9, -3, 3));
+    ASSERT(3, clamp(9, -3, 3));
+    ASSERT(2, clamp(2, -3, 3));
+    ASSERT(-7, ({ int a[6]; a[0]=4; a[1]=-2; a[2]=9; a[3]=-7; a[4]=0; a[5]=-7; arr_min(a, 6); }));
+    ASSERT(1, sign(42));
+    ASSERT(0, sign(0));
+    ASSERT(-1, sign(-5));
+    ASSERT(44, ({ char s[30]; int i; for (i=0; i<30; i=i+1) s[i]=i*3; histogram(s, 30); }));
+    ASSERT(88, ({ char s[30]; int i; for (i=0; i<30; i=i+1) s[i]=i*3; histogram(s, 30); }));
+    ASSERT(558, ({ set_counter(3); hoist_caller(counter); }));
+    ASSERT(231, rotate3(4));
+    ASSERT(123, rotate3(0));
+    ASSERT(359, spill_call(2));
      
     printf("OK\n");
 	return 0;
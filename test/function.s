@@ -0,0 +1,3107 @@
+.intel_syntax noprefix
+.data
+.global .L..0
+.L..0:
+    .byte 79
+    .byte 75
+    .byte 10
+    .byte 0
+.global ret3
+.text
+ret3:
+.ret3.entry:
+    mov rax, 3
+.ret3.return:
+    ret
+.global add2
+.text
+add2:
+    movsxd r11, esi
+    movsxd r10, edi
+.add2.entry:
+    mov rax, r11
+    mov rdi, rax
+    mov rax, r10
+    add rax, rdi
+.add2.return:
+    ret
+.global sub2
+.text
+sub2:
+    movsxd r11, esi
+    movsxd r10, edi
+.sub2.entry:
+    mov rax, r11
+    mov rdi, rax
+    mov rax, r10
+    sub rax, rdi
+.sub2.return:
+    ret
+.global add6
+.text
+add6:
+    push rbx
+    push r12
+    push r13
+    push r14
+    movsxd r14, r9d
+    movsxd r13, r8d
+    movsxd r12, ecx
+    movsxd rbx, edx
+    movsxd r11, esi
+    movsxd r10, edi
+.add6.entry:
+    mov rax, r14
+    push rax
+    mov rax, r13
+    push rax
+    mov rax, r12
+    push rax
+    mov rax, rbx
+    push rax
+    mov rax, r11
+    mov rdi, rax
+    mov rax, r10
+    add rax, rdi
+    pop rdi
+    add rax, rdi
+    pop rdi
+    add rax, rdi
+    pop rdi
+    add rax, rdi
+    pop rdi
+    add rax, rdi
+.add6.return:
+    pop r14
+    pop r13
+    pop r12
+    pop rbx
+    ret
+.global addx
+.text
+addx:
+    movsxd r11, esi
+    mov r10, rdi
+.addx.entry:
+    mov rax, r11
+    mov rdi, rax
+    movsxd rax, DWORD PTR [r10]
+    add rax, rdi
+.addx.return:
+    ret
+.global sub_char
+.text
+sub_char:
+    movsx rcx, dl
+    movsx r11, sil
+    movsx r10, dil
+.sub_char.entry:
+    mov rax, rcx
+    push rax
+    mov rax, r11
+    mov rdi, rax
+    mov rax, r10
+    sub rax, rdi
+    pop rdi
+    sub rax, rdi
+.sub_char.return:
+    ret
+.global max2
+.text
+max2:
+    movsxd r11, esi
+    movsxd r10, edi
+.max2.entry:
+    mov rax, r11
+    mov rdi, rax
+    mov rax, r10
+    cmp rax, rdi
+    cmovle rax, rdi
+.max2.return:
+    ret
+.global sum_to
+.text
+sum_to:
+    movsxd rsi, edi
+.sum_to.entry:
+    mov r11, 0
+    mov r10, 1
+    mov rax, rsi
+    mov rdi, rax
+    mov rax, r10
+    add rax, 3
+    cmp rax, rdi
+    jg .Lend1
+    .p2align 4
+.Lbegin1:
+    mov rax, r10
+    mov rdi, rax
+    mov rax, r11
+    add rax, rdi
+    movsxd r11, eax
+    mov rax, r10
+    mov rdi, rax
+    mov rax, r11
+    add rax, rdi
+    add rax, 1
+    movsxd r11, eax
+    mov rax, r10
+    mov rdi, rax
+    mov rax, r11
+    add rax, rdi
+    add rax, 2
+    movsxd r11, eax
+    mov rax, r10
+    mov rdi, rax
+    mov rax, r11
+    add rax, rdi
+    add rax, 3
+    movsxd r11, eax
+    mov rax, r10
+    add rax, 4
+    movsxd r10, eax
+    mov rax, rsi
+    mov rdi, rax
+    mov rax, r10
+    add rax, 3
+    cmp rax, rdi
+    jle .Lbegin1
+.Lend1:
+    mov rax, rsi
+    mov rdi, rax
+    mov rax, r10
+    cmp rax, rdi
+    jg .Lend2
+    .p2align 4
+.Lbegin2:
+    mov rax, r10
+    mov rdi, rax
+    mov rax, r11
+    add rax, rdi
+    movsxd r11, eax
+    mov rax, r10
+    add rax, 1
+    movsxd r10, eax
+    mov rax, rsi
+    mov rdi, rax
+    mov rax, r10
+    cmp rax, rdi
+    jle .Lbegin2
+.Lend2:
+    mov rax, r11
+.sum_to.return:
+    ret
+.global twice
+.text
+twice:
+    movsxd r10, edi
+.twice.entry:
+    mov rax, r10
+    movsxd r11, eax
+    mov rax, r10
+    movsxd rsi, eax
+    mov rax, r10
+    mov rdi, rax
+    mov rax, r10
+    add rax, rdi
+.add2.i26.return:
+.twice.return:
+    ret
+.global sum_tail
+.text
+sum_tail:
+    push rbp
+    mov rbp, rsp
+    push rbx
+    push r12
+    movsxd r12, esi
+    movsxd rbx, edi
+.sum_tail.entry:
+    mov rax, rbx
+    cmp rax, 0
+    jne .Lelse3
+    mov rax, r12
+    jmp .sum_tail.return
+.Lelse3:
+.Lend3:
+    mov rax, rbx
+    add rax, -1
+    mov r10, rax
+    mov rax, rbx
+    mov rdi, rax
+    mov rax, r12
+    add rax, rdi
+    mov rdi, r10
+    mov rsi, rax
+    movsxd r12, esi
+    movsxd rbx, edi
+    jmp .sum_tail.entry
+.sum_tail.return:
+    lea rsp, [rbp-16]
+    pop r12
+    pop rbx
+    pop rbp
+    ret
+.global is_even
+.text
+is_even:
+    push rbp
+    mov rbp, rsp
+    push rbx
+    sub rsp, 8
+    movsxd rbx, edi
+.is_even.entry:
+    mov rax, rbx
+    cmp rax, 0
+    jne .Lelse4
+    mov rax, 1
+    jmp .is_even.return
+.Lelse4:
+.Lend4:
+    mov rax, rbx
+    add rax, -1
+    mov rdi, rax
+    lea rsp, [rbp-8]
+    pop rbx
+    pop rbp
+    jmp is_odd
+.is_even.return:
+    lea rsp, [rbp-8]
+    pop rbx
+    pop rbp
+    ret
+.global is_odd
+.text
+is_odd:
+    push rbp
+    mov rbp, rsp
+    push rbx
+    push r12
+    movsxd r12, edi
+.is_odd.entry:
+    mov rax, r12
+    cmp rax, 0
+    jne .Lelse5
+    xor eax, eax
+    jmp .is_odd.return
+.Lelse5:
+.Lend5:
+    mov rax, r12
+    add rax, -1
+    movsxd rbx, eax
+    mov rax, rbx
+    cmp rax, 0
+    jne .Lelse6
+    mov rax, 1
+    jmp .is_even.i2.return
+.Lelse6:
+.Lend6:
+    mov rax, rbx
+    add rax, -1
+    mov rdi, rax
+    movsxd r12, edi
+    jmp .is_odd.entry
+.is_even.i2.return:
+.is_odd.return:
+    lea rsp, [rbp-16]
+    pop r12
+    pop rbx
+    pop rbp
+    ret
+.global char_tail
+.text
+char_tail:
+    push rbp
+    mov rbp, rsp
+    push rbx
+    push r12
+    movsxd r12, esi
+    movsx rbx, dil
+.char_tail.entry:
+    mov rax, r12
+    cmp rax, 0
+    jne .Lelse7
+    mov rax, rbx
+    jmp .char_tail.return
+.Lelse7:
+.Lend7:
+    mov rax, rbx
+    add rax, 1
+    mov r10, rax
+    mov rax, r12
+    add rax, -1
+    mov rdi, r10
+    mov rsi, rax
+    movsxd r12, esi
+    movsx rbx, dil
+    jmp .char_tail.entry
+.char_tail.return:
+    lea rsp, [rbp-16]
+    pop r12
+    pop rbx
+    pop rbp
+    ret
+.global addr_tail
+.text
+addr_tail:
+    push rbp
+    mov rbp, rsp
+    sub rsp, 16
+    movsxd r10, edi
+    mov rax, r10
+    shl rax, 1
+    mov DWORD PTR [rbp-4], eax
+    lea rax, [rbp-4]
+    mov r11, rax
+    mov rax, r10
+    movsxd rsi, eax
+    mov rax, r10
+    mov rdi, rax
+    movsxd rax, DWORD PTR [r11]
+    add rax, rdi
+.addx.i4.return:
+.addr_tail.return:
+    mov rsp, rbp
+    pop rbp
+    ret
+.global ret_in_expr
+.text
+ret_in_expr:
+    movsxd r10, edi
+.ret_in_expr.entry:
+    mov r11, 10
+    mov rax, r10
+    cmp rax, 0
+    jle .Lelse8
+    mov rax, r10
+    jmp .ret_in_expr.return
+.Lelse8:
+.Lend8:
+    mov rax, 3
+    movsxd rsi, eax
+    mov rax, rsi
+    mov rdi, rax
+    mov rax, r11
+    add rax, rdi
+.add2.i5.return:
+.ret_in_expr.return:
+    ret
+.global add8
+.text
+add8:
+    push rbp
+    mov rbp, rsp
+    push rbx
+    push r12
+    push r13
+    push r14
+    push r15
+    sub rsp, 8
+    movsxd r15, DWORD PTR [rbp+16]
+    movsxd r14, r9d
+    movsxd r13, r8d
+    movsxd r12, ecx
+    movsxd rbx, edx
+    movsxd r11, esi
+    movsxd r10, edi
+.add8.entry:
+    movsx rax, BYTE PTR [rbp+24]
+    shl rax, 3
+    push rax
+    mov rax, r15
+    imul rax, rax, 7
+    push rax
+    mov rax, r14
+    imul rax, rax, 6
+    push rax
+    mov rax, r13
+    lea rax, [rax+rax*4]
+    push rax
+    mov rax, r12
+    shl rax, 2
+    push rax
+    mov rax, rbx
+    lea rax, [rax+rax*2]
+    push rax
+    mov rax, r11
+    shl rax, 1
+    mov rdi, rax
+    mov rax, r10
+    add rax, rdi
+    pop rdi
+    add rax, rdi
+    pop rdi
+    add rax, rdi
+    pop rdi
+    add rax, rdi
+    pop rdi
+    add rax, rdi
+    pop rdi
+    add rax, rdi
+    pop rdi
+    add rax, rdi
+.add8.return:
+    lea rsp, [rbp-40]
+    pop r15
+    pop r14
+    pop r13
+    pop r12
+    pop rbx
+    pop rbp
+    ret
+.global swap_sub
+.text
+swap_sub:
+    movsxd r11, esi
+    movsxd r10, edi
+.swap_sub.entry:
+    mov rax, r11
+    movsxd rcx, eax
+    mov rax, r10
+    movsxd r8, eax
+    mov rax, r10
+    mov rdi, rax
+    mov rax, r11
+    sub rax, rdi
+.sub2.i25.return:
+.swap_sub.return:
+    ret
+.global fib
+.text
+fib:
+    push rbp
+    mov rbp, rsp
+    push rbx
+    sub rsp, 8
+    movsxd rbx, edi
+.fib.entry:
+    mov rax, rbx
+    cmp rax, 1
+    jg .Lelse9
+    mov rax, 1
+    jmp .fib.return
+.Lelse9:
+.Lend9:
+    mov rax, rbx
+    add rax, -2
+    mov rdi, rax
+    call fib
+    push rax
+    sub rsp, 8
+    mov rax, rbx
+    add rax, -1
+    mov rdi, rax
+    call fib
+    add rsp, 8
+    pop rdi
+    add rax, rdi
+.fib.return:
+    lea rsp, [rbp-8]
+    pop rbx
+    pop rbp
+    ret
+.data
+counter:
+.zero 4
+.global dead_code
+.text
+dead_code:
+    movsxd r11, edi
+.dead_code.entry:
+    mov rax, r11
+    add rax, 1
+    movsxd r10, eax
+    mov rax, r10
+.dead_code.return:
+    ret
+.global find_char
+.text
+find_char:
+    push rbx
+    movsx rcx, dl
+    movsxd r9, esi
+    mov rbx, rdi
+.find_char.entry:
+    mov r10, 0
+    mov rax, rcx
+    movd xmm8, eax
+    punpcklbw xmm8, xmm8
+    pshuflw xmm8, xmm8, 0
+    pshufd xmm8, xmm8, 0
+    mov rax, r9
+    mov rdi, rax
+    mov rax, r10
+    add rax, 15
+    cmp rax, rdi
+    jge .Lvend10
+    .p2align 4
+.Lvbegin10:
+    mov rax, r10
+    movdqu xmm0, XMMWORD PTR [rbx+rax*1]
+    movdqa xmm1, xmm8
+    pcmpeqb xmm0, xmm1
+    pmovmskb eax, xmm0
+    test eax, eax
+    jne .Lvend10
+    add r10, 16
+    mov rax, r9
+    mov rdi, rax
+    mov rax, r10
+    add rax, 15
+    cmp rax, rdi
+    jl .Lvbegin10
+.Lvend10:
+    mov rax, r10
+    mov rdi, rax
+    mov rax, rbx
+    add rax, rdi
+    mov r11, rax
+    mov rax, r9
+    mov rdi, rax
+    mov rax, r10
+    add rax, 3
+    cmp rax, rdi
+    jge .Lend11
+    .p2align 4
+.Lbegin11:
+    mov rax, rcx
+    mov rdi, rax
+    movsx rax, BYTE PTR [r11]
+    cmp rax, rdi
+    jne .Lelse12
+    mov rax, r10
+    jmp .find_char.return
+.Lelse12:
+.Lend12:
+    mov rax, rcx
+    mov rdi, rax
+    movsx rax, BYTE PTR [r11+1]
+    cmp rax, rdi
+    jne .Lelse13
+    mov rax, r10
+    add rax, 1
+    jmp .find_char.return
+.Lelse13:
+.Lend13:
+    mov rax, rcx
+    mov rdi, rax
+    movsx rax, BYTE PTR [r11+2]
+    cmp rax, rdi
+    jne .Lelse14
+    mov rax, r10
+    add rax, 2
+    jmp .find_char.return
+.Lelse14:
+.Lend14:
+    mov rax, rcx
+    mov rdi, rax
+    movsx rax, BYTE PTR [r11+3]
+    cmp rax, rdi
+    jne .Lelse15
+    mov rax, r10
+    add rax, 3
+    jmp .find_char.return
+.Lelse15:
+.Lend15:
+    add r11, 4
+    mov rax, r10
+    add rax, 4
+    movsxd r10, eax
+    mov rax, r9
+    mov rdi, rax
+    mov rax, r10
+    add rax, 3
+    cmp rax, rdi
+    jl .Lbegin11
+.Lend11:
+    mov rax, r10
+    mov rdi, rax
+    mov rax, rbx
+    add rax, rdi
+    mov r8, rax
+    mov rax, r9
+    mov rdi, rax
+    mov rax, r10
+    cmp rax, rdi
+    jge .Lend16
+    .p2align 4
+.Lbegin16:
+    mov rax, rcx
+    mov rdi, rax
+    movsx rax, BYTE PTR [r8]
+    cmp rax, rdi
+    jne .Lelse17
+    mov rax, r10
+    jmp .find_char.return
+.Lelse17:
+.Lend17:
+    add r8, 1
+    mov rax, r10
+    add rax, 1
+    movsxd r10, eax
+    mov rax, r9
+    mov rdi, rax
+    mov rax, r10
+    cmp rax, rdi
+    jl .Lbegin16
+.Lend16:
+    mov rax, -1
+.find_char.return:
+    pop rbx
+    ret
+.global dispatch
+.text
+dispatch:
+    movsxd r11, edx
+    movsxd r10, esi
+    movsxd rcx, edi
+.dispatch.entry:
+    mov rax, rcx
+    cmp eax, 4
+    ja .Lcase24
+    lea rdx, [rip+.Ltable25]
+    movsxd rax, DWORD PTR [rdx+rax*4]
+    add rax, rdx
+    jmp rax
+    .section .rodata
+    .p2align 2
+.Ltable25:
+    .long .Lcase19-.Ltable25
+    .long .Lcase20-.Ltable25
+    .long .Lcase21-.Ltable25
+    .long .Lcase22-.Ltable25
+    .long .Lcase23-.Ltable25
+    .text
+.Lcase19:
+    mov rax, r11
+    mov rdi, rax
+    mov rax, r10
+    add rax, rdi
+    jmp .dispatch.return
+.Lcase20:
+    mov rax, r11
+    mov rdi, rax
+    mov rax, r10
+    sub rax, rdi
+    jmp .dispatch.return
+.Lcase21:
+    mov rax, r11
+    mov rdi, rax
+    mov rax, r10
+    imul rax, rdi
+    jmp .dispatch.return
+.Lcase22:
+    mov rax, r11
+    mov rdi, rax
+    mov rax, r10
+    cdq
+    idiv edi
+    movsxd rax, eax
+    jmp .dispatch.return
+.Lcase23:
+    mov rax, r11
+    mov rdi, rax
+    mov rax, r10
+    cdq
+    idiv edi
+    movsxd rax, edx
+    jmp .dispatch.return
+.Lcase24:
+    mov rax, -1
+.Lend18:
+.dispatch.return:
+    ret
+.global clamp
+.text
+clamp:
+    movsxd rcx, edx
+    movsxd r11, esi
+    movsxd r10, edi
+.clamp.entry:
+    mov rax, r11
+    mov rdi, rax
+    mov rax, r10
+    cmp rax, rdi
+    jge .Lelse26
+    mov rax, r11
+    jmp .clamp.return
+.Lelse26:
+.Lend26:
+    mov rax, rcx
+    mov rdi, rax
+    mov rax, r10
+    cmp rax, rdi
+    cmovg rax, rdi
+.clamp.return:
+    ret
+.global arr_min
+.text
+arr_min:
+    push rbp
+    mov rbp, rsp
+    push rbx
+    push r12
+    push r13
+    push r14
+    push r15
+    sub rsp, 8
+    movsxd r14, esi
+    mov r15, rdi
+.arr_min.entry:
+    movsxd rax, DWORD PTR [r15]
+    movsxd r10, eax
+    mov r11, 1
+    mov rax, 1
+    shl rax, 2
+    mov rdi, rax
+    mov rax, r15
+    add rax, rdi
+    mov rcx, rax
+    mov rax, r14
+    mov rdi, rax
+    mov rax, r11
+    add rax, 3
+    cmp rax, rdi
+    jge .Lend27
+    .p2align 4
+.Lbegin27:
+    movsxd rax, DWORD PTR [rcx]
+    movsxd r13, eax
+    mov rax, r10
+    mov rdi, rax
+    mov rax, r13
+    cmp rax, rdi
+    cmovge rax, rdi
+    movsxd r10, eax
+    movsxd rax, DWORD PTR [rcx+4]
+    movsxd r9, eax
+    mov rax, r10
+    mov rdi, rax
+    mov rax, r9
+    cmp rax, rdi
+    cmovge rax, rdi
+    movsxd r10, eax
+    movsxd rax, DWORD PTR [rcx+8]
+    movsxd rbx, eax
+    mov rax, r10
+    mov rdi, rax
+    mov rax, rbx
+    cmp rax, rdi
+    cmovge rax, rdi
+    movsxd r10, eax
+    movsxd rax, DWORD PTR [rcx+12]
+    movsxd r12, eax
+    mov rax, r10
+    mov rdi, rax
+    mov rax, r12
+    cmp rax, rdi
+    cmovge rax, rdi
+    movsxd r10, eax
+    add rcx, 16
+    mov rax, r11
+    add rax, 4
+    movsxd r11, eax
+    mov rax, r14
+    mov rdi, rax
+    mov rax, r11
+    add rax, 3
+    cmp rax, rdi
+    jl .Lbegin27
+.Lend27:
+    mov rax, r11
+    shl rax, 2
+    mov rdi, rax
+    mov rax, r15
+    add rax, rdi
+    mov r8, rax
+    mov rax, r14
+    mov rdi, rax
+    mov rax, r11
+    cmp rax, rdi
+    jge .Lend28
+    .p2align 4
+.Lbegin28:
+    mov rax, r10
+    mov rdi, rax
+    movsxd rax, DWORD PTR [r8]
+    cmp rax, rdi
+    cmovge rax, rdi
+    movsxd r10, eax
+    add r8, 4
+    mov rax, r11
+    add rax, 1
+    movsxd r11, eax
+    mov rax, r14
+    mov rdi, rax
+    mov rax, r11
+    cmp rax, rdi
+    jl .Lbegin28
+.Lend28:
+    mov rax, r10
+.arr_min.return:
+    lea rsp, [rbp-40]
+    pop r15
+    pop r14
+    pop r13
+    pop r12
+    pop rbx
+    pop rbp
+    ret
+.global sign
+.text
+sign:
+    movsxd r11, edi
+.sign.entry:
+    mov rax, r11
+    cmp rax, 0
+    setg al
+    movzb rax, al
+    movsxd r10, eax
+    mov rax, r11
+    cmp rax, 0
+    mov rdi, -1
+    mov rax, r10
+    cmovl rax, rdi
+    movsxd r10, eax
+    mov rax, r10
+.sign.return:
+    ret
+.data
+.global hist
+hist:
+.zero 32
+.global histogram
+.text
+histogram:
+    push rbp
+    mov rbp, rsp
+    push rbx
+    push r12
+    push r13
+    push r14
+    sub rsp, 16
+    movsxd r13, esi
+    mov r14, rdi
+.histogram.entry:
+    mov r10, 0
+    mov rax, r14
+    add rax, 0
+    mov r11, rax
+    mov rax, r13
+    mov rdi, rax
+    mov rax, r10
+    add rax, 3
+    cmp rax, rdi
+    jge .Lend29
+    .p2align 4
+.Lbegin29:
+    movsx rax, BYTE PTR [r11]
+    mov rdx, rax
+    mov rdi, rax
+    sar rdi, 63
+    shr rdi, 61
+    add rax, rdi
+    sar rax, 3
+    imul rax, rax, 8
+    sub rdx, rax
+    mov rax, rdx
+    shl rax, 2
+    mov rdi, rax
+    lea rax, [rip+hist]
+    add rax, rdi
+    mov r12, rax
+    inc DWORD PTR [r12]
+    movsx rax, BYTE PTR [r11+1]
+    mov rdx, rax
+    mov rdi, rax
+    sar rdi, 63
+    shr rdi, 61
+    add rax, rdi
+    sar rax, 3
+    imul rax, rax, 8
+    sub rdx, rax
+    mov rax, rdx
+    shl rax, 2
+    mov rdi, rax
+    lea rax, [rip+hist]
+    add rax, rdi
+    mov r8, rax
+    inc DWORD PTR [r8]
+    movsx rax, BYTE PTR [r11+2]
+    mov rdx, rax
+    mov rdi, rax
+    sar rdi, 63
+    shr rdi, 61
+    add rax, rdi
+    sar rax, 3
+    imul rax, rax, 8
+    sub rdx, rax
+    mov rax, rdx
+    shl rax, 2
+    mov rdi, rax
+    lea rax, [rip+hist]
+    add rax, rdi
+    mov r9, rax
+    inc DWORD PTR [r9]
+    movsx rax, BYTE PTR [r11+3]
+    mov rdx, rax
+    mov rdi, rax
+    sar rdi, 63
+    shr rdi, 61
+    add rax, rdi
+    sar rax, 3
+    imul rax, rax, 8
+    sub rdx, rax
+    mov rax, rdx
+    shl rax, 2
+    mov rdi, rax
+    lea rax, [rip+hist]
+    add rax, rdi
+    mov rbx, rax
+    inc DWORD PTR [rbx]
+    add r11, 4
+    mov rax, r10
+    add rax, 4
+    movsxd r10, eax
+    mov rax, r13
+    mov rdi, rax
+    mov rax, r10
+    add rax, 3
+    cmp rax, rdi
+    jl .Lbegin29
+.Lend29:
+    mov rax, r10
+    mov rdi, rax
+    mov rax, r14
+    add rax, rdi
+    mov rcx, rax
+    mov rax, r13
+    mov rdi, rax
+    mov rax, r10
+    cmp rax, rdi
+    jge .Lend30
+    .p2align 4
+.Lbegin30:
+    movsx rax, BYTE PTR [rcx]
+    mov rdx, rax
+    mov rdi, rax
+    sar rdi, 63
+    shr rdi, 61
+    add rax, rdi
+    sar rax, 3
+    imul rax, rax, 8
+    sub rdx, rax
+    mov rax, rdx
+    mov rdi, rax
+    lea rax, [rip+hist]
+    inc DWORD PTR [rax+rdi*4]
+    add rcx, 1
+    mov rax, r10
+    add rax, 1
+    movsxd r10, eax
+    mov rax, r13
+    mov rdi, rax
+    mov rax, r10
+    cmp rax, rdi
+    jl .Lbegin30
+.Lend30:
+    movsxd rax, DWORD PTR [rip+hist]
+    mov rdi, rax
+    movsxd rax, DWORD PTR [rip+hist+4]
+    imul rax, rax, 10
+    add rax, rdi
+.histogram.return:
+    lea rsp, [rbp-32]
+    pop r14
+    pop r13
+    pop r12
+    pop rbx
+    pop rbp
+    ret
+.global hoist_cmp
+.text
+hoist_cmp:
+    push rbp
+    mov rbp, rsp
+    push rbx
+    push r12
+    push r13
+    push r14
+    push r15
+    sub rsp, 24
+    mov DWORD PTR [rbp-48], esi
+    mov DWORD PTR [rbp-44], edi
+.hoist_cmp.entry:
+    mov DWORD PTR [rbp-56], 0
+    mov r10, 1
+    mov r11, 2
+    mov rcx, 3
+    mov r8, 4
+    mov r9, 5
+    mov rbx, 6
+    mov r12, 7
+    mov r13, 8
+    mov r14, 9
+    mov r15, 10
+    mov DWORD PTR [rbp-52], 0
+    movsxd rax, DWORD PTR [rbp-48]
+    cmp rax, 7
+    setne al
+    movzb rax, al
+    mov rdi, rax
+    movsxd rax, DWORD PTR [rbp-44]
+    cmp rax, rdi
+    setl al
+    movzb rax, al
+    mov DWORD PTR [rbp-60], eax
+    movsxd rax, DWORD PTR [rbp-52]
+    cmp rax, 3
+    jge .Lend31
+    .p2align 4
+.Lbegin31:
+    movsxd rax, DWORD PTR [rbp-60]
+    add DWORD PTR [rbp-56], eax
+    mov rax, r11
+    mov rdi, rax
+    mov rax, r10
+    add rax, rdi
+    movsxd r10, eax
+    mov rax, rcx
+    mov rdi, rax
+    mov rax, r11
+    add rax, rdi
+    movsxd r11, eax
+    mov rax, r8
+    mov rdi, rax
+    mov rax, rcx
+    add rax, rdi
+    movsxd rcx, eax
+    mov rax, r9
+    mov rdi, rax
+    mov rax, r8
+    add rax, rdi
+    movsxd r8, eax
+    mov rax, rbx
+    mov rdi, rax
+    mov rax, r9
+    add rax, rdi
+    movsxd r9, eax
+    mov rax, r12
+    mov rdi, rax
+    mov rax, rbx
+    add rax, rdi
+    movsxd rbx, eax
+    mov rax, r13
+    mov rdi, rax
+    mov rax, r12
+    add rax, rdi
+    movsxd r12, eax
+    mov rax, r14
+    mov rdi, rax
+    mov rax, r13
+    add rax, rdi
+    movsxd r13, eax
+    mov rax, r15
+    mov rdi, rax
+    mov rax, r14
+    add rax, rdi
+    movsxd r14, eax
+    mov rax, r10
+    mov rdi, rax
+    mov rax, r15
+    add rax, rdi
+    movsxd r15, eax
+    inc DWORD PTR [rbp-52]
+    movsxd rax, DWORD PTR [rbp-52]
+    cmp rax, 3
+    jl .Lbegin31
+.Lend31:
+    mov rax, r15
+    push rax
+    mov rax, r14
+    push rax
+    mov rax, r13
+    push rax
+    mov rax, r12
+    push rax
+    mov rax, rbx
+    push rax
+    mov rax, r9
+    push rax
+    mov rax, r8
+    push rax
+    mov rax, rcx
+    push rax
+    mov rax, r11
+    push rax
+    mov rax, r10
+    mov rdi, rax
+    movsxd rax, DWORD PTR [rbp-56]
+    add rax, rdi
+    pop rdi
+    add rax, rdi
+    pop rdi
+    add rax, rdi
+    pop rdi
+    add rax, rdi
+    pop rdi
+    add rax, rdi
+    pop rdi
+    add rax, rdi
+    pop rdi
+    add rax, rdi
+    pop rdi
+    add rax, rdi
+    pop rdi
+    add rax, rdi
+    pop rdi
+    add rax, rdi
+.hoist_cmp.return:
+    lea rsp, [rbp-40]
+    pop r15
+    pop r14
+    pop r13
+    pop r12
+    pop rbx
+    pop rbp
+    ret
+.global hoist_caller
+.text
+hoist_caller:
+    push rbp
+    mov rbp, rsp
+    push rbx
+    push r12
+    push r13
+    push r14
+    push r15
+    sub rsp, 40
+    movsxd rbx, edi
+.hoist_caller.entry:
+    mov rax, rbx
+    add rax, 1
+    movsxd r12, eax
+    mov rax, rbx
+    add rax, 2
+    movsxd r13, eax
+    mov rax, rbx
+    add rax, 3
+    movsxd r14, eax
+    mov rax, rbx
+    add rax, 4
+    movsxd r15, eax
+    mov rax, rbx
+    add rax, 5
+    mov DWORD PTR [rbp-44], eax
+    mov rax, rbx
+    add rax, 6
+    mov DWORD PTR [rbp-48], eax
+    mov rax, rbx
+    add rax, 7
+    mov DWORD PTR [rbp-52], eax
+    mov rax, rbx
+    add rax, 8
+    mov DWORD PTR [rbp-56], eax
+    mov rax, rbx
+    add rax, 9
+    mov DWORD PTR [rbp-60], eax
+    mov rax, rbx
+    add rax, 10
+    mov DWORD PTR [rbp-64], eax
+    mov rdi, 0
+    mov rsi, rbx
+    call hoist_cmp
+    mov DWORD PTR [rbp-68], eax
+    movsxd rax, DWORD PTR [rbp-64]
+    push rax
+    movsxd rax, DWORD PTR [rbp-60]
+    push rax
+    movsxd rax, DWORD PTR [rbp-56]
+    push rax
+    movsxd rax, DWORD PTR [rbp-52]
+    push rax
+    movsxd rax, DWORD PTR [rbp-48]
+    push rax
+    movsxd rax, DWORD PTR [rbp-44]
+    push rax
+    mov rax, r15
+    push rax
+    mov rax, r14
+    push rax
+    mov rax, r13
+    push rax
+    mov rax, r12
+    mov rdi, rax
+    movsxd rax, DWORD PTR [rbp-68]
+    add rax, rdi
+    pop rdi
+    add rax, rdi
+    pop rdi
+    add rax, rdi
+    pop rdi
+    add rax, rdi
+    pop rdi
+    add rax, rdi
+    pop rdi
+    add rax, rdi
+    pop rdi
+    add rax, rdi
+    pop rdi
+    add rax, rdi
+    pop rdi
+    add rax, rdi
+    pop rdi
+    add rax, rdi
+.hoist_caller.return:
+    lea rsp, [rbp-40]
+    pop r15
+    pop r14
+    pop r13
+    pop r12
+    pop rbx
+    pop rbp
+    ret
+.global rotate3
+.text
+rotate3:
+    movsxd r10, edi
+.rotate3.entry:
+    mov r11, 1
+    mov rsi, 2
+    mov rcx, 3
+    mov rax, r10
+    cmp rax, 0
+    jle .Lend32
+    .p2align 4
+.Lbegin32:
+    mov rax, r11
+    movsxd r8, eax
+    mov rax, rsi
+    movsxd r11, eax
+    mov rax, rcx
+    movsxd rsi, eax
+    mov rax, r8
+    movsxd rcx, eax
+    mov rax, r10
+    add rax, -1
+    movsxd r10, eax
+    mov rax, r10
+    cmp rax, 0
+    jg .Lbegin32
+.Lend32:
+    mov rax, rcx
+    push rax
+    mov rax, rsi
+    imul rax, rax, 10
+    mov rdi, rax
+    mov rax, r11
+    imul rax, rax, 100
+    add rax, rdi
+    pop rdi
+    add rax, rdi
+.rotate3.return:
+    ret
+.global spill_call
+.text
+spill_call:
+    push rbp
+    mov rbp, rsp
+    push rbx
+    push r12
+    push r13
+    push r14
+    push r15
+    sub rsp, 24
+    movsxd rcx, edi
+.spill_call.entry:
+    mov rax, rcx
+    movsxd r14, eax
+    mov rax, rcx
+    shl rax, 1
+    movsxd r8, eax
+    mov rax, rcx
+    lea rax, [rax+rax*2]
+    movsxd r9, eax
+    mov rax, rcx
+    shl rax, 2
+    movsxd rbx, eax
+    mov rax, rcx
+    lea rax, [rax+rax*4]
+    movsxd r12, eax
+    mov rax, rcx
+    imul rax, rax, 6
+    movsxd r13, eax
+    mov rax, rcx
+    imul rax, rax, 7
+    movsxd r15, eax
+    mov rax, rcx
+    shl rax, 3
+    mov DWORD PTR [rbp-44], eax
+    mov rax, rcx
+    movsxd rsi, eax
+    mov r11, 0
+    mov r10, 1
+    mov rax, rsi
+    mov rdi, rax
+    mov rax, r10
+    add rax, 3
+    cmp rax, rdi
+    jg .Lend33
+    .p2align 4
+.Lbegin33:
+    mov rax, r10
+    mov rdi, rax
+    mov rax, r10
+    imul rax, rdi
+    mov rdi, rax
+    mov rax, r11
+    add rax, rdi
+    movsxd r11, eax
+    mov rax, r10
+    add rax, 1
+    mov rdi, rax
+    mov rax, r10
+    add rax, 1
+    imul rax, rdi
+    mov rdi, rax
+    mov rax, r11
+    add rax, rdi
+    movsxd r11, eax
+    mov rax, r10
+    add rax, 2
+    mov rdi, rax
+    mov rax, r10
+    add rax, 2
+    imul rax, rdi
+    mov rdi, rax
+    mov rax, r11
+    add rax, rdi
+    movsxd r11, eax
+    mov rax, r10
+    add rax, 3
+    mov rdi, rax
+    mov rax, r10
+    add rax, 3
+    imul rax, rdi
+    mov rdi, rax
+    mov rax, r11
+    add rax, rdi
+    movsxd r11, eax
+    mov rax, r10
+    add rax, 4
+    movsxd r10, eax
+    mov rax, rsi
+    mov rdi, rax
+    mov rax, r10
+    add rax, 3
+    cmp rax, rdi
+    jle .Lbegin33
+.Lend33:
+    mov rax, rsi
+    mov rdi, rax
+    mov rax, r10
+    cmp rax, rdi
+    jg .Lend34
+    .p2align 4
+.Lbegin34:
+    mov rax, r10
+    mov rdi, rax
+    mov rax, r10
+    imul rax, rdi
+    mov rdi, rax
+    mov rax, r11
+    add rax, rdi
+    movsxd r11, eax
+    mov rax, r10
+    add rax, 1
+    movsxd r10, eax
+    mov rax, rsi
+    mov rdi, rax
+    mov rax, r10
+    cmp rax, rdi
+    jle .Lbegin34
+.Lend34:
+    mov rax, r11
+.sum_sq.i22.return:
+    push rax
+    mov rax, r14
+    mov DWORD PTR [rbp-52], eax
+    mov rax, r8
+    mov DWORD PTR [rbp-52], eax
+    mov rax, r9
+    mov DWORD PTR [rbp-52], eax
+    mov rax, rbx
+    mov DWORD PTR [rbp-52], eax
+    mov rax, r12
+    mov DWORD PTR [rbp-52], eax
+    mov rax, r13
+    mov DWORD PTR [rbp-52], eax
+    mov rax, r13
+    push rax
+    mov rax, r12
+    push rax
+    mov rax, rbx
+    push rax
+    mov rax, r9
+    push rax
+    mov rax, r8
+    mov rdi, rax
+    mov rax, r14
+    add rax, rdi
+    pop rdi
+    add rax, rdi
+    pop rdi
+    add rax, rdi
+    pop rdi
+    add rax, rdi
+    pop rdi
+    add rax, rdi
+.add6.i21.return:
+    pop rdi
+    add rax, rdi
+    mov DWORD PTR [rbp-48], eax
+    movsxd rax, DWORD PTR [rbp-44]
+    mov DWORD PTR [rbp-52], eax
+    mov rax, r15
+    mov DWORD PTR [rbp-52], eax
+    mov rax, r13
+    mov DWORD PTR [rbp-52], eax
+    mov rax, r12
+    mov DWORD PTR [rbp-52], eax
+    mov rax, rbx
+    mov DWORD PTR [rbp-52], eax
+    mov rax, r9
+    mov DWORD PTR [rbp-52], eax
+    mov rax, r8
+    mov DWORD PTR [rbp-52], eax
+    mov rax, r14
+    mov BYTE PTR [rbp-49], al
+    movsx rax, al
+    shl rax, 3
+    push rax
+    mov rax, r8
+    imul rax, rax, 7
+    push rax
+    mov rax, r9
+    imul rax, rax, 6
+    push rax
+    mov rax, rbx
+    lea rax, [rax+rax*4]
+    push rax
+    mov rax, r12
+    shl rax, 2
+    push rax
+    mov rax, r13
+    lea rax, [rax+rax*2]
+    push rax
+    mov rax, r15
+    shl rax, 1
+    mov rdi, rax
+    movsxd rax, DWORD PTR [rbp-44]
+    add rax, rdi
+    pop rdi
+    add rax, rdi
+    pop rdi
+    add rax, rdi
+    pop rdi
+    add rax, rdi
+    pop rdi
+    add rax, rdi
+    pop rdi
+    add rax, rdi
+    pop rdi
+    add rax, rdi
+.add8.i23.return:
+    mov rdi, rax
+    movsxd rax, DWORD PTR [rbp-48]
+    add rax, rdi
+    mov DWORD PTR [rbp-48], eax
+    movsxd rax, DWORD PTR [rbp-44]
+    push rax
+    mov rax, r15
+    push rax
+    mov rax, r13
+    push rax
+    mov rax, r12
+    push rax
+    mov rax, rbx
+    push rax
+    mov rax, r9
+    push rax
+    mov rax, r8
+    push rax
+    mov rax, r14
+    mov rdi, rax
+    movsxd rax, DWORD PTR [rbp-48]
+    add rax, rdi
+    pop rdi
+    add rax, rdi
+    pop rdi
+    add rax, rdi
+    pop rdi
+    add rax, rdi
+    pop rdi
+    add rax, rdi
+    pop rdi
+    add rax, rdi
+    pop rdi
+    add rax, rdi
+    pop rdi
+    add rax, rdi
+.spill_call.return:
+    lea rsp, [rbp-40]
+    pop r15
+    pop r14
+    pop r13
+    pop r12
+    pop rbx
+    pop rbp
+    ret
+.global main
+.text
+main:
+    push rbp
+    mov rbp, rsp
+    push rbx
+    push r12
+    push r13
+    push r14
+    push r15
+    sub rsp, 72
+    mov rdi, 3
+    mov rsi, 3
+    call assert
+    movsxd rax, eax
+    mov rdi, 8
+    mov rsi, 8
+    call assert
+    movsxd rax, eax
+    mov rdi, 2
+    mov rsi, 2
+    call assert
+    movsxd rax, eax
+    mov rdi, 21
+    mov rsi, 21
+    call assert
+    movsxd rax, eax
+    mov rdi, 66
+    mov rsi, 66
+    call assert
+    movsxd rax, eax
+    mov rdi, 136
+    mov rsi, 136
+    call assert
+    movsxd rax, eax
+    mov rdi, 7
+    mov rsi, 7
+    call assert
+    movsxd rax, eax
+    mov rdi, 1
+    mov rsi, 1
+    call assert
+    movsxd rax, eax
+    mov rdi, 55
+    mov rsi, 55
+    call assert
+    movsxd rax, eax
+    mov rdi, 7
+    mov rsi, 7
+    call assert
+    movsxd rax, eax
+    mov rdi, 7
+    mov rsi, 7
+    call assert
+    movsxd rax, eax
+    mov rdi, 55
+    mov rsi, 55
+    call assert
+    movsxd rax, eax
+    mov rdi, 10
+    mov rsi, 10
+    call assert
+    movsxd rax, eax
+    mov DWORD PTR [rbp-48], 0
+    mov DWORD PTR [rbp-44], 0
+    mov DWORD PTR [rbp-52], 6
+    xor eax, eax
+    cmp rax, 6
+    mov rdi, 6
+    cmovle rax, rdi
+.max2.i1.u1.return:
+    mov rdi, rax
+    movsxd rax, DWORD PTR [rbp-48]
+    add rax, rdi
+    mov DWORD PTR [rbp-48], eax
+    mov DWORD PTR [rbp-44], 1
+    mov DWORD PTR [rbp-52], 6
+    mov rax, 1
+    cmp rax, 6
+    mov rdi, 6
+    cmovle rax, rdi
+.max2.i1.u2.return:
+    mov rdi, rax
+    movsxd rax, DWORD PTR [rbp-48]
+    add rax, rdi
+    mov DWORD PTR [rbp-48], eax
+    mov DWORD PTR [rbp-44], 2
+    mov DWORD PTR [rbp-52], 6
+    mov rax, 2
+    cmp rax, 6
+    mov rdi, 6
+    cmovle rax, rdi
+.max2.i1.u3.return:
+    mov rdi, rax
+    movsxd rax, DWORD PTR [rbp-48]
+    add rax, rdi
+    mov DWORD PTR [rbp-48], eax
+    mov DWORD PTR [rbp-44], 3
+    mov DWORD PTR [rbp-52], 6
+    mov rax, 3
+    cmp rax, 6
+    mov rdi, 6
+    cmovle rax, rdi
+.max2.i1.u4.return:
+    mov rdi, rax
+    movsxd rax, DWORD PTR [rbp-48]
+    add rax, rdi
+    mov DWORD PTR [rbp-48], eax
+    mov DWORD PTR [rbp-44], 4
+    mov DWORD PTR [rbp-52], 6
+    mov rax, 4
+    cmp rax, 6
+    mov rdi, 6
+    cmovle rax, rdi
+.max2.i1.u5.return:
+    mov rdi, rax
+    movsxd rax, DWORD PTR [rbp-48]
+    add rax, rdi
+    mov DWORD PTR [rbp-48], eax
+    mov rax, 5
+    mov DWORD PTR [rbp-44], eax
+    movsxd rax, DWORD PTR [rbp-48]
+    mov rsi, rax
+    mov rdi, 30
+    call assert
+    movsxd rax, eax
+    mov rdi, 18
+    mov rsi, 18
+    call assert
+    movsxd rax, eax
+    mov rdi, 100000
+    mov rsi, 0
+    call sum_tail
+    mov rsi, rax
+    mov rdi, 705082704
+    call assert
+    movsxd rax, eax
+    mov DWORD PTR [rbp-44], 100000
+    mov rax, 100000
+    cmp rax, 0
+    jne .Lelse35
+    mov rax, 1
+    jmp .is_even.i3.return
+.Lelse35:
+.Lend35:
+    movsxd rax, DWORD PTR [rbp-44]
+    add rax, -1
+    mov rdi, rax
+    call is_odd
+.is_even.i3.return:
+    mov rsi, rax
+    mov rdi, 1
+    call assert
+    movsxd rax, eax
+    mov rdi, 100000
+    call is_odd
+    mov rsi, rax
+    mov rdi, 0
+    call assert
+    movsxd rax, eax
+    mov rdi, -126
+    mov rsi, -126
+    call assert
+    movsxd rax, eax
+    mov rdi, 5
+    call addr_tail
+    mov rsi, rax
+    mov rdi, 15
+    call assert
+    movsxd rax, eax
+    mov rdi, 7
+    call ret_in_expr
+    mov rsi, rax
+    mov rdi, 7
+    call assert
+    movsxd rax, eax
+    mov rdi, 13
+    mov rsi, 13
+    call assert
+    movsxd rax, eax
+    mov rdi, 204
+    mov rsi, 204
+    call assert
+    movsxd rax, eax
+    mov rdi, 60
+    mov rsi, 60
+    call assert
+    movsxd rax, eax
+    mov rdi, -52
+    mov rsi, -52
+    call assert
+    movsxd rax, eax
+    mov rdi, 3
+    mov rsi, 3
+    call assert
+    movsxd rax, eax
+    mov DWORD PTR [rbp-44], 4
+    mov DWORD PTR [rbp-48], 5
+    movsxd rax, DWORD PTR [rbp-44]
+    mov DWORD PTR [rbp-56], eax
+    movsxd rax, DWORD PTR [rbp-44]
+    mov rdi, rax
+    movsxd rax, DWORD PTR [rbp-48]
+    add rax, rdi
+    mov DWORD PTR [rbp-52], eax
+    movsxd rax, DWORD PTR [rbp-44]
+    mov DWORD PTR [rbp-48], eax
+    movsxd rax, DWORD PTR [rbp-44]
+    mov rdi, rax
+    movsxd rax, DWORD PTR [rbp-52]
+    sub rax, rdi
+.sub2.i6.return:
+    mov DWORD PTR [rbp-60], eax
+    movsxd rax, eax
+    mov rdi, rax
+    movsxd rax, DWORD PTR [rbp-56]
+    add rax, rdi
+.add2.i7.return:
+    mov rsi, rax
+    mov rdi, 9
+    call assert
+    movsxd rax, eax
+    mov rax, 1
+    mov rsi, rax
+    mov rdi, 1
+    call assert
+    movsxd rax, eax
+    mov DWORD PTR [rbp-44], 3
+    add DWORD PTR [rip+counter], 3
+    movsxd rax, DWORD PTR [rip+counter]
+.bump.i8.return:
+    mov rsi, rax
+    mov rdi, 3
+    call assert
+    movsxd rax, eax
+    mov DWORD PTR [rbp-44], 4
+    add DWORD PTR [rip+counter], 4
+    movsxd rax, DWORD PTR [rip+counter]
+.bump.i9.return:
+    mov rsi, rax
+    mov rdi, 7
+    call assert
+    movsxd rax, eax
+    mov rdi, 7
+    movsxd rsi, DWORD PTR [rip+counter]
+    call assert
+    movsxd rax, eax
+    mov rdi, 6
+    mov rsi, 6
+    call assert
+    movsxd rax, eax
+    mov r15, 0
+    lea rax, [rbp-110]
+    add rax, 0
+    mov QWORD PTR [rbp-56], rax
+    mov rax, r15
+    add rax, 3
+    cmp rax, 50
+    jge .Lend36
+    .p2align 4
+.Lbegin36:
+    mov rax, QWORD PTR [rbp-56]
+    mov QWORD PTR [rbp-48], rax
+    mov rax, QWORD PTR [rbp-56]
+    lea rax, [rax]
+    mov rdi, rax
+    mov rax, r15
+    mov BYTE PTR [rdi], al
+    mov rax, QWORD PTR [rbp-56]
+    lea rax, [rax+1]
+    mov rdi, rax
+    mov rax, r15
+    add rax, 1
+    mov BYTE PTR [rdi], al
+    mov rax, QWORD PTR [rbp-56]
+    lea rax, [rax+2]
+    mov rdi, rax
+    mov rax, r15
+    add rax, 2
+    mov BYTE PTR [rdi], al
+    mov rax, QWORD PTR [rbp-56]
+    lea rax, [rax+3]
+    mov rdi, rax
+    mov rax, r15
+    add rax, 3
+    mov BYTE PTR [rdi], al
+    mov rax, QWORD PTR [rbp-56]
+    add rax, 4
+    mov QWORD PTR [rbp-56], rax
+    mov rax, r15
+    add rax, 4
+    movsxd r15, eax
+    mov rax, r15
+    add rax, 3
+    cmp rax, 50
+    jl .Lbegin36
+.Lend36:
+    mov rax, r15
+    mov rdi, rax
+    lea rax, [rbp-110]
+    add rax, rdi
+    mov QWORD PTR [rbp-48], rax
+    mov rax, r15
+    cmp rax, 50
+    jge .Lend37
+    .p2align 4
+.Lbegin37:
+    mov rax, QWORD PTR [rbp-48]
+    lea rax, [rax]
+    mov rdi, rax
+    mov rax, r15
+    mov BYTE PTR [rdi], al
+    mov rax, QWORD PTR [rbp-48]
+    add rax, 1
+    mov QWORD PTR [rbp-48], rax
+    mov rax, r15
+    add rax, 1
+    movsxd r15, eax
+    mov rax, r15
+    cmp rax, 50
+    jl .Lbegin37
+.Lend37:
+    lea rax, [rbp-110]
+    mov QWORD PTR [rbp-48], rax
+    mov DWORD PTR [rbp-60], 50
+    mov BYTE PTR [rbp-111], 37
+    mov r12, 0
+    movsx rax, BYTE PTR [rbp-111]
+    movd xmm8, eax
+    punpcklbw xmm8, xmm8
+    pshuflw xmm8, xmm8, 0
+    pshufd xmm8, xmm8, 0
+    movsxd rax, DWORD PTR [rbp-60]
+    mov rdi, rax
+    mov rax, r12
+    add rax, 15
+    cmp rax, rdi
+    jge .Lvend38
+    .p2align 4
+.Lvbegin38:
+    mov rax, r12
+    mov rdi, rax
+    mov rax, QWORD PTR [rbp-48]
+    movdqu xmm0, XMMWORD PTR [rax+rdi*1]
+    movdqa xmm1, xmm8
+    pcmpeqb xmm0, xmm1
+    pmovmskb eax, xmm0
+    test eax, eax
+    jne .Lvend38
+    add r12, 16
+    movsxd rax, DWORD PTR [rbp-60]
+    mov rdi, rax
+    mov rax, r12
+    add rax, 15
+    cmp rax, rdi
+    jl .Lvbegin38
+.Lvend38:
+    mov rax, r12
+    mov rdi, rax
+    mov rax, QWORD PTR [rbp-48]
+    add rax, rdi
+    mov QWORD PTR [rbp-56], rax
+    movsxd rax, DWORD PTR [rbp-60]
+    mov rdi, rax
+    mov rax, r12
+    add rax, 3
+    cmp rax, rdi
+    jge .Lend39
+    .p2align 4
+.Lbegin39:
+    movsx rax, BYTE PTR [rbp-111]
+    mov rdi, rax
+    mov rax, QWORD PTR [rbp-56]
+    movsx rax, BYTE PTR [rax]
+    cmp rax, rdi
+    jne .Lelse40
+    mov rax, r12
+    jmp .find_char.i10.return
+.Lelse40:
+.Lend40:
+    movsx rax, BYTE PTR [rbp-111]
+    mov rdi, rax
+    mov rax, QWORD PTR [rbp-56]
+    movsx rax, BYTE PTR [rax+1]
+    cmp rax, rdi
+    jne .Lelse41
+    mov rax, r12
+    add rax, 1
+    jmp .find_char.i10.return
+.Lelse41:
+.Lend41:
+    movsx rax, BYTE PTR [rbp-111]
+    mov rdi, rax
+    mov rax, QWORD PTR [rbp-56]
+    movsx rax, BYTE PTR [rax+2]
+    cmp rax, rdi
+    jne .Lelse42
+    mov rax, r12
+    add rax, 2
+    jmp .find_char.i10.return
+.Lelse42:
+.Lend42:
+    movsx rax, BYTE PTR [rbp-111]
+    mov rdi, rax
+    mov rax, QWORD PTR [rbp-56]
+    movsx rax, BYTE PTR [rax+3]
+    cmp rax, rdi
+    jne .Lelse43
+    mov rax, r12
+    add rax, 3
+    jmp .find_char.i10.return
+.Lelse43:
+.Lend43:
+    mov rax, QWORD PTR [rbp-56]
+    add rax, 4
+    mov QWORD PTR [rbp-56], rax
+    mov rax, r12
+    add rax, 4
+    movsxd r12, eax
+    movsxd rax, DWORD PTR [rbp-60]
+    mov rdi, rax
+    mov rax, r12
+    add rax, 3
+    cmp rax, rdi
+    jl .Lbegin39
+.Lend39:
+    mov rax, r12
+    mov rdi, rax
+    mov rax, QWORD PTR [rbp-48]
+    add rax, rdi
+    mov QWORD PTR [rbp-56], rax
+    movsxd rax, DWORD PTR [rbp-60]
+    mov rdi, rax
+    mov rax, r12
+    cmp rax, rdi
+    jge .Lend44
+    .p2align 4
+.Lbegin44:
+    movsx rax, BYTE PTR [rbp-111]
+    mov rdi, rax
+    mov rax, QWORD PTR [rbp-56]
+    movsx rax, BYTE PTR [rax]
+    cmp rax, rdi
+    jne .Lelse45
+    mov rax, r12
+    jmp .find_char.i10.return
+.Lelse45:
+.Lend45:
+    mov rax, QWORD PTR [rbp-56]
+    add rax, 1
+    mov QWORD PTR [rbp-56], rax
+    mov rax, r12
+    add rax, 1
+    movsxd r12, eax
+    movsxd rax, DWORD PTR [rbp-60]
+    mov rdi, rax
+    mov rax, r12
+    cmp rax, rdi
+    jl .Lbegin44
+.Lend44:
+    mov rax, -1
+.find_char.i10.return:
+    mov rsi, rax
+    mov rdi, 37
+    call assert
+    movsxd rax, eax
+    mov DWORD PTR [rbp-60], 0
+    lea rax, [rbp-110]
+    add rax, 0
+    mov QWORD PTR [rbp-56], rax
+    movsxd rax, DWORD PTR [rbp-60]
+    add rax, 3
+    cmp rax, 50
+    jge .Lend46
+    .p2align 4
+.Lbegin46:
+    mov rax, QWORD PTR [rbp-56]
+    mov QWORD PTR [rbp-48], rax
+    mov rax, QWORD PTR [rbp-56]
+    lea rax, [rax]
+    mov rdi, rax
+    movsxd rax, DWORD PTR [rbp-60]
+    mov BYTE PTR [rdi], al
+    mov rax, QWORD PTR [rbp-56]
+    lea rax, [rax+1]
+    mov rdi, rax
+    movsxd rax, DWORD PTR [rbp-60]
+    add rax, 1
+    mov BYTE PTR [rdi], al
+    mov rax, QWORD PTR [rbp-56]
+    lea rax, [rax+2]
+    mov rdi, rax
+    movsxd rax, DWORD PTR [rbp-60]
+    add rax, 2
+    mov BYTE PTR [rdi], al
+    mov rax, QWORD PTR [rbp-56]
+    lea rax, [rax+3]
+    mov rdi, rax
+    movsxd rax, DWORD PTR [rbp-60]
+    add rax, 3
+    mov BYTE PTR [rdi], al
+    mov rax, QWORD PTR [rbp-56]
+    add rax, 4
+    mov QWORD PTR [rbp-56], rax
+    add DWORD PTR [rbp-60], 4
+    movsxd rax, DWORD PTR [rbp-60]
+    add rax, 3
+    cmp rax, 50
+    jl .Lbegin46
+.Lend46:
+    movsxd rax, DWORD PTR [rbp-60]
+    mov rdi, rax
+    lea rax, [rbp-110]
+    add rax, rdi
+    mov QWORD PTR [rbp-48], rax
+    movsxd rax, DWORD PTR [rbp-60]
+    cmp rax, 50
+    jge .Lend47
+    .p2align 4
+.Lbegin47:
+    mov rax, QWORD PTR [rbp-48]
+    lea rax, [rax]
+    mov rdi, rax
+    movsxd rax, DWORD PTR [rbp-60]
+    mov BYTE PTR [rdi], al
+    mov rax, QWORD PTR [rbp-48]
+    add rax, 1
+    mov QWORD PTR [rbp-48], rax
+    inc DWORD PTR [rbp-60]
+    movsxd rax, DWORD PTR [rbp-60]
+    cmp rax, 50
+    jl .Lbegin47
+.Lend47:
+    lea rax, [rbp-110]
+    mov QWORD PTR [rbp-48], rax
+    mov DWORD PTR [rbp-60], 20
+    mov BYTE PTR [rbp-111], 37
+    mov r13, 0
+    movsx rax, BYTE PTR [rbp-111]
+    movd xmm8, eax
+    punpcklbw xmm8, xmm8
+    pshuflw xmm8, xmm8, 0
+    pshufd xmm8, xmm8, 0
+    movsxd rax, DWORD PTR [rbp-60]
+    mov rdi, rax
+    mov rax, r13
+    add rax, 15
+    cmp rax, rdi
+    jge .Lvend48
+    .p2align 4
+.Lvbegin48:
+    mov rax, r13
+    mov rdi, rax
+    mov rax, QWORD PTR [rbp-48]
+    movdqu xmm0, XMMWORD PTR [rax+rdi*1]
+    movdqa xmm1, xmm8
+    pcmpeqb xmm0, xmm1
+    pmovmskb eax, xmm0
+    test eax, eax
+    jne .Lvend48
+    add r13, 16
+    movsxd rax, DWORD PTR [rbp-60]
+    mov rdi, rax
+    mov rax, r13
+    add rax, 15
+    cmp rax, rdi
+    jl .Lvbegin48
+.Lvend48:
+    mov rax, r13
+    mov rdi, rax
+    mov rax, QWORD PTR [rbp-48]
+    add rax, rdi
+    mov QWORD PTR [rbp-56], rax
+    movsxd rax, DWORD PTR [rbp-60]
+    mov rdi, rax
+    mov rax, r13
+    add rax, 3
+    cmp rax, rdi
+    jge .Lend49
+    .p2align 4
+.Lbegin49:
+    movsx rax, BYTE PTR [rbp-111]
+    mov rdi, rax
+    mov rax, QWORD PTR [rbp-56]
+    movsx rax, BYTE PTR [rax]
+    cmp rax, rdi
+    jne .Lelse50
+    mov rax, r13
+    jmp .find_char.i11.return
+.Lelse50:
+.Lend50:
+    movsx rax, BYTE PTR [rbp-111]
+    mov rdi, rax
+    mov rax, QWORD PTR [rbp-56]
+    movsx rax, BYTE PTR [rax+1]
+    cmp rax, rdi
+    jne .Lelse51
+    mov rax, r13
+    add rax, 1
+    jmp .find_char.i11.return
+.Lelse51:
+.Lend51:
+    movsx rax, BYTE PTR [rbp-111]
+    mov rdi, rax
+    mov rax, QWORD PTR [rbp-56]
+    movsx rax, BYTE PTR [rax+2]
+    cmp rax, rdi
+    jne .Lelse52
+    mov rax, r13
+    add rax, 2
+    jmp .find_char.i11.return
+.Lelse52:
+.Lend52:
+    movsx rax, BYTE PTR [rbp-111]
+    mov rdi, rax
+    mov rax, QWORD PTR [rbp-56]
+    movsx rax, BYTE PTR [rax+3]
+    cmp rax, rdi
+    jne .Lelse53
+    mov rax, r13
+    add rax, 3
+    jmp .find_char.i11.return
+.Lelse53:
+.Lend53:
+    mov rax, QWORD PTR [rbp-56]
+    add rax, 4
+    mov QWORD PTR [rbp-56], rax
+    mov rax, r13
+    add rax, 4
+    movsxd r13, eax
+    movsxd rax, DWORD PTR [rbp-60]
+    mov rdi, rax
+    mov rax, r13
+    add rax, 3
+    cmp rax, rdi
+    jl .Lbegin49
+.Lend49:
+    mov rax, r13
+    mov rdi, rax
+    mov rax, QWORD PTR [rbp-48]
+    add rax, rdi
+    mov QWORD PTR [rbp-56], rax
+    movsxd rax, DWORD PTR [rbp-60]
+    mov rdi, rax
+    mov rax, r13
+    cmp rax, rdi
+    jge .Lend54
+    .p2align 4
+.Lbegin54:
+    movsx rax, BYTE PTR [rbp-111]
+    mov rdi, rax
+    mov rax, QWORD PTR [rbp-56]
+    movsx rax, BYTE PTR [rax]
+    cmp rax, rdi
+    jne .Lelse55
+    mov rax, r13
+    jmp .find_char.i11.return
+.Lelse55:
+.Lend55:
+    mov rax, QWORD PTR [rbp-56]
+    add rax, 1
+    mov QWORD PTR [rbp-56], rax
+    mov rax, r13
+    add rax, 1
+    movsxd r13, eax
+    movsxd rax, DWORD PTR [rbp-60]
+    mov rdi, rax
+    mov rax, r13
+    cmp rax, rdi
+    jl .Lbegin54
+.Lend54:
+    mov rax, -1
+.find_char.i11.return:
+    mov rsi, rax
+    mov rdi, -1
+    call assert
+    movsxd rax, eax
+    mov DWORD PTR [rbp-60], 0
+    lea rax, [rbp-110]
+    add rax, 0
+    mov QWORD PTR [rbp-56], rax
+    movsxd rax, DWORD PTR [rbp-60]
+    add rax, 3
+    cmp rax, 50
+    jge .Lend56
+    .p2align 4
+.Lbegin56:
+    mov rax, QWORD PTR [rbp-56]
+    mov QWORD PTR [rbp-48], rax
+    mov rax, QWORD PTR [rbp-56]
+    lea rax, [rax]
+    mov rdi, rax
+    movsxd rax, DWORD PTR [rbp-60]
+    mov BYTE PTR [rdi], al
+    mov rax, QWORD PTR [rbp-56]
+    lea rax, [rax+1]
+    mov rdi, rax
+    movsxd rax, DWORD PTR [rbp-60]
+    add rax, 1
+    mov BYTE PTR [rdi], al
+    mov rax, QWORD PTR [rbp-56]
+    lea rax, [rax+2]
+    mov rdi, rax
+    movsxd rax, DWORD PTR [rbp-60]
+    add rax, 2
+    mov BYTE PTR [rdi], al
+    mov rax, QWORD PTR [rbp-56]
+    lea rax, [rax+3]
+    mov rdi, rax
+    movsxd rax, DWORD PTR [rbp-60]
+    add rax, 3
+    mov BYTE PTR [rdi], al
+    mov rax, QWORD PTR [rbp-56]
+    add rax, 4
+    mov QWORD PTR [rbp-56], rax
+    add DWORD PTR [rbp-60], 4
+    movsxd rax, DWORD PTR [rbp-60]
+    add rax, 3
+    cmp rax, 50
+    jl .Lbegin56
+.Lend56:
+    movsxd rax, DWORD PTR [rbp-60]
+    mov rdi, rax
+    lea rax, [rbp-110]
+    add rax, rdi
+    mov QWORD PTR [rbp-48], rax
+    movsxd rax, DWORD PTR [rbp-60]
+    cmp rax, 50
+    jge .Lend57
+    .p2align 4
+.Lbegin57:
+    mov rax, QWORD PTR [rbp-48]
+    lea rax, [rax]
+    mov rdi, rax
+    movsxd rax, DWORD PTR [rbp-60]
+    mov BYTE PTR [rdi], al
+    mov rax, QWORD PTR [rbp-48]
+    add rax, 1
+    mov QWORD PTR [rbp-48], rax
+    inc DWORD PTR [rbp-60]
+    movsxd rax, DWORD PTR [rbp-60]
+    cmp rax, 50
+    jl .Lbegin57
+.Lend57:
+    lea rax, [rbp-110]
+    mov QWORD PTR [rbp-48], rax
+    mov DWORD PTR [rbp-60], 50
+    mov BYTE PTR [rbp-111], 60
+    mov r14, 0
+    movsx rax, BYTE PTR [rbp-111]
+    movd xmm8, eax
+    punpcklbw xmm8, xmm8
+    pshuflw xmm8, xmm8, 0
+    pshufd xmm8, xmm8, 0
+    movsxd rax, DWORD PTR [rbp-60]
+    mov rdi, rax
+    mov rax, r14
+    add rax, 15
+    cmp rax, rdi
+    jge .Lvend58
+    .p2align 4
+.Lvbegin58:
+    mov rax, r14
+    mov rdi, rax
+    mov rax, QWORD PTR [rbp-48]
+    movdqu xmm0, XMMWORD PTR [rax+rdi*1]
+    movdqa xmm1, xmm8
+    pcmpeqb xmm0, xmm1
+    pmovmskb eax, xmm0
+    test eax, eax
+    jne .Lvend58
+    add r14, 16
+    movsxd rax, DWORD PTR [rbp-60]
+    mov rdi, rax
+    mov rax, r14
+    add rax, 15
+    cmp rax, rdi
+    jl .Lvbegin58
+.Lvend58:
+    mov rax, r14
+    mov rdi, rax
+    mov rax, QWORD PTR [rbp-48]
+    add rax, rdi
+    mov QWORD PTR [rbp-56], rax
+    movsxd rax, DWORD PTR [rbp-60]
+    mov rdi, rax
+    mov rax, r14
+    add rax, 3
+    cmp rax, rdi
+    jge .Lend59
+    .p2align 4
+.Lbegin59:
+    movsx rax, BYTE PTR [rbp-111]
+    mov rdi, rax
+    mov rax, QWORD PTR [rbp-56]
+    movsx rax, BYTE PTR [rax]
+    cmp rax, rdi
+    jne .Lelse60
+    mov rax, r14
+    jmp .find_char.i12.return
+.Lelse60:
+.Lend60:
+    movsx rax, BYTE PTR [rbp-111]
+    mov rdi, rax
+    mov rax, QWORD PTR [rbp-56]
+    movsx rax, BYTE PTR [rax+1]
+    cmp rax, rdi
+    jne .Lelse61
+    mov rax, r14
+    add rax, 1
+    jmp .find_char.i12.return
+.Lelse61:
+.Lend61:
+    movsx rax, BYTE PTR [rbp-111]
+    mov rdi, rax
+    mov rax, QWORD PTR [rbp-56]
+    movsx rax, BYTE PTR [rax+2]
+    cmp rax, rdi
+    jne .Lelse62
+    mov rax, r14
+    add rax, 2
+    jmp .find_char.i12.return
+.Lelse62:
+.Lend62:
+    movsx rax, BYTE PTR [rbp-111]
+    mov rdi, rax
+    mov rax, QWORD PTR [rbp-56]
+    movsx rax, BYTE PTR [rax+3]
+    cmp rax, rdi
+    jne .Lelse63
+    mov rax, r14
+    add rax, 3
+    jmp .find_char.i12.return
+.Lelse63:
+.Lend63:
+    mov rax, QWORD PTR [rbp-56]
+    add rax, 4
+    mov QWORD PTR [rbp-56], rax
+    mov rax, r14
+    add rax, 4
+    movsxd r14, eax
+    movsxd rax, DWORD PTR [rbp-60]
+    mov rdi, rax
+    mov rax, r14
+    add rax, 3
+    cmp rax, rdi
+    jl .Lbegin59
+.Lend59:
+    mov rax, r14
+    mov rdi, rax
+    mov rax, QWORD PTR [rbp-48]
+    add rax, rdi
+    mov QWORD PTR [rbp-56], rax
+    movsxd rax, DWORD PTR [rbp-60]
+    mov rdi, rax
+    mov rax, r14
+    cmp rax, rdi
+    jge .Lend64
+    .p2align 4
+.Lbegin64:
+    movsx rax, BYTE PTR [rbp-111]
+    mov rdi, rax
+    mov rax, QWORD PTR [rbp-56]
+    movsx rax, BYTE PTR [rax]
+    cmp rax, rdi
+    jne .Lelse65
+    mov rax, r14
+    jmp .find_char.i12.return
+.Lelse65:
+.Lend65:
+    mov rax, QWORD PTR [rbp-56]
+    add rax, 1
+    mov QWORD PTR [rbp-56], rax
+    mov rax, r14
+    add rax, 1
+    movsxd r14, eax
+    movsxd rax, DWORD PTR [rbp-60]
+    mov rdi, rax
+    mov rax, r14
+    cmp rax, rdi
+    jl .Lbegin64
+.Lend64:
+    mov rax, -1
+.find_char.i12.return:
+    mov rsi, rax
+    mov rdi, -1
+    call assert
+    movsxd rax, eax
+    mov rdi, 121393
+    mov rsi, 121393
+    call assert
+    movsxd rax, eax
+    mov rdi, 338350
+    mov rsi, 338350
+    call assert
+    movsxd rax, eax
+    mov rdi, 36
+    mov rsi, 36
+    call assert
+    movsxd rax, eax
+    mov rdi, -156
+    mov rsi, -156
+    call assert
+    movsxd rax, eax
+    mov DWORD PTR [rbp-44], 9
+    mov DWORD PTR [rip+counter], 9
+    mov rax, 9
+.set_counter.i13.return:
+    mov rsi, rax
+    mov rdi, 9
+    call assert
+    movsxd rax, eax
+    mov rdi, 9
+    movsxd rsi, DWORD PTR [rip+counter]
+    call assert
+    movsxd rax, eax
+    mov DWORD PTR [rbp-44], 0
+    mov DWORD PTR [rbp-48], 3
+    mov DWORD PTR [rbp-52], 4
+    movsxd rax, DWORD PTR [rbp-44]
+    cmp eax, 4
+    ja .Lcase72
+    lea rdx, [rip+.Ltable73]
+    movsxd rax, DWORD PTR [rdx+rax*4]
+    add rax, rdx
+    jmp rax
+    .section .rodata
+    .p2align 2
+.Ltable73:
+    .long .Lcase67-.Ltable73
+    .long .Lcase68-.Ltable73
+    .long .Lcase69-.Ltable73
+    .long .Lcase70-.Ltable73
+    .long .Lcase71-.Ltable73
+    .text
+.Lcase67:
+    movsxd rax, DWORD PTR [rbp-52]
+    mov rdi, rax
+    movsxd rax, DWORD PTR [rbp-48]
+    add rax, rdi
+    jmp .dispatch.i14.return
+.Lcase68:
+    movsxd rax, DWORD PTR [rbp-52]
+    mov rdi, rax
+    movsxd rax, DWORD PTR [rbp-48]
+    sub rax, rdi
+    jmp .dispatch.i14.return
+.Lcase69:
+    movsxd rax, DWORD PTR [rbp-52]
+    mov rdi, rax
+    movsxd rax, DWORD PTR [rbp-48]
+    imul rax, rdi
+    jmp .dispatch.i14.return
+.Lcase70:
+    movsxd rax, DWORD PTR [rbp-52]
+    mov rdi, rax
+    movsxd rax, DWORD PTR [rbp-48]
+    cdq
+    idiv edi
+    movsxd rax, eax
+    jmp .dispatch.i14.return
+.Lcase71:
+    movsxd rax, DWORD PTR [rbp-52]
+    mov rdi, rax
+    movsxd rax, DWORD PTR [rbp-48]
+    cdq
+    idiv edi
+    movsxd rax, edx
+    jmp .dispatch.i14.return
+.Lcase72:
+    mov rax, -1
+.Lend66:
+.dispatch.i14.return:
+    mov rsi, rax
+    mov rdi, 7
+    call assert
+    movsxd rax, eax
+    mov DWORD PTR [rbp-44], 1
+    mov DWORD PTR [rbp-48], 3
+    mov DWORD PTR [rbp-52], 4
+    movsxd rax, DWORD PTR [rbp-44]
+    cmp eax, 4
+    ja .Lcase80
+    lea rdx, [rip+.Ltable81]
+    movsxd rax, DWORD PTR [rdx+rax*4]
+    add rax, rdx
+    jmp rax
+    .section .rodata
+    .p2align 2
+.Ltable81:
+    .long .Lcase75-.Ltable81
+    .long .Lcase76-.Ltable81
+    .long .Lcase77-.Ltable81
+    .long .Lcase78-.Ltable81
+    .long .Lcase79-.Ltable81
+    .text
+.Lcase75:
+    movsxd rax, DWORD PTR [rbp-52]
+    mov rdi, rax
+    movsxd rax, DWORD PTR [rbp-48]
+    add rax, rdi
+    jmp .dispatch.i15.return
+.Lcase76:
+    movsxd rax, DWORD PTR [rbp-52]
+    mov rdi, rax
+    movsxd rax, DWORD PTR [rbp-48]
+    sub rax, rdi
+    jmp .dispatch.i15.return
+.Lcase77:
+    movsxd rax, DWORD PTR [rbp-52]
+    mov rdi, rax
+    movsxd rax, DWORD PTR [rbp-48]
+    imul rax, rdi
+    jmp .dispatch.i15.return
+.Lcase78:
+    movsxd rax, DWORD PTR [rbp-52]
+    mov rdi, rax
+    movsxd rax, DWORD PTR [rbp-48]
+    cdq
+    idiv edi
+    movsxd rax, eax
+    jmp .dispatch.i15.return
+.Lcase79:
+    movsxd rax, DWORD PTR [rbp-52]
+    mov rdi, rax
+    movsxd rax, DWORD PTR [rbp-48]
+    cdq
+    idiv edi
+    movsxd rax, edx
+    jmp .dispatch.i15.return
+.Lcase80:
+    mov rax, -1
+.Lend74:
+.dispatch.i15.return:
+    mov rsi, rax
+    mov rdi, -1
+    call assert
+    movsxd rax, eax
+    mov DWORD PTR [rbp-44], 2
+    mov DWORD PTR [rbp-48], 3
+    mov DWORD PTR [rbp-52], 4
+    movsxd rax, DWORD PTR [rbp-44]
+    cmp eax, 4
+    ja .Lcase88
+    lea rdx, [rip+.Ltable89]
+    movsxd rax, DWORD PTR [rdx+rax*4]
+    add rax, rdx
+    jmp rax
+    .section .rodata
+    .p2align 2
+.Ltable89:
+    .long .Lcase83-.Ltable89
+    .long .Lcase84-.Ltable89
+    .long .Lcase85-.Ltable89
+    .long .Lcase86-.Ltable89
+    .long .Lcase87-.Ltable89
+    .text
+.Lcase83:
+    movsxd rax, DWORD PTR [rbp-52]
+    mov rdi, rax
+    movsxd rax, DWORD PTR [rbp-48]
+    add rax, rdi
+    jmp .dispatch.i16.return
+.Lcase84:
+    movsxd rax, DWORD PTR [rbp-52]
+    mov rdi, rax
+    movsxd rax, DWORD PTR [rbp-48]
+    sub rax, rdi
+    jmp .dispatch.i16.return
+.Lcase85:
+    movsxd rax, DWORD PTR [rbp-52]
+    mov rdi, rax
+    movsxd rax, DWORD PTR [rbp-48]
+    imul rax, rdi
+    jmp .dispatch.i16.return
+.Lcase86:
+    movsxd rax, DWORD PTR [rbp-52]
+    mov rdi, rax
+    movsxd rax, DWORD PTR [rbp-48]
+    cdq
+    idiv edi
+    movsxd rax, eax
+    jmp .dispatch.i16.return
+.Lcase87:
+    movsxd rax, DWORD PTR [rbp-52]
+    mov rdi, rax
+    movsxd rax, DWORD PTR [rbp-48]
+    cdq
+    idiv edi
+    movsxd rax, edx
+    jmp .dispatch.i16.return
+.Lcase88:
+    mov rax, -1
+.Lend82:
+.dispatch.i16.return:
+    mov rsi, rax
+    mov rdi, 12
+    call assert
+    movsxd rax, eax
+    mov DWORD PTR [rbp-44], 4
+    mov DWORD PTR [rbp-48], 11
+    mov DWORD PTR [rbp-52], 4
+    movsxd rax, DWORD PTR [rbp-44]
+    cmp eax, 4
+    ja .Lcase96
+    lea rdx, [rip+.Ltable97]
+    movsxd rax, DWORD PTR [rdx+rax*4]
+    add rax, rdx
+    jmp rax
+    .section .rodata
+    .p2align 2
+.Ltable97:
+    .long .Lcase91-.Ltable97
+    .long .Lcase92-.Ltable97
+    .long .Lcase93-.Ltable97
+    .long .Lcase94-.Ltable97
+    .long .Lcase95-.Ltable97
+    .text
+.Lcase91:
+    movsxd rax, DWORD PTR [rbp-52]
+    mov rdi, rax
+    movsxd rax, DWORD PTR [rbp-48]
+    add rax, rdi
+    jmp .dispatch.i17.return
+.Lcase92:
+    movsxd rax, DWORD PTR [rbp-52]
+    mov rdi, rax
+    movsxd rax, DWORD PTR [rbp-48]
+    sub rax, rdi
+    jmp .dispatch.i17.return
+.Lcase93:
+    movsxd rax, DWORD PTR [rbp-52]
+    mov rdi, rax
+    movsxd rax, DWORD PTR [rbp-48]
+    imul rax, rdi
+    jmp .dispatch.i17.return
+.Lcase94:
+    movsxd rax, DWORD PTR [rbp-52]
+    mov rdi, rax
+    movsxd rax, DWORD PTR [rbp-48]
+    cdq
+    idiv edi
+    movsxd rax, eax
+    jmp .dispatch.i17.return
+.Lcase95:
+    movsxd rax, DWORD PTR [rbp-52]
+    mov rdi, rax
+    movsxd rax, DWORD PTR [rbp-48]
+    cdq
+    idiv edi
+    movsxd rax, edx
+    jmp .dispatch.i17.return
+.Lcase96:
+    mov rax, -1
+.Lend90:
+.dispatch.i17.return:
+    mov rsi, rax
+    mov rdi, 3
+    call assert
+    movsxd rax, eax
+    mov DWORD PTR [rbp-44], 9
+    mov DWORD PTR [rbp-48], 3
+    mov DWORD PTR [rbp-52], 4
+    movsxd rax, DWORD PTR [rbp-44]
+    cmp eax, 4
+    ja .Lcase104
+    lea rdx, [rip+.Ltable105]
+    movsxd rax, DWORD PTR [rdx+rax*4]
+    add rax, rdx
+    jmp rax
+    .section .rodata
+    .p2align 2
+.Ltable105:
+    .long .Lcase99-.Ltable105
+    .long .Lcase100-.Ltable105
+    .long .Lcase101-.Ltable105
+    .long .Lcase102-.Ltable105
+    .long .Lcase103-.Ltable105
+    .text
+.Lcase99:
+    movsxd rax, DWORD PTR [rbp-52]
+    mov rdi, rax
+    movsxd rax, DWORD PTR [rbp-48]
+    add rax, rdi
+    jmp .dispatch.i18.return
+.Lcase100:
+    movsxd rax, DWORD PTR [rbp-52]
+    mov rdi, rax
+    movsxd rax, DWORD PTR [rbp-48]
+    sub rax, rdi
+    jmp .dispatch.i18.return
+.Lcase101:
+    movsxd rax, DWORD PTR [rbp-52]
+    mov rdi, rax
+    movsxd rax, DWORD PTR [rbp-48]
+    imul rax, rdi
+    jmp .dispatch.i18.return
+.Lcase102:
+    movsxd rax, DWORD PTR [rbp-52]
+    mov rdi, rax
+    movsxd rax, DWORD PTR [rbp-48]
+    cdq
+    idiv edi
+    movsxd rax, eax
+    jmp .dispatch.i18.return
+.Lcase103:
+    movsxd rax, DWORD PTR [rbp-52]
+    mov rdi, rax
+    movsxd rax, DWORD PTR [rbp-48]
+    cdq
+    idiv edi
+    movsxd rax, edx
+    jmp .dispatch.i18.return
+.Lcase104:
+    mov rax, -1
+.Lend98:
+.dispatch.i18.return:
+    mov rsi, rax
+    mov rdi, -1
+    call assert
+    movsxd rax, eax
+    mov rdi, -3
+    mov rsi, -3
+    call assert
+    movsxd rax, eax
+    mov rdi, 3
+    mov rsi, 3
+    call assert
+    movsxd rax, eax
+    mov rdi, 2
+    mov rsi, 2
+    call assert
+    movsxd rax, eax
+    mov DWORD PTR [rbp-88], 4
+    mov DWORD PTR [rbp-84], -2
+    mov DWORD PTR [rbp-80], 9
+    mov DWORD PTR [rbp-76], -7
+    mov DWORD PTR [rbp-72], 0
+    mov DWORD PTR [rbp-68], -7
+    lea rax, [rbp-88]
+    mov QWORD PTR [rbp-48], rax
+    mov DWORD PTR [rbp-92], 6
+    mov rax, QWORD PTR [rbp-48]
+    movsxd rax, DWORD PTR [rax]
+    movsxd rbx, eax
+    mov DWORD PTR [rbp-96], 1
+    mov rax, 1
+    shl rax, 2
+    mov rdi, rax
+    mov rax, QWORD PTR [rbp-48]
+    add rax, rdi
+    mov QWORD PTR [rbp-64], rax
+    movsxd rax, DWORD PTR [rbp-92]
+    mov rdi, rax
+    movsxd rax, DWORD PTR [rbp-96]
+    add rax, 3
+    cmp rax, rdi
+    jge .Lend106
+    .p2align 4
+.Lbegin106:
+    mov rax, QWORD PTR [rbp-64]
+    mov QWORD PTR [rbp-56], rax
+    mov rax, QWORD PTR [rbp-64]
+    movsxd rax, DWORD PTR [rax]
+    mov DWORD PTR [rbp-112], eax
+    mov rax, rbx
+    mov rdi, rax
+    movsxd rax, DWORD PTR [rbp-112]
+    cmp rax, rdi
+    cmovge rax, rdi
+    movsxd rbx, eax
+    mov rax, QWORD PTR [rbp-64]
+    movsxd rax, DWORD PTR [rax+4]
+    mov DWORD PTR [rbp-100], eax
+    mov rax, rbx
+    mov rdi, rax
+    movsxd rax, DWORD PTR [rbp-100]
+    cmp rax, rdi
+    cmovge rax, rdi
+    movsxd rbx, eax
+    mov rax, QWORD PTR [rbp-64]
+    movsxd rax, DWORD PTR [rax+8]
+    mov DWORD PTR [rbp-104], eax
+    mov rax, rbx
+    mov rdi, rax
+    movsxd rax, DWORD PTR [rbp-104]
+    cmp rax, rdi
+    cmovge rax, rdi
+    movsxd rbx, eax
+    mov rax, QWORD PTR [rbp-64]
+    movsxd rax, DWORD PTR [rax+12]
+    mov DWORD PTR [rbp-108], eax
+    mov rax, rbx
+    mov rdi, rax
+    movsxd rax, DWORD PTR [rbp-108]
+    cmp rax, rdi
+    cmovge rax, rdi
+    movsxd rbx, eax
+    mov rax, QWORD PTR [rbp-64]
+    add rax, 16
+    mov QWORD PTR [rbp-64], rax
+    add DWORD PTR [rbp-96], 4
+    movsxd rax, DWORD PTR [rbp-92]
+    mov rdi, rax
+    movsxd rax, DWORD PTR [rbp-96]
+    add rax, 3
+    cmp rax, rdi
+    jl .Lbegin106
+.Lend106:
+    movsxd rax, DWORD PTR [rbp-96]
+    shl rax, 2
+    mov rdi, rax
+    mov rax, QWORD PTR [rbp-48]
+    add rax, rdi
+    mov QWORD PTR [rbp-56], rax
+    movsxd rax, DWORD PTR [rbp-92]
+    mov rdi, rax
+    movsxd rax, DWORD PTR [rbp-96]
+    cmp rax, rdi
+    jge .Lend107
+    .p2align 4
+.Lbegin107:
+    mov rax, rbx
+    mov rdi, rax
+    mov rax, QWORD PTR [rbp-56]
+    movsxd rax, DWORD PTR [rax]
+    cmp rax, rdi
+    cmovge rax, rdi
+    movsxd rbx, eax
+    mov rax, QWORD PTR [rbp-56]
+    add rax, 4
+    mov QWORD PTR [rbp-56], rax
+    inc DWORD PTR [rbp-96]
+    movsxd rax, DWORD PTR [rbp-92]
+    mov rdi, rax
+    movsxd rax, DWORD PTR [rbp-96]
+    cmp rax, rdi
+    jl .Lbegin107
+.Lend107:
+    mov rax, rbx
+.arr_min.i19.return:
+    mov rsi, rax
+    mov rdi, -7
+    call assert
+    movsxd rax, eax
+    mov rdi, 1
+    mov rsi, 1
+    call assert
+    movsxd rax, eax
+    mov rdi, 0
+    mov rsi, 0
+    call assert
+    movsxd rax, eax
+    mov rdi, -1
+    mov rsi, -1
+    call assert
+    movsxd rax, eax
+    mov DWORD PTR [rbp-60], 0
+    lea rax, [rbp-94]
+    add rax, 0
+    mov QWORD PTR [rbp-56], rax
+    movsxd rax, DWORD PTR [rbp-60]
+    add rax, 3
+    cmp rax, 30
+    jge .Lend108
+    .p2align 4
+.Lbegin108:
+    mov rax, QWORD PTR [rbp-56]
+    mov QWORD PTR [rbp-48], rax
+    movsxd rax, DWORD PTR [rbp-60]
+    lea rax, [rax+rax*2]
+    mov DWORD PTR [rbp-64], eax
+    mov rax, QWORD PTR [rbp-56]
+    lea rax, [rax]
+    mov rdi, rax
+    movsxd rax, DWORD PTR [rbp-64]
+    mov BYTE PTR [rdi], al
+    mov rax, QWORD PTR [rbp-56]
+    lea rax, [rax+1]
+    mov rdi, rax
+    movsxd rax, DWORD PTR [rbp-64]
+    add rax, 3
+    mov BYTE PTR [rdi], al
+    mov rax, QWORD PTR [rbp-56]
+    lea rax, [rax+2]
+    mov rdi, rax
+    movsxd rax, DWORD PTR [rbp-64]
+    add rax, 6
+    mov BYTE PTR [rdi], al
+    mov rax, QWORD PTR [rbp-56]
+    lea rax, [rax+3]
+    mov rdi, rax
+    movsxd rax, DWORD PTR [rbp-64]
+    add rax, 9
+    mov BYTE PTR [rdi], al
+    mov rax, QWORD PTR [rbp-56]
+    add rax, 4
+    mov QWORD PTR [rbp-56], rax
+    add DWORD PTR [rbp-60], 4
+    movsxd rax, DWORD PTR [rbp-60]
+    add rax, 3
+    cmp rax, 30
+    jl .Lbegin108
+.Lend108:
+    movsxd rax, DWORD PTR [rbp-60]
+    mov rdi, rax
+    lea rax, [rbp-94]
+    add rax, rdi
+    mov QWORD PTR [rbp-48], rax
+    movsxd rax, DWORD PTR [rbp-60]
+    cmp rax, 30
+    jge .Lend109
+    .p2align 4
+.Lbegin109:
+    mov rax, QWORD PTR [rbp-48]
+    lea rax, [rax]
+    mov rdi, rax
+    movsxd rax, DWORD PTR [rbp-60]
+    lea rax, [rax+rax*2]
+    mov BYTE PTR [rdi], al
+    mov rax, QWORD PTR [rbp-48]
+    add rax, 1
+    mov QWORD PTR [rbp-48], rax
+    inc DWORD PTR [rbp-60]
+    movsxd rax, DWORD PTR [rbp-60]
+    cmp rax, 30
+    jl .Lbegin109
+.Lend109:
+    lea rdi, [rbp-94]
+    mov rsi, 30
+    call histogram
+    mov rsi, rax
+    mov rdi, 44
+    call assert
+    movsxd rax, eax
+    mov DWORD PTR [rbp-60], 0
+    lea rax, [rbp-94]
+    add rax, 0
+    mov QWORD PTR [rbp-56], rax
+    movsxd rax, DWORD PTR [rbp-60]
+    add rax, 3
+    cmp rax, 30
+    jge .Lend110
+    .p2align 4
+.Lbegin110:
+    mov rax, QWORD PTR [rbp-56]
+    mov QWORD PTR [rbp-48], rax
+    movsxd rax, DWORD PTR [rbp-60]
+    lea rax, [rax+rax*2]
+    mov DWORD PTR [rbp-64], eax
+    mov rax, QWORD PTR [rbp-56]
+    lea rax, [rax]
+    mov rdi, rax
+    movsxd rax, DWORD PTR [rbp-64]
+    mov BYTE PTR [rdi], al
+    mov rax, QWORD PTR [rbp-56]
+    lea rax, [rax+1]
+    mov rdi, rax
+    movsxd rax, DWORD PTR [rbp-64]
+    add rax, 3
+    mov BYTE PTR [rdi], al
+    mov rax, QWORD PTR [rbp-56]
+    lea rax, [rax+2]
+    mov rdi, rax
+    movsxd rax, DWORD PTR [rbp-64]
+    add rax, 6
+    mov BYTE PTR [rdi], al
+    mov rax, QWORD PTR [rbp-56]
+    lea rax, [rax+3]
+    mov rdi, rax
+    movsxd rax, DWORD PTR [rbp-64]
+    add rax, 9
+    mov BYTE PTR [rdi], al
+    mov rax, QWORD PTR [rbp-56]
+    add rax, 4
+    mov QWORD PTR [rbp-56], rax
+    add DWORD PTR [rbp-60], 4
+    movsxd rax, DWORD PTR [rbp-60]
+    add rax, 3
+    cmp rax, 30
+    jl .Lbegin110
+.Lend110:
+    movsxd rax, DWORD PTR [rbp-60]
+    mov rdi, rax
+    lea rax, [rbp-94]
+    add rax, rdi
+    mov QWORD PTR [rbp-48], rax
+    movsxd rax, DWORD PTR [rbp-60]
+    cmp rax, 30
+    jge .Lend111
+    .p2align 4
+.Lbegin111:
+    mov rax, QWORD PTR [rbp-48]
+    lea rax, [rax]
+    mov rdi, rax
+    movsxd rax, DWORD PTR [rbp-60]
+    lea rax, [rax+rax*2]
+    mov BYTE PTR [rdi], al
+    mov rax, QWORD PTR [rbp-48]
+    add rax, 1
+    mov QWORD PTR [rbp-48], rax
+    inc DWORD PTR [rbp-60]
+    movsxd rax, DWORD PTR [rbp-60]
+    cmp rax, 30
+    jl .Lbegin111
+.Lend111:
+    lea rdi, [rbp-94]
+    mov rsi, 30
+    call histogram
+    mov rsi, rax
+    mov rdi, 88
+    call assert
+    movsxd rax, eax
+    mov DWORD PTR [rbp-44], 3
+    mov DWORD PTR [rip+counter], 3
+    mov rax, 3
+.set_counter.i20.return:
+    movsxd rdi, DWORD PTR [rip+counter]
+    call hoist_caller
+    mov rsi, rax
+    mov rdi, 558
+    call assert
+    movsxd rax, eax
+    mov rdi, 231
+    mov rsi, 231
+    call assert
+    movsxd rax, eax
+    mov rdi, 123
+    mov rsi, 123
+    call assert
+    movsxd rax, eax
+    mov rdi, 359
+    mov rsi, 359
+    call assert
+    movsxd rax, eax
+    lea rdi, [rip+.L..0]
+    call printf
+    movsxd rax, eax
+    xor eax, eax
+.main.return:
+    lea rsp, [rbp-40]
+    pop r15
+    pop r14
+    pop r13
+    pop r12
+    pop rbx
+    pop rbp
+    ret
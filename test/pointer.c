@@ -23,6 +23,9 @@ int main() {
     ASSERT(5, ({ int x[3]; *x=3; x[1]=4; x[2]=5; *(x+2); }));
     ASSERT(5, ({ int x[3]; *x=3; x[1]=4; x[2]=5; *(x+2); }));
     ASSERT(5, ({ int x[3]; *x=3; x[1]=4; 2[x]=5; *(x+2); }));
+    ASSERT(7, ({ int x[3]; x[1]=7; x[0]=1; x[1]; }));
+    ASSERT(7, ({ char x[3]; int y; y=0; x[1]=7; x[0]=1; x[2]=-1; x[1]; }));
+    ASSERT(-1, ({ int x[2]; x[0]=-1; x[1]=0; x[0]; }));
 
     ASSERT(0, ({ int x[2][3]; int *y; y=x; y[0]=0; x[0][0]; }));
     ASSERT(1, ({ int x[2][3]; int *y; y=x; y[1]=1; x[0][1]; }));
@@ -30,6 +33,23 @@ int main() {
     ASSERT(3, ({ int x[2][3]; int *y; y=x; y[3]=3; x[1][0]; }));
     ASSERT(4, ({ int x[2][3]; int *y; y=x; y[4]=4; x[1][1]; }));
     ASSERT(5, ({ int x[2][3]; int *y; y=x; y[5]=5; x[1][2]; }));
+
+    ASSERT(12, ({ int a[3]; int b[3]; int i; i=1; a[i]=5; b[i]=7; a[i]=a[i]+b[i]; a[i]; }));
+    ASSERT(10, ({ int a[3]; int *p; int i; i=2; p=a+i; a[i]=4; *p=5; a[i]+a[i]; }));
+    ASSERT(14, ({ int a[3]; int i; i=0; a[i]=3; i=i+1; a[i]=4; a[i]*a[i]-a[0]+a[0]-2; }));
+    ASSERT(25, ({ int x[2][3]; int i; int j; i=1; j=2; x[i][j]=5; x[i][j]*x[i][j]; }));
+    ASSERT(2, ({ int x; int *p; int *q; p=&x; q=&x; *p=1; *q=2; *p; }));
+    ASSERT(12, ({ int a[2]; int x; int *p; p=a; x=5; *p=7; x+*p; }));
+    ASSERT(4, ({ int a[2]; int *p; p=a; a[0]=1; a[1]=3; *p=1; a[1]+*p; }));
+    ASSERT(5, ({ int a[3]; a[0]=1; a[1]=2; a[0]=3; a[0]+a[1]; }));
+    ASSERT(3, ({ int x; int *p; x=1; p=&x; *p=3; x; }));
+    ASSERT(44, ({ char c[2]; c[0]=300; c[0]; }));
+    ASSERT(9, ({ int a[2]; int *p; int *q; p=a; q=p; *q=9; *p; }));
+    ASSERT(7, ({ int x; int *p; p=&x; x=10; *p=*p-1; *p=*p-2; x; }));
+    ASSERT(5, ({ int a[3]; int i; i=1; a[i]=2; a[i]=a[i]+3; a[i]; }));
+    ASSERT(-126, ({ char c[2]; c[0]=120; c[0]=c[0]+10; c[0]; }));
+    ASSERT(8, ({ int a[4]; int *p; a[2]=8; p=a; p=p+2; *p; }));
+    ASSERT(20, ({ int a[3]; int i; int k; i=2; k=6; a[i]=2; a[i]=k+a[i]; a[i]=a[i]+k+6; a[i]; }));
     
     /*
      TODO ポインタ演算にバグが存在
@@ -0,0 +1,501 @@
+.intel_syntax noprefix
+.global main
+.text
+main:
+    push rbp
+    mov rbp, rsp
+    push rbx
+    push r12
+    push r13
+    push r14
+    push r15
+    sub rsp, 72
+    mov DWORD PTR [rbp-60], 3
+    lea rax, [rbp-60]
+    mov QWORD PTR [rbp-48], rax
+    lea rax, [rbp-48]
+    mov QWORD PTR [rbp-56], rax
+    mov rax, QWORD PTR [rax]
+    movsxd rax, DWORD PTR [rax]
+    mov rsi, rax
+    mov rdi, 3
+    call assert
+    movsxd rax, eax
+    mov DWORD PTR [rbp-44], 3
+    mov DWORD PTR [rbp-44], 5
+    mov rax, 3
+    add rax, 5
+    mov rsi, rax
+    mov rdi, 8
+    call assert
+    movsxd rax, eax
+    mov DWORD PTR [rbp-44], 3
+    mov DWORD PTR [rbp-44], 5
+    mov rax, 3
+    add rax, 5
+    mov rsi, rax
+    mov rdi, 8
+    call assert
+    movsxd rax, eax
+    lea rax, [rbp-56]
+    mov QWORD PTR [rbp-48], rax
+    mov DWORD PTR [rax], 3
+    movsxd rax, DWORD PTR [rbp-56]
+    mov rsi, rax
+    mov rdi, 3
+    call assert
+    movsxd rax, eax
+    mov DWORD PTR [rbp-52], 3
+    mov DWORD PTR [rbp-48], 4
+    mov DWORD PTR [rbp-44], 5
+    mov rax, 3
+    mov rsi, rax
+    mov rdi, 3
+    call assert
+    movsxd rax, eax
+    mov DWORD PTR [rbp-60], 3
+    lea rax, [rbp-60]
+    add rax, 4
+    mov QWORD PTR [rbp-48], rax
+    mov DWORD PTR [rax], 4
+    mov DWORD PTR [rbp-52], 5
+    mov rax, QWORD PTR [rbp-48]
+    movsxd rax, DWORD PTR [rax]
+    mov rsi, rax
+    mov rdi, 4
+    call assert
+    movsxd rax, eax
+    mov DWORD PTR [rbp-60], 3
+    mov DWORD PTR [rbp-56], 4
+    lea rax, [rbp-60]
+    add rax, 8
+    mov QWORD PTR [rbp-48], rax
+    mov DWORD PTR [rax], 5
+    mov rax, 5
+    mov rsi, rax
+    mov rdi, 5
+    call assert
+    movsxd rax, eax
+    lea rax, [rbp-72]
+    mov QWORD PTR [rbp-48], rax
+    mov DWORD PTR [rax], 0
+    movsxd rax, DWORD PTR [rbp-72]
+    mov rsi, rax
+    mov rdi, 0
+    call assert
+    movsxd rax, eax
+    lea rax, [rbp-72]
+    mov QWORD PTR [rbp-48], rax
+    mov DWORD PTR [rax+4], 1
+    movsxd rax, DWORD PTR [rbp-68]
+    mov rsi, rax
+    mov rdi, 1
+    call assert
+    movsxd rax, eax
+    lea rax, [rbp-72]
+    mov QWORD PTR [rbp-48], rax
+    mov DWORD PTR [rax+8], 2
+    movsxd rax, DWORD PTR [rbp-64]
+    mov rsi, rax
+    mov rdi, 2
+    call assert
+    movsxd rax, eax
+    lea rax, [rbp-72]
+    mov QWORD PTR [rbp-48], rax
+    mov DWORD PTR [rax+12], 3
+    movsxd rax, DWORD PTR [rbp-60]
+    mov rsi, rax
+    mov rdi, 3
+    call assert
+    movsxd rax, eax
+    lea rax, [rbp-72]
+    mov QWORD PTR [rbp-48], rax
+    mov DWORD PTR [rax+16], 4
+    movsxd rax, DWORD PTR [rbp-56]
+    mov rsi, rax
+    mov rdi, 4
+    call assert
+    movsxd rax, eax
+    lea rax, [rbp-72]
+    mov QWORD PTR [rbp-48], rax
+    mov DWORD PTR [rax+20], 5
+    movsxd rax, DWORD PTR [rbp-52]
+    mov rsi, rax
+    mov rdi, 5
+    call assert
+    movsxd rax, eax
+    mov DWORD PTR [rbp-52], 3
+    mov DWORD PTR [rbp-48], 4
+    mov DWORD PTR [rbp-44], 5
+    mov rax, 3
+    mov rsi, rax
+    mov rdi, 3
+    call assert
+    movsxd rax, eax
+    mov DWORD PTR [rbp-60], 3
+    lea rax, [rbp-60]
+    add rax, 4
+    mov QWORD PTR [rbp-48], rax
+    mov DWORD PTR [rax], 4
+    mov DWORD PTR [rbp-52], 5
+    mov rax, QWORD PTR [rbp-48]
+    movsxd rax, DWORD PTR [rax]
+    mov rsi, rax
+    mov rdi, 4
+    call assert
+    movsxd rax, eax
+    mov DWORD PTR [rbp-60], 3
+    mov DWORD PTR [rbp-56], 4
+    lea rax, [rbp-60]
+    add rax, 8
+    mov QWORD PTR [rbp-48], rax
+    mov DWORD PTR [rax], 5
+    mov rax, 5
+    mov rsi, rax
+    mov rdi, 5
+    call assert
+    movsxd rax, eax
+    mov DWORD PTR [rbp-60], 3
+    mov DWORD PTR [rbp-56], 4
+    lea rax, [rbp-60]
+    add rax, 8
+    mov QWORD PTR [rbp-48], rax
+    mov DWORD PTR [rax], 5
+    mov rax, 5
+    mov rsi, rax
+    mov rdi, 5
+    call assert
+    movsxd rax, eax
+    mov DWORD PTR [rbp-60], 3
+    mov DWORD PTR [rbp-56], 4
+    lea rax, [rbp-60]
+    add rax, 8
+    mov QWORD PTR [rbp-48], rax
+    mov DWORD PTR [rax], 5
+    mov rax, 5
+    mov rsi, rax
+    mov rdi, 5
+    call assert
+    movsxd rax, eax
+    lea rax, [rbp-60]
+    add rax, 4
+    mov QWORD PTR [rbp-48], rax
+    mov DWORD PTR [rax], 7
+    mov DWORD PTR [rbp-60], 1
+    mov rax, QWORD PTR [rbp-48]
+    movsxd rax, DWORD PTR [rax]
+    mov rsi, rax
+    mov rdi, 7
+    call assert
+    movsxd rax, eax
+    mov DWORD PTR [rbp-44], 0
+    lea rax, [rbp-51]
+    add rax, 1
+    mov QWORD PTR [rbp-48], rax
+    mov BYTE PTR [rax], 7
+    mov BYTE PTR [rbp-51], 1
+    mov BYTE PTR [rbp-49], -1
+    mov rax, QWORD PTR [rbp-48]
+    movsx rax, BYTE PTR [rax]
+    mov rsi, rax
+    mov rdi, 7
+    call assert
+    movsxd rax, eax
+    mov DWORD PTR [rbp-48], -1
+    mov DWORD PTR [rbp-44], 0
+    mov rax, -1
+    mov rsi, rax
+    mov rdi, -1
+    call assert
+    movsxd rax, eax
+    lea rax, [rbp-72]
+    mov QWORD PTR [rbp-48], rax
+    mov DWORD PTR [rax], 0
+    movsxd rax, DWORD PTR [rbp-72]
+    mov rsi, rax
+    mov rdi, 0
+    call assert
+    movsxd rax, eax
+    lea rax, [rbp-72]
+    mov QWORD PTR [rbp-48], rax
+    mov DWORD PTR [rax+4], 1
+    movsxd rax, DWORD PTR [rbp-68]
+    mov rsi, rax
+    mov rdi, 1
+    call assert
+    movsxd rax, eax
+    lea rax, [rbp-72]
+    mov QWORD PTR [rbp-48], rax
+    mov DWORD PTR [rax+8], 2
+    movsxd rax, DWORD PTR [rbp-64]
+    mov rsi, rax
+    mov rdi, 2
+    call assert
+    movsxd rax, eax
+    lea rax, [rbp-72]
+    mov QWORD PTR [rbp-48], rax
+    mov DWORD PTR [rax+12], 3
+    movsxd rax, DWORD PTR [rbp-60]
+    mov rsi, rax
+    mov rdi, 3
+    call assert
+    movsxd rax, eax
+    lea rax, [rbp-72]
+    mov QWORD PTR [rbp-48], rax
+    mov DWORD PTR [rax+16], 4
+    movsxd rax, DWORD PTR [rbp-56]
+    mov rsi, rax
+    mov rdi, 4
+    call assert
+    movsxd rax, eax
+    lea rax, [rbp-72]
+    mov QWORD PTR [rbp-48], rax
+    mov DWORD PTR [rax+20], 5
+    movsxd rax, DWORD PTR [rbp-52]
+    mov rsi, rax
+    mov rdi, 5
+    call assert
+    movsxd rax, eax
+    mov DWORD PTR [rbp-44], 1
+    mov rax, 1
+    shl rax, 2
+    mov rdi, rax
+    lea rax, [rbp-60]
+    add rax, rdi
+    mov r12, rax
+    mov DWORD PTR [r12], 5
+    mov rax, 1
+    shl rax, 2
+    mov rdi, rax
+    lea rax, [rbp-72]
+    add rax, rdi
+    mov QWORD PTR [rbp-48], rax
+    mov DWORD PTR [rax], 7
+    add DWORD PTR [r12], 7
+    movsxd rax, DWORD PTR [r12]
+    mov rsi, rax
+    mov rdi, 12
+    call assert
+    movsxd rax, eax
+    mov DWORD PTR [rbp-44], 2
+    mov rax, 2
+    shl rax, 2
+    mov rdi, rax
+    lea rax, [rbp-68]
+    add rax, rdi
+    mov QWORD PTR [rbp-56], rax
+    mov QWORD PTR [rbp-48], rax
+    mov rax, QWORD PTR [rbp-56]
+    mov DWORD PTR [rax], 5
+    mov DWORD PTR [rbp-44], 5
+    mov rax, 5
+    add rax, 5
+    mov rsi, rax
+    mov rdi, 10
+    call assert
+    movsxd rax, eax
+    xor eax, eax
+    mov DWORD PTR [rbp+rax*4-84], 3
+    xor eax, eax
+    add rax, 1
+    mov DWORD PTR [rbp-52], eax
+    movsxd rax, eax
+    shl rax, 2
+    mov rdi, rax
+    lea rax, [rbp-84]
+    add rax, rdi
+    mov QWORD PTR [rbp-48], rax
+    mov DWORD PTR [rax], 4
+    mov DWORD PTR [rbp-44], 4
+    movsxd rax, DWORD PTR [rbp-84]
+    mov DWORD PTR [rbp-44], eax
+    movsxd rax, eax
+    push rax
+    movsxd rax, DWORD PTR [rbp-44]
+    mov rdi, rax
+    mov rax, 4
+    imul rax, rax, 4
+    sub rax, rdi
+    pop rdi
+    add rax, rdi
+    add rax, -2
+    mov rsi, rax
+    mov rdi, 14
+    call assert
+    movsxd rax, eax
+    mov DWORD PTR [rbp-44], 1
+    mov DWORD PTR [rbp-44], 2
+    mov rax, 1
+    shl rax, 2
+    lea rax, [rax+rax*2]
+    mov rdi, rax
+    lea rax, [rbp-108]
+    add rax, rdi
+    mov QWORD PTR [rbp-48], rax
+    mov rax, 2
+    shl rax, 2
+    mov rdi, rax
+    mov rax, QWORD PTR [rbp-48]
+    lea rax, [rax]
+    add rax, rdi
+    mov QWORD PTR [rbp-56], rax
+    mov DWORD PTR [rax], 5
+    mov DWORD PTR [rbp-44], 5
+    mov rax, 5
+    lea rax, [rax+rax*4]
+    mov rsi, rax
+    mov rdi, 25
+    call assert
+    movsxd rax, eax
+    lea rax, [rbp-52]
+    mov r15, rax
+    lea rax, [rbp-52]
+    mov QWORD PTR [rbp-48], rax
+    mov DWORD PTR [r15], 1
+    mov rax, QWORD PTR [rbp-48]
+    mov DWORD PTR [rax], 2
+    movsxd rax, DWORD PTR [r15]
+    mov rsi, rax
+    mov rdi, 2
+    call assert
+    movsxd rax, eax
+    lea rax, [rbp-56]
+    mov QWORD PTR [rbp-48], rax
+    mov DWORD PTR [rbp-60], 5
+    mov rax, QWORD PTR [rbp-48]
+    mov DWORD PTR [rax], 7
+    mov rax, 5
+    add rax, 7
+    mov rsi, rax
+    mov rdi, 12
+    call assert
+    movsxd rax, eax
+    lea rax, [rbp-64]
+    mov QWORD PTR [rbp-48], rax
+    mov DWORD PTR [rbp-64], 1
+    lea rax, [rbp-64]
+    add rax, 4
+    mov QWORD PTR [rbp-56], rax
+    mov DWORD PTR [rax], 3
+    mov rax, QWORD PTR [rbp-48]
+    mov DWORD PTR [rax], 1
+    mov rax, QWORD PTR [rbp-56]
+    movsxd rax, DWORD PTR [rax]
+    add rax, 1
+    mov rsi, rax
+    mov rdi, 4
+    call assert
+    movsxd rax, eax
+    mov DWORD PTR [rbp-60], 1
+    lea rax, [rbp-60]
+    add rax, 4
+    mov QWORD PTR [rbp-48], rax
+    mov DWORD PTR [rax], 2
+    mov DWORD PTR [rbp-60], 3
+    mov rax, QWORD PTR [rbp-48]
+    movsxd rax, DWORD PTR [rax]
+    add rax, 3
+    mov rsi, rax
+    mov rdi, 5
+    call assert
+    movsxd rax, eax
+    mov DWORD PTR [rbp-52], 1
+    lea rax, [rbp-52]
+    mov QWORD PTR [rbp-48], rax
+    mov DWORD PTR [rax], 3
+    movsxd rax, DWORD PTR [rbp-52]
+    mov rsi, rax
+    mov rdi, 3
+    call assert
+    movsxd rax, eax
+    mov BYTE PTR [rbp-42], 44
+    mov rax, 44
+    mov rsi, rax
+    mov rdi, 44
+    call assert
+    movsxd rax, eax
+    lea rax, [rbp-64]
+    mov QWORD PTR [rbp-48], rax
+    mov QWORD PTR [rbp-56], rax
+    mov rax, QWORD PTR [rbp-48]
+    mov DWORD PTR [rax], 9
+    mov rax, 9
+    mov rsi, rax
+    mov rdi, 9
+    call assert
+    movsxd rax, eax
+    lea rax, [rbp-44]
+    mov rbx, rax
+    mov DWORD PTR [rbp-44], 10
+    dec DWORD PTR [rbx]
+    add DWORD PTR [rbx], -2
+    movsxd rax, DWORD PTR [rbp-44]
+    mov rsi, rax
+    mov rdi, 7
+    call assert
+    movsxd rax, eax
+    mov DWORD PTR [rbp-44], 1
+    mov rax, 1
+    shl rax, 2
+    mov rdi, rax
+    lea rax, [rbp-60]
+    add rax, rdi
+    mov QWORD PTR [rbp-48], rax
+    lea rax, [rax]
+    mov rdi, rax
+    mov rax, 2
+    add rax, 3
+    mov DWORD PTR [rdi], eax
+    mov rax, QWORD PTR [rbp-48]
+    movsxd rax, DWORD PTR [rax]
+    mov rsi, rax
+    mov rdi, 5
+    call assert
+    movsxd rax, eax
+    mov rax, 120
+    add rax, 10
+    mov BYTE PTR [rbp-110], al
+    movsx rax, al
+    mov rsi, rax
+    mov rdi, -126
+    call assert
+    movsxd rax, eax
+    mov DWORD PTR [rbp-48], 8
+    lea rax, [rbp-56]
+    mov r14, rax
+    add r14, 8
+    movsxd rax, DWORD PTR [r14]
+    mov rsi, rax
+    mov rdi, 8
+    call assert
+    movsxd rax, eax
+    mov DWORD PTR [rbp-56], 2
+    mov DWORD PTR [rbp-56], 6
+    mov rax, 2
+    shl rax, 2
+    mov rdi, rax
+    lea rax, [rbp-52]
+    add rax, rdi
+    mov r13, rax
+    mov rax, 6
+    add rax, 2
+    mov DWORD PTR [r13], eax
+    movsxd rax, eax
+    add rax, 6
+    add rax, 6
+    mov DWORD PTR [r13], eax
+    movsxd rax, eax
+    mov rsi, rax
+    mov rdi, 20
+    call assert
+    movsxd rax, eax
+    xor eax, eax
+.main.return:
+    lea rsp, [rbp-40]
+    pop r15
+    pop r14
+    pop r13
+    pop r12
+    pop rbx
+    pop rbp
+    ret
@@ -0,0 +1,91 @@
+.intel_syntax noprefix
+.data
+.global .L..7
+.L..7:
+    .byte 79
+    .byte 75
+    .byte 10
+    .byte 0
+.global .L..6
+.L..6:
+    .byte 97
+    .byte 98
+    .byte 99
+    .byte 0
+.global .L..5
+.L..5:
+    .byte 97
+    .byte 98
+    .byte 99
+    .byte 0
+.global .L..4
+.L..4:
+    .byte 97
+    .byte 98
+    .byte 99
+    .byte 0
+.global .L..3
+.L..3:
+    .byte 97
+    .byte 98
+    .byte 99
+    .byte 0
+.global .L..2
+.L..2:
+    .byte 97
+    .byte 98
+    .byte 99
+    .byte 0
+.global .L..1
+.L..1:
+    .byte 0
+.global .L..0
+.L..0:
+    .byte 0
+.global main
+.text
+main:
+    push rbp
+    mov rbp, rsp
+.main.entry:
+    movsx rax, BYTE PTR [rip+.L..0]
+    mov rsi, rax
+    mov rdi, 0
+    call assert
+    movsxd rax, eax
+    mov rdi, 1
+    mov rsi, 1
+    call assert
+    movsxd rax, eax
+    movsx rax, BYTE PTR [rip+.L..2]
+    mov rsi, rax
+    mov rdi, 97
+    call assert
+    movsxd rax, eax
+    movsx rax, BYTE PTR [rip+.L..3+1]
+    mov rsi, rax
+    mov rdi, 98
+    call assert
+    movsxd rax, eax
+    movsx rax, BYTE PTR [rip+.L..4+2]
+    mov rsi, rax
+    mov rdi, 99
+    call assert
+    movsxd rax, eax
+    movsx rax, BYTE PTR [rip+.L..5+3]
+    mov rsi, rax
+    mov rdi, 0
+    call assert
+    movsxd rax, eax
+    mov rdi, 4
+    mov rsi, 4
+    call assert
+    movsxd rax, eax
+    lea rdi, [rip+.L..7]
+    call printf
+    movsxd rax, eax
+    xor eax, eax
+.main.return:
+    mov rsp, rbp
+    pop rbp
+    ret
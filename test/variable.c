@@ -35,6 +35,8 @@ int main() {
     ASSERT(1, ({ g2[0]=0; g2[1]=1; g2[2]=2; g2[3]=3; g2[1]; }));
     ASSERT(2, ({ g2[0]=0; g2[1]=1; g2[2]=2; g2[3]=3; g2[2]; }));
     ASSERT(3, ({ g2[0]=0; g2[1]=1; g2[2]=2; g2[3]=3; g2[3]; }));
+    ASSERT(11, ({ int *p; p=&g1; g1=3; g1=g1+g1; *p=5; g1+g1+g1-g1+1; }));
+    ASSERT(13, ({ int *p; p=g2+1; g2[1]=4; g2[1]=g2[1]+g2[1]; *p=6; g2[1]+g2[1]+1; }));
     
     ASSERT(4, sizeof(g1));
     ASSERT(16, sizeof(g2));
@@ -43,12 +45,26 @@ int main() {
     ASSERT(1, ({ char x; x=1; char y; y=2; x; }));
     ASSERT(2, ({ char x; x=1; char y; y=2; y; }));
 
+    ASSERT(44, ({ char x; x=300; x; }));
+    ASSERT(-1, ({ char x[2]; x[1]=255; x[1]; }));
+    ASSERT(7, ({ int x; x=5; x=7; x; }));
+    ASSERT(1, ({ int x; x=5; 2<x; }));
+    ASSERT(0, ({ int x; x=5; 7<x; }));
+
     ASSERT(1, ({ char x; sizeof(x); }));
     ASSERT(10, ({ char x[10]; sizeof(x); }));
+    ASSERT(24, ({ int x[2*3]; sizeof(x); }));
+    ASSERT(12, ({ char x[(1+2)*4]; sizeof(x); }));
+    ASSERT(16, ({ int x[sizeof(g1)]; sizeof(x); }));
+    ASSERT(3, ({ int x[2][3]; x[1][2]=3; *(*x+5); }));
 
     ASSERT(2, ({ int x; x=2; { int x; x=3; } x; }));
     ASSERT(2, ({ int x; x=2; { int x; x=3; } int y; y=4; x; }));
     ASSERT(3, ({ int x; x=2; { x=3; } x; }));
+    ASSERT(13, ({ int r; r=0; { int a[8]; a[7]=5; r=r+a[7]; } { int b[8]; b[0]=8; r=r+b[0]; } r; }));
+    ASSERT(11, ({ int r; int *p; { int a[4]; a[1]=4; p=a; r=p[1]; } { int b[4]; b[1]=7; r=r+b[1]; } r; }));
+    ASSERT(48, ({ int k; int t; t=0; for (k=0; k<3; k=k+1) { { int a[2]; a[0]=k; t=t+a[0]; } { int b[2]; b[1]=k*k; t=t+b[1]*k; } } t*4; }));
+    ASSERT(25, ({ int x; int y; int k; x=1; y=0; for (k=0; k<3; k=k+1) { y=y+x; x=x+2; } { int z; z=y*2; y=z; } y+x+k-k; }));
 
     
     printf("OK\n");
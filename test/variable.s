@@ -0,0 +1,515 @@
+.intel_syntax noprefix
+.data
+.global .L..0
+.L..0:
+    .byte 79
+    .byte 75
+    .byte 10
+    .byte 0
+.data
+.global g1
+g1:
+.zero 4
+.data
+.global g2
+g2:
+.zero 16
+.global main
+.text
+main:
+    push rbp
+    mov rbp, rsp
+    push rbx
+    push r12
+    push r13
+    push r14
+    push r15
+    sub rsp, 56
+    mov DWORD PTR [rbp-44], 3
+    mov rax, 3
+    mov rsi, rax
+    mov rdi, 3
+    call assert
+    movsxd rax, eax
+    mov rax, 2
+    mov DWORD PTR [rbp-44], eax
+    mov rsi, rax
+    mov rdi, 2
+    call assert
+    movsxd rax, eax
+    mov rax, 3
+    mov DWORD PTR [rbp-44], eax
+    mov rsi, rax
+    mov rdi, 3
+    call assert
+    movsxd rax, eax
+    mov rax, 3
+    mov DWORD PTR [rbp-44], eax
+    mov rsi, rax
+    mov rdi, 3
+    call assert
+    movsxd rax, eax
+    mov DWORD PTR [rbp-44], 3
+    mov DWORD PTR [rbp-44], 5
+    mov rax, 3
+    add rax, 5
+    mov rsi, rax
+    mov rdi, 8
+    call assert
+    movsxd rax, eax
+    mov DWORD PTR [rbp-44], 3
+    mov rax, 3
+    mov rsi, rax
+    mov rdi, 3
+    call assert
+    movsxd rax, eax
+    mov DWORD PTR [rbp-44], 3
+    mov DWORD PTR [rbp-44], 5
+    mov rax, 3
+    add rax, 5
+    mov rsi, rax
+    mov rdi, 8
+    call assert
+    movsxd rax, eax
+    mov rax, 3
+    mov DWORD PTR [rbp-48], eax
+    mov DWORD PTR [rbp-44], eax
+    movsxd rax, DWORD PTR [rbp-48]
+    mov rdi, rax
+    movsxd rax, DWORD PTR [rbp-44]
+    add rax, rdi
+    mov rsi, rax
+    mov rdi, 6
+    call assert
+    movsxd rax, eax
+    mov DWORD PTR [rbp-44], 3
+    mov rax, 3
+    mov rsi, rax
+    mov rdi, 3
+    call assert
+    movsxd rax, eax
+    mov DWORD PTR [rbp-44], 3
+    mov DWORD PTR [rbp-44], 5
+    mov rax, 3
+    add rax, 5
+    mov rsi, rax
+    mov rdi, 8
+    call assert
+    movsxd rax, eax
+    mov rax, 4
+    mov rsi, rax
+    mov rdi, 4
+    call assert
+    movsxd rax, eax
+    mov rax, 4
+    mov rsi, rax
+    mov rdi, 4
+    call assert
+    movsxd rax, eax
+    mov rax, 8
+    mov rsi, rax
+    mov rdi, 8
+    call assert
+    movsxd rax, eax
+    mov rax, 16
+    mov rsi, rax
+    mov rdi, 16
+    call assert
+    movsxd rax, eax
+    mov rax, 48
+    mov rsi, rax
+    mov rdi, 48
+    call assert
+    movsxd rax, eax
+    mov rax, 16
+    mov rsi, rax
+    mov rdi, 16
+    call assert
+    movsxd rax, eax
+    mov rax, 4
+    mov rsi, rax
+    mov rdi, 4
+    call assert
+    movsxd rax, eax
+    mov rax, 5
+    mov rsi, rax
+    mov rdi, 5
+    call assert
+    movsxd rax, eax
+    mov rax, 5
+    mov rsi, rax
+    mov rdi, 5
+    call assert
+    movsxd rax, eax
+    mov rax, 4
+    mov rsi, rax
+    mov rdi, 4
+    call assert
+    movsxd rax, eax
+    mov DWORD PTR [rbp-44], 1
+    mov rax, 4
+    mov rsi, rax
+    mov rdi, 4
+    call assert
+    movsxd rax, eax
+    mov DWORD PTR [rbp-44], 1
+    mov rax, 1
+    mov rsi, rax
+    mov rdi, 1
+    call assert
+    movsxd rax, eax
+    mov rdi, 0
+    movsxd rsi, DWORD PTR [rip+g1]
+    call assert
+    movsxd rax, eax
+    mov DWORD PTR [rip+g1], 3
+    mov rax, 3
+    mov rsi, rax
+    mov rdi, 3
+    call assert
+    movsxd rax, eax
+    mov DWORD PTR [rip+g2], 0
+    mov DWORD PTR [rip+g2+4], 1
+    mov DWORD PTR [rip+g2+8], 2
+    mov DWORD PTR [rip+g2+12], 3
+    xor eax, eax
+    mov rsi, rax
+    mov rdi, 0
+    call assert
+    movsxd rax, eax
+    mov DWORD PTR [rip+g2], 0
+    lea rax, [rip+g2]
+    add rax, 4
+    mov QWORD PTR [rbp-48], rax
+    mov DWORD PTR [rax], 1
+    mov DWORD PTR [rip+g2+8], 2
+    mov DWORD PTR [rip+g2+12], 3
+    mov rax, QWORD PTR [rbp-48]
+    movsxd rax, DWORD PTR [rax]
+    mov rsi, rax
+    mov rdi, 1
+    call assert
+    movsxd rax, eax
+    mov DWORD PTR [rip+g2], 0
+    mov DWORD PTR [rip+g2+4], 1
+    lea rax, [rip+g2]
+    add rax, 8
+    mov QWORD PTR [rbp-48], rax
+    mov DWORD PTR [rax], 2
+    mov DWORD PTR [rip+g2+12], 3
+    mov rax, QWORD PTR [rbp-48]
+    movsxd rax, DWORD PTR [rax]
+    mov rsi, rax
+    mov rdi, 2
+    call assert
+    movsxd rax, eax
+    mov DWORD PTR [rip+g2], 0
+    mov DWORD PTR [rip+g2+4], 1
+    mov DWORD PTR [rip+g2+8], 2
+    lea rax, [rip+g2]
+    add rax, 12
+    mov QWORD PTR [rbp-48], rax
+    mov DWORD PTR [rax], 3
+    mov rax, 3
+    mov rsi, rax
+    mov rdi, 3
+    call assert
+    movsxd rax, eax
+    lea rax, [rip+g1]
+    mov QWORD PTR [rbp-48], rax
+    mov DWORD PTR [rbp-52], 3
+    mov rax, 3
+    add rax, 3
+    mov DWORD PTR [rip+g1], eax
+    mov rax, QWORD PTR [rbp-48]
+    mov DWORD PTR [rax], 5
+    movsxd rax, DWORD PTR [rip+g1]
+    movsxd r14, eax
+    mov rax, r14
+    push rax
+    mov rax, r14
+    push rax
+    mov rax, r14
+    mov rdi, rax
+    mov rax, r14
+    add rax, rdi
+    pop rdi
+    add rax, rdi
+    pop rdi
+    sub rax, rdi
+    add rax, 1
+    mov rsi, rax
+    mov rdi, 11
+    call assert
+    movsxd rax, eax
+    lea rax, [rip+g2]
+    add rax, 4
+    mov QWORD PTR [rbp-56], rax
+    mov QWORD PTR [rbp-48], rax
+    mov DWORD PTR [rbp-44], 4
+    mov rax, QWORD PTR [rbp-56]
+    mov DWORD PTR [rax], 6
+    mov DWORD PTR [rbp-44], 6
+    mov rax, 6
+    add rax, 6
+    add rax, 1
+    mov rsi, rax
+    mov rdi, 13
+    call assert
+    movsxd rax, eax
+    mov rdi, 4
+    mov rsi, 4
+    call assert
+    movsxd rax, eax
+    mov rdi, 16
+    mov rsi, 16
+    call assert
+    movsxd rax, eax
+    mov BYTE PTR [rbp-41], 1
+    mov rax, 1
+    mov rsi, rax
+    mov rdi, 1
+    call assert
+    movsxd rax, eax
+    mov BYTE PTR [rbp-41], 1
+    mov BYTE PTR [rbp-41], 2
+    mov rax, 1
+    mov rsi, rax
+    mov rdi, 1
+    call assert
+    movsxd rax, eax
+    mov BYTE PTR [rbp-41], 1
+    mov BYTE PTR [rbp-41], 2
+    mov rax, 2
+    mov rsi, rax
+    mov rdi, 2
+    call assert
+    movsxd rax, eax
+    mov BYTE PTR [rbp-41], 44
+    mov rax, 44
+    mov rsi, rax
+    mov rdi, 44
+    call assert
+    movsxd rax, eax
+    lea rax, [rbp-50]
+    add rax, 1
+    mov QWORD PTR [rbp-48], rax
+    mov BYTE PTR [rax], -1
+    mov rax, -1
+    mov rsi, rax
+    mov rdi, -1
+    call assert
+    movsxd rax, eax
+    mov DWORD PTR [rbp-44], 7
+    mov rax, 7
+    mov rsi, rax
+    mov rdi, 7
+    call assert
+    movsxd rax, eax
+    mov DWORD PTR [rbp-44], 5
+    mov rax, 2
+    cmp rax, 5
+    setl al
+    movzb rax, al
+    mov rsi, rax
+    mov rdi, 1
+    call assert
+    movsxd rax, eax
+    mov DWORD PTR [rbp-44], 5
+    mov rax, 7
+    cmp rax, 5
+    setl al
+    movzb rax, al
+    mov rsi, rax
+    mov rdi, 0
+    call assert
+    movsxd rax, eax
+    mov rax, 1
+    mov rsi, rax
+    mov rdi, 1
+    call assert
+    movsxd rax, eax
+    mov rax, 10
+    mov rsi, rax
+    mov rdi, 10
+    call assert
+    movsxd rax, eax
+    mov rax, 24
+    mov rsi, rax
+    mov rdi, 24
+    call assert
+    movsxd rax, eax
+    mov rax, 12
+    mov rsi, rax
+    mov rdi, 12
+    call assert
+    movsxd rax, eax
+    mov rax, 16
+    mov rsi, rax
+    mov rdi, 16
+    call assert
+    movsxd rax, eax
+    lea rax, [rbp-72]
+    add rax, 20
+    mov QWORD PTR [rbp-48], rax
+    mov DWORD PTR [rax], 3
+    mov rax, 3
+    mov rsi, rax
+    mov rdi, 3
+    call assert
+    movsxd rax, eax
+    mov DWORD PTR [rbp-44], 2
+    mov DWORD PTR [rbp-44], 3
+    mov rax, 2
+    mov rsi, rax
+    mov rdi, 2
+    call assert
+    movsxd rax, eax
+    mov DWORD PTR [rbp-44], 2
+    mov DWORD PTR [rbp-44], 3
+    mov DWORD PTR [rbp-44], 4
+    mov rax, 2
+    mov rsi, rax
+    mov rdi, 2
+    call assert
+    movsxd rax, eax
+    mov DWORD PTR [rbp-44], 3
+    mov rax, 3
+    mov rsi, rax
+    mov rdi, 3
+    call assert
+    movsxd rax, eax
+    lea rax, [rbp-80]
+    add rax, 28
+    mov QWORD PTR [rbp-48], rax
+    mov DWORD PTR [rax], 5
+    xor eax, eax
+    add rax, 5
+    movsxd r15, eax
+    mov DWORD PTR [rbp-72], 8
+    mov rax, r15
+    add rax, 8
+    movsxd r15, eax
+    mov rax, r15
+    mov rsi, rax
+    mov rdi, 13
+    call assert
+    movsxd rax, eax
+    mov DWORD PTR [rbp-64], 4
+    lea rax, [rbp-68]
+    mov QWORD PTR [rbp-48], rax
+    movsxd rax, DWORD PTR [rax+4]
+    mov DWORD PTR [rbp-52], eax
+    lea rax, [rbp-68]
+    add rax, 4
+    mov QWORD PTR [rbp-48], rax
+    mov DWORD PTR [rax], 7
+    add DWORD PTR [rbp-52], 7
+    movsxd rax, DWORD PTR [rbp-52]
+    mov rsi, rax
+    mov rdi, 11
+    call assert
+    movsxd rax, eax
+    mov rbx, 0
+    mov DWORD PTR [rbp-88], 0
+    mov rax, rbx
+    add rax, 0
+    movsxd rbx, eax
+    mov DWORD PTR [rbp-92], 0
+    mov rax, rbx
+    movsxd rbx, eax
+    mov DWORD PTR [rbp-88], 1
+    mov rax, rbx
+    add rax, 1
+    movsxd rbx, eax
+    lea rax, [rbp-96]
+    add rax, 4
+    mov QWORD PTR [rbp-48], rax
+    mov DWORD PTR [rax], 1
+    mov rax, rbx
+    add rax, 1
+    movsxd rbx, eax
+    mov DWORD PTR [rbp-88], 2
+    mov rax, rbx
+    add rax, 2
+    movsxd rbx, eax
+    lea rax, [rbp-96]
+    add rax, 4
+    mov QWORD PTR [rbp-48], rax
+    mov DWORD PTR [rax], 4
+    mov rax, 4
+    shl rax, 1
+    mov rdi, rax
+    mov rax, rbx
+    add rax, rdi
+    movsxd rbx, eax
+    mov rax, 3
+    mov DWORD PTR [rbp-44], eax
+    mov rax, rbx
+    shl rax, 2
+    mov rsi, rax
+    mov rdi, 48
+    call assert
+    movsxd rax, eax
+    mov r12, 1
+    mov r13, 0
+    mov rax, r12
+    mov rdi, rax
+    mov rax, r13
+    add rax, rdi
+    movsxd r13, eax
+    mov rax, r12
+    add rax, 2
+    movsxd r12, eax
+    mov rax, r12
+    mov rdi, rax
+    mov rax, r13
+    add rax, rdi
+    movsxd r13, eax
+    mov rax, r12
+    add rax, 2
+    movsxd r12, eax
+    mov rax, r12
+    mov rdi, rax
+    mov rax, r13
+    add rax, rdi
+    movsxd r13, eax
+    mov rax, r12
+    add rax, 2
+    movsxd r12, eax
+    mov rax, 3
+    mov DWORD PTR [rbp-44], eax
+    mov rax, r13
+    shl rax, 1
+    mov DWORD PTR [rbp-48], eax
+    movsxd rax, eax
+    movsxd r13, eax
+    movsxd rax, DWORD PTR [rbp-44]
+    push rax
+    movsxd rax, DWORD PTR [rbp-44]
+    push rax
+    mov rax, r12
+    mov rdi, rax
+    movsxd rax, DWORD PTR [rbp-48]
+    add rax, rdi
+    pop rdi
+    add rax, rdi
+    pop rdi
+    sub rax, rdi
+    mov rsi, rax
+    mov rdi, 25
+    call assert
+    movsxd rax, eax
+    lea rdi, [rip+.L..0]
+    call printf
+    movsxd rax, eax
+    xor eax, eax
+.main.return:
+    lea rsp, [rbp-40]
+    pop r15
+    pop r14
+    pop r13
+    pop r12
+    pop rbx
+    pop rbp
+    ret
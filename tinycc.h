@@ -40,6 +40,11 @@ typedef enum {
     TK_TYPE,        // 型
     TK_SIZEOF,      // sizeof演算子
     TK_STR,     // string literal
+    TK_STATIC,      // static
+    TK_SWITCH,      // switch
+    TK_CASE,        // case
+    TK_DEFAULT,     // default
+    TK_BREAK,       // break
 } TokenKind;
 
 typedef struct Token Token;
@@ -86,6 +91,14 @@ struct Type {
 
 
 typedef struct Var Var;
+typedef struct Node Node;
+
+// ブロックの文の範囲(そこで宣言したローカル変数の有効範囲)
+typedef struct Extent Extent;
+struct Extent {
+    Node *first;    // 最初の文
+    Node *last;     // 最後の文
+};
 
 struct Var {
     char *str;      // 変数名
@@ -99,6 +112,13 @@ struct Var {
     int scope;
     char *name;
     int defined;
+    bool escaped;   // アドレスが取られているかどうか
+    int reg;        // 割り当てられたレジスタの番号(0は割り当てなし)
+    bool is_static; // staticなグローバル変数かどうか
+    bool referenced;    // 関数から参照されるかどうか(dce.c)
+    bool dead;      // 参照されないので出力しないかどうか(dce.c)
+    int index;      // 関数のvarsの中の位置(dce.c)
+    Extent *extent; // 宣言したブロック(仮引数、一時変数ではNULL)
 };
 
 typedef struct Scope Scope;
@@ -149,16 +169,30 @@ typedef enum {
     ND_ADDR,    // 単項&
     ND_DEREF,   // 単項*
     ND_STR, // string literal
+    ND_NEG,     // 単項-
+    ND_SHL,     // << (右辺は定数)
+    ND_MOD,     // %
+    ND_VLOOP,   // ベクトル化したループ(vector.c)
+    ND_SWITCH,  // switch
+    ND_CASE,    // case, defaultラベル(bodyはラベルの付いた文)
+    ND_BREAK,   // break
+    ND_SELECT,  // 条件による値の選択(leftが条件、rightがND_ARMS)(ifconv.c)
+    ND_ARMS,    // ND_SELECTの値(leftが条件が真、rightが偽のときの値)
 } NodeKind;
 
-typedef struct Node Node;
+// ND_VLOOPの種類(Node.iregに置く)
+enum {
+    VEC_MAP,    // X[i] = E (bodyは代入)
+    VEC_REDUCE, // s = s + E (bodyはE, rightはs)
+    VEC_SCAN,   // if (E) return ... (bodyはE)
+};
 
 // 抽象構文木のノードの型
 struct Node {
     NodeKind kind;  // ノードの型
     Node *left;     // 左辺
     Node *right;    // 右辺
-    int val;        // kindがND_NUMのときのみ扱う
+    int val;        // kindがND_NUMのときの値(ND_VLOOPでは要素の大きさ、ND_FORでは分かっていれば反復回数の上限)
     int offset;     // kindがND_IDENTのときのみ扱う
     char *name;     // kindがND_FUNCTIONのときの識別子の名前
     int len;        // kindがND_FUNCTIONのときの識別子の名前の長さ
@@ -177,6 +211,86 @@ struct Node {
     Node **params; // 関数呼び出しの仮引数
     int nparams;    // 関数呼び出しの引数の数
     Type *type;     // 型
+    Var *var;       // kindがND_LVAR, ND_GVARのときの変数
+    bool is_default;    // ND_CASEがdefaultラベルかどうか
+    int label;      // ND_CASEのラベルの番号(コード生成時)
+};
+
+// 三番地コードの命令の種類(ir.c)
+typedef enum {
+    IR_IMM,     // 定数(valが値。どのブロックにも属さず、使う箇所で即値にする)
+    IR_PARAM,   // 仮引数(valが番号)
+    IR_PHI,     // φ関数(opsはブロックのpredsと同じ順)
+    IR_ADD,     // +
+    IR_SUB,     // -
+    IR_MUL,     // *
+    IR_DIV,     // / (typeがint, charなら32ビットの除算)
+    IR_MOD,     // %
+    IR_SHL,     // << (ops[1]は定数)
+    IR_NEG,     // 単項-
+    IR_EQ,      // ==
+    IR_NE,      // !=
+    IR_GT,      // >
+    IR_GE,      // >=
+    IR_LT,      // <
+    IR_LE,      // <=
+    IR_EXT,     // typeの大きさからの符号拡張(int, charの変数への代入)
+    IR_LEA,     // メモリオペランドのアドレス
+    IR_LOAD,    // メモリオペランドからtypeの大きさの読み込み
+    IR_STORE,   // メモリオペランドへops[2]の書き込み
+    IR_RMW,     // メモリオペランドをops[2]だけ直接増減する(cmpがIR_ADDかIR_SUB)
+    IR_CALL,    // 関数呼び出し(opsが引数)
+    IR_SELECT,  // 比較cmp(ops[0], ops[1])が真ならops[2], 偽ならops[3]
+    IR_BR,      // 比較cmp(ops[0], ops[1])が真ならsuccs[0], 偽ならsuccs[1]へ分岐
+    IR_JMP,     // succs[0]へ分岐
+    IR_SWITCH,  // ops[0]の値でcasesのラベルのsuccsへ分岐(最後のsuccsがdefault)
+    IR_RET,     // ops[0]を返す
+    IR_TAILCALL,// 末尾呼び出し(opsが引数)
+} IROp;
+
+typedef struct IR IR;
+typedef struct Block Block;
+
+// 三番地コードの命令。値を定義する命令は命令そのものが値を表す(SSA形式)。
+// メモリオペランドは [var|sym + ops[0] + ops[1]*scale + disp] で、ops[0], ops[1]はNULLでもよい。
+struct IR {
+    IROp op;
+    int id;         // 値の通し番号
+    IR **ops;       // 被演算子
+    int nops;
+    int val;        // IR_IMMの値、IR_PARAMの番号
+    IROp cmp;       // IR_BR, IR_SELECTの比較の種類、IR_RMWの演算
+    Type *type;     // IR_DIV, IR_MOD, IR_EXT, IR_LOAD, IR_STORE, IR_RMWの型
+    Var *var;       // メモリオペランドのフレーム上の変数(IR_PHIでは値を表す変数)
+    char *sym;      // メモリオペランドのシンボル(グローバル変数、文字列リテラル)
+    int scale;
+    int disp;
+    char *name;     // 呼び出す関数の名前
+    Node **cases;   // IR_SWITCHのcaseラベル(defaultを除く)
+    int ncases;
+    Block *block;   // 属するブロック
+    IR *prev;       // ブロック内の命令列
+    IR *next;
+    IR *replaced;   // 自明なφ関数を置き換えた値(SSA構築中)
+    int pos;        // 命令の位置(isel.c)
+    int reg;        // 割り当てたレジスタの番号(0は割り当てなし)(isel.c)
+    int slot;       // 割り当てがなければスタック上の位置(isel.c)
+};
+
+// 基本ブロック
+struct Block {
+    int id;         // 出力順の番号
+    char *label;
+    IR *first;      // 命令列(φ関数が先、最後が分岐)
+    IR *last;
+    Block **preds;
+    int npreds;
+    Block **succs;
+    int nsuccs;
+    bool sealed;    // 先行ブロックが確定したかどうか(SSA構築中)
+    IR **defs;      // 変数ごとのブロック末尾での値(SSA構築中)
+    IR **incomplete;    // 先行ブロックの確定を待つφ関数(SSA構築中)
+    int nincomplete;
 };
 
 typedef struct Function Function;
@@ -192,6 +306,15 @@ struct Function {
     Var *globals;
     Token *literals;
     Var **params;
+    Var **vars;     // 仮引数を含むローカル変数の一覧
+    int nvars;
+    int inline_state;   // インライン展開の処理状態(0: 未処理, 1: 処理中, 2: 処理済み)
+    bool is_static;     // staticな関数かどうか
+    bool referenced;    // 外部から呼ばれうる関数から辿れるかどうか(dce.c)
+    bool dead;          // 参照されないので出力しないかどうか(dce.c)
+    Block **blocks;     // SSA形式の基本ブロック(出力順、先頭が入口)。変換していなければNULL(ir.c)
+    int nblocks;
+    int nvalues;        // 値の通し番号の数
 };
 
 // プログラム全体を表す
@@ -246,11 +369,16 @@ extern Node *stmt_lst(Token **rest, Token *tok);
 extern Node *select_stmt(Token **rest);
 extern Node *iter_stmt(Token **rest);
 extern Node *jump_stmt(Token **rest);
+extern Node *labeled_stmt(Token **rest);
+extern Extent *cur_extent;
 
 //expr.c
 extern Node *new_node_binary(NodeKind kind,Type *ty, Node *lhs, Node *rhs);
 extern Node *new_node_num(int val);
 extern Node *new_node_var(Var *var);
+extern Node *new_node_expr(Node *expr_stmt);
+extern Node *new_node_block(Node *list);
+extern Node *new_node_null(void);
 
 extern Node *expr(Token **rest);
 extern Node *assign(Token **rest);
@@ -262,6 +390,12 @@ extern Node *unary(Token **rest);
 extern Node *postfix(Token **rest);
 extern Node *primary(Token **rest);
 extern Node *arg_list(Token **rest, int depth);
+extern int const_expr(Token **rest);
+
+// fold.c
+extern Node *fold(Node *node);
+extern bool const_value(Node *node, int *val);
+extern int ilog2(int n);
 
 // type.c
 extern Type *ptr(Type *ty);
@@ -285,8 +419,125 @@ struct List {
 extern List *append(void *x, List *list);
 extern void *ltov(List **list);
 extern int list_length(List *list);
+// 最適化パス
+// opt.c
+typedef struct Pass Pass;
+struct Pass {
+    char *name;     // -f<name>, -fno-<name>で指定する名前
+    int level;      // 既定で有効になる最小の最適化レベル
+    void (*run)(Function *fn);  // 関数ごとの処理(NULLのときはパーサーやコード生成が参照するだけ)
+    bool enabled;   // 有効かどうか
+    int forced;     // -f<name>なら1, -fno-<name>なら-1
+    bool report;    // -f<name>-reportが指定されたかどうか
+    double time;    // 処理時間(秒)
+};
+enum {
+    P_SIMPLIFY,     // 空文の除去とブロックの平坦化
+    P_FOLD,         // 定数畳み込みと代数的簡約(構文解析時)
+    P_CMPBR,        // 比較と条件分岐の融合(コード生成時)
+    P_ROTATE,       // ループのdo-while形式への回転(コード生成時)
+    P_SWITCH,       // switch文のジャンプテーブルと二分探索による分岐(コード生成時)
+    P_EVAL,         // 定数引数の純粋な関数の呼び出しのコンパイル時評価
+    P_INLINE,       // 小さな関数の呼び出し箇所への展開
+    P_VECTORIZE,    // 数え上げループのSSE2命令による自動ベクトル化
+    P_UNROLL,       // 数え上げループの展開
+    P_IFCONV,       // 小さなif文の条件付き転送(cmov, setcc)への置き換え
+    P_CSE,          // 基本ブロック内の共通部分式の除去
+    P_LICM,         // ループ不変式のループ外への移動
+    P_IVOPTS,       // 誘導変数によるアドレス計算のポインタの加算への置き換え
+    P_FORWARD,      // 基本ブロック内の代入した値のロードへの転送と無駄なストアの除去
+    P_DCE,          // 到達しない文、無駄な代入、参照されないstaticな関数と変数の除去
+    P_SSA,          // SSA形式の三番地コードへの変換と、それからの命令選択とレジスタ割り当て
+    P_MEM2REG,      // アドレスの取られないスカラー変数のレジスタへの割り当て
+    P_PEEPHOLE,     // 出力する命令列の覗き穴最適化
+    P_ADDRMODE,     // アドレッシングモードを使った命令選択(コード生成時)
+    P_IMM,          // 定数オペランドの即値化(コード生成時)
+    P_RMW,          // 左辺値を読んで書き戻す代入のメモリを直接書き換える命令への置き換え(コード生成時)
+    P_DIVCONST,     // 定数による除算・剰余の乗算とシフトへの置き換え(コード生成時)
+    P_TAILCALL,     // 末尾呼び出しのジャンプへの置き換え(コード生成時)
+    P_STACKREUSE,   // 生存区間の重ならない変数のスタック領域の共有(コード生成時)
+    P_LEAFFRAME,    // スタック上に変数のない葉関数のフレームの省略(コード生成時)
+    P_ARGREGS,      // 引数の引数レジスタへの直接の計算(コード生成時)
+    P_OMITFP,       // フレームポインタを使わないrsp相対の変数参照(コード生成時)
+    NPASSES,
+};
+#define optimizing(p) (passes[p].enabled)
+extern Pass passes[];
+extern int opt_level;
+extern int align_loops;
+extern int unroll_factor;
+extern int if_conv_budget;
+extern bool parse_opt(char *arg);
+extern void opt_init(void);
+extern void optimize(Code *prog);
+extern bool is_pure(Node *node);
+extern void opt_report(int pass, char *fmt, ...);
+extern void walk(Node *node, int depth, void (*fn)(Node *, int, void *), void *arg);
+extern bool same_node(Node *a, Node *b);
+extern bool is_scalar(Type *ty);
+extern bool is_cmp(Node *node);
+extern void mark_escaped(Function *fn);
+extern Function *find_function(char *name);
+extern bool is_leaf(Function *fn);
+extern bool has_call(Node *node);
+extern bool has_case(Node *node);
+extern Var *new_temp(Function *fn, char *prefix, Type *ty);
+
+// eval.c
+extern void eval_pure_calls(Function *fn);
+
+// inline.c
+extern void inline_func(Function *fn);
+
+// cse.c
+extern void cse(Function *fn);
+
+// loop.c
+extern void for_each_loop(Function *fn, void (*visit)(Function *, Node **, int *));
+extern void licm(Function *fn);
+extern void ivopts(Function *fn);
+extern void unroll_loops(Function *fn);
+
+// ifconv.c
+extern void if_convert(Function *fn);
+
+// forward.c
+extern void store_forward(Function *fn);
+
+// dce.c
+extern void dce(Function *fn);
+extern void dce_unit(Code *prog);
+
+// vector.c
+extern void vectorize(Function *fn);
+
+// ir.c
+extern void build_ssa(Function *fn);
+
+// isel.c
+extern void gen_ir(Function *fn);
+
+// stack.c
+extern void live_ranges(Function *fn, int *start, int *end);
+
+// regalloc.c
+#define NCALLEE_REGS 5  // 割り当てに使う callee-saved レジスタの数
+#define NVAR_REGS 11    // 割り当てに使うレジスタの数(NCALLEE_REGSより後は葉関数だけで使うcaller-saved)
+extern void mem2reg(Function *fn);
+
+// peep.c
+extern void emit(char *fmt, ...);
+extern void flush(void);
+extern void peephole_report(void);
+
 // アセンブリの出力
 // codegen.c
+extern int count(void);
+extern void parallel_move(char **dst, char **src, int n);
+extern void gen_quotient(int d, char *tmp);
+extern int switch_cases(Node *body, Node ***cases, Node **dflt);
+extern void gen_case_dispatch(Function *fn, Node **cases, int n, char *dflt_label);
+extern int align_of(Type *type);
 void codegen(Code *prog);
 
 // エラーメッセージ(汎用)出力
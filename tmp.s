@@ -0,0 +1,13 @@
+.intel_syntax noprefix
+.global main
+.text
+main:
+    push rbp
+    mov rbp, rsp
+    sub rsp, 16
+.main.entry:
+    mov rax, 3
+.main.return:
+    mov rsp, rbp
+    pop rbp
+    ret
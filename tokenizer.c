@@ -107,7 +107,7 @@ int is_alnum(char c) {
 //新しいトークンを作成してcurに繋げる
 Token *new_token(TokenKind kind, Token *cur, char *str, int len){
     Token *tok = calloc(1, sizeof(Token));
-    char *q = calloc(1, sizeof(char));
+    char *q = calloc(len + 1, sizeof(char));
     strncpy(q, str, len);
     tok->str = q;
     tok->kind = kind;
@@ -188,7 +188,7 @@ static Token *tokenize(char *filename, char *p){
             p += 2;
             continue;
         }
-        if (strchr("+-*/()><=;{},&[]", *p)) {
+        if (strchr("+-*/%()><=;{},&[]:", *p)) {
             cur = new_token(TK_RESERVED, cur, p, 1);
             p++;
             continue;
@@ -226,11 +226,36 @@ static Token *tokenize(char *filename, char *p){
             p += 5;
             continue;
         }
+        if (strncmp(p, "switch", 6) == 0 && !is_alnum(p[6])) {
+            cur = new_token(TK_SWITCH, cur, p, 6);
+            p += 6;
+            continue;
+        }
+        if (strncmp(p, "case", 4) == 0 && !is_alnum(p[4])) {
+            cur = new_token(TK_CASE, cur, p, 4);
+            p += 4;
+            continue;
+        }
+        if (strncmp(p, "default", 7) == 0 && !is_alnum(p[7])) {
+            cur = new_token(TK_DEFAULT, cur, p, 7);
+            p += 7;
+            continue;
+        }
+        if (strncmp(p, "break", 5) == 0 && !is_alnum(p[5])) {
+            cur = new_token(TK_BREAK, cur, p, 5);
+            p += 5;
+            continue;
+        }
         if (strncmp(p, "int", 3) == 0 && !is_alnum(p[3])) {
             cur = new_token(TK_TYPE, cur, p, 3);
             p += 3;
             continue;
         }
+        if (strncmp(p, "static", 6) == 0 && !is_alnum(p[6])) {
+            cur = new_token(TK_STATIC, cur, p, 6);
+            p += 6;
+            continue;
+        }
         if (strncmp(p, "sizeof", 6) == 0 && !is_alnum(p[6])) {
             cur = new_token(TK_SIZEOF, cur, p, 6);
             p += 6;
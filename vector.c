@@ -0,0 +1,454 @@
+//
+//  vector.c
+//  tinycc
+//
+//  Created by sanluisrey on 2026/10/19.
+//
+
+#include "tinycc.h"
+
+// 単純な数え上げループの自動ベクトル化
+//
+// for (i = 初期値; i < n; i = i + 1) の形で、本体が次のいずれか1つの文のループを対象にする。
+//
+//   要素ごとの演算: X[i] = E;
+//   総和:           s = s + E;  または  if (C) s = s + 1;
+//   探索:           if (C) return ...;
+//
+// EはintかcharのどちらかにそろったX[i + c]の形の配列要素とループ不変式の+, -, *, <<(intのみ)、
+// Cはその比較とする。該当するループの前に16バイト(intなら4要素、charなら16要素)ずつ
+// SSE2命令で処理するループ(ND_VLOOP)を置き、残りの要素は元のループがそのまま処理する。
+// 探索では条件を満たす要素を含む16バイトを見つけたら、そこから先を元のループに任せる。
+//
+// 書き込み先と読み込み元が同じ配列なら添字の差から依存を調べ、重なるかどうか
+// コンパイル時に分からない場合はループの前で実行時にアドレスの差を調べる。
+
+#define MAX_CHECKS 4    // 実行時に調べる重なりの数
+#define MAX_DEPTH 4     // 式の深さ(xmm0からxmm7を式の計算に使う)
+#define MAX_INVS 5      // ループ不変式の数(xmm8からxmm12に置く)
+
+typedef struct Vec Vec;
+struct Vec {
+    Var *iv;            // 誘導変数
+    Var *bound;         // 上限の変数(定数ならNULL)
+    Var *acc;           // 総和をとる変数
+    int kind;           // VEC_MAP, VEC_REDUCE, VEC_SCAN
+    int size;           // 要素の大きさ(1か4、0は未定)
+    bool named_store;   // 書き込み先が名前の付いた配列か
+    bool arith;         // 要素の加減算を含む
+    bool mul;           // 要素の乗算またはシフトを含む
+    bool wide_cmp;      // charの要素とcharに収まらない値を比べうる
+    Node *invs[MAX_INVS];
+    int ninvs;
+    Node *loads[16];    // 読み込む配列要素(ND_DEREF)
+    int nloads;
+    char *reason;       // ベクトル化できない理由
+};
+
+static bool fail(Vec *v, char *reason) {
+    if (v->reason == NULL) v->reason = reason;
+    return false;
+}
+
+// 式が変数を参照するかどうか
+static bool uses(Node *node, Var *var) {
+    if (node == NULL) return false;
+    if (node->kind == ND_LVAR && node->var == var) return true;
+    if (uses(node->left, var) || uses(node->right, var)) return true;
+    for (int i = 0; i < node->nparams; i++) {
+        if (uses(node->params[i], var)) return true;
+    }
+    return false;
+}
+
+// ループの中で値の変わらない、配列の先頭アドレスを求める式かどうか
+static bool base_ok(Node *node, Vec *v) {
+    switch (node->kind) {
+        case ND_NUM:
+            return true;
+        case ND_LVAR:
+            return isarray(node->type) || (!node->var->escaped && node->var != v->iv && node->var != v->acc);
+        case ND_GVAR:
+            return isarray(node->type);
+        case ND_DEREF:
+            // 多次元配列の行(値がアドレスそのもの)
+            return isarray(node->type) && base_ok(node->right, v);
+        case ND_ADD:
+        case ND_SUB:
+        case ND_MUL:
+        case ND_SHL:
+            return base_ok(node->left, v) && base_ok(node->right, v);
+    }
+    return false;
+}
+
+// 名前の付いた配列の中を指すアドレスかどうか
+static bool named(Node *node) {
+    switch (node->kind) {
+        case ND_LVAR:
+        case ND_GVAR:
+            return isarray(node->type);
+        case ND_DEREF:
+            return isarray(node->type) && named(node->right);
+        case ND_ADD:
+            return !iscint(node->type) && named(node->left);
+    }
+    return false;
+}
+
+// 名前の付いた配列を指すアドレスの、配列の変数(ND_LVARかND_GVAR)を返す。
+static Node *root(Node *node) {
+    if (node->kind == ND_LVAR || node->kind == ND_GVAR) return node;
+    return root(node->kind == ND_DEREF ? node->right : node->left);
+}
+
+static bool same_root(Node *a, Node *b) {
+    a = root(a);
+    b = root(b);
+    if (a->kind != b->kind) return false;
+    return a->kind == ND_LVAR ? a->var == b->var : !strcmp(a->name, b->name);
+}
+
+// アドレスをbase + (i + c) * sizeの形に分解する。
+static bool parse_addr(Node *addr, Vec *v, int size, Node **base, int *c) {
+    if (addr->kind != ND_ADD || iscint(addr->type)) return false;
+    // 定数のバイト数を足したアドレス
+    if (addr->right->kind == ND_NUM) {
+        if (addr->right->val % size || !parse_addr(addr->left, v, size, base, c)) return false;
+        *c += addr->right->val / size;
+        return true;
+    }
+    Node *off = addr->right;
+    if (size == 4) {
+        if (off->kind == ND_SHL && off->right->val == 2) off = off->left;
+        else if (off->kind == ND_MUL && off->right->kind == ND_NUM && off->right->val == 4) off = off->left;
+        else return false;
+    }
+    *c = 0;
+    if (off->kind == ND_ADD && off->right->kind == ND_NUM) {
+        *c = off->right->val;
+        off = off->left;
+    }
+    if (off->kind != ND_LVAR || off->var != v->iv || !base_ok(addr->left, v)) return false;
+    *base = addr->left;
+    return true;
+}
+
+// ループ不変式としてループの前で計算し、全要素に広げられるかどうか
+static bool invariant_ok(Node *node, Vec *v) {
+    switch (node->kind) {
+        case ND_NUM:
+            return true;
+        case ND_LVAR:
+            if (node->var == v->acc) return fail(v, "reduction variable used in the expression");
+            if (node->var->escaped || !is_scalar(node->type)) return fail(v, "unsupported invariant");
+            return true;
+        case ND_GVAR:
+            if (!is_scalar(node->type)) return fail(v, "unsupported invariant");
+            if (v->kind == VEC_MAP && !v->named_store) return fail(v, "invariant may alias the store");
+            return true;
+        case ND_ADD:
+        case ND_SUB:
+        case ND_MUL:
+        case ND_SHL:
+        case ND_NEG:
+            return (node->left == NULL || invariant_ok(node->left, v)) && invariant_ok(node->right, v);
+    }
+    return fail(v, "unsupported invariant");
+}
+
+// 要素ごとに計算する式を調べる。比較はcmpが真の位置(式の最上位)だけに置ける。
+static bool vec_expr(Node *node, Vec *v, int depth, bool cmp) {
+    if (depth > MAX_DEPTH) return fail(v, "expression too deep");
+    if (!uses(node, v->iv)) {
+        if (!invariant_ok(node, v)) return false;
+        for (int i = 0; i < v->ninvs; i++) {
+            if (same_node(v->invs[i], node)) return true;
+        }
+        if (v->ninvs == MAX_INVS) return fail(v, "too many loop invariants");
+        v->invs[v->ninvs++] = node;
+        return true;
+    }
+    if (is_cmp(node)) {
+        if (!cmp) return fail(v, "comparison inside an expression");
+        if (!vec_expr(node->left, v, depth, false) || !vec_expr(node->right, v, depth + 1, false)) return false;
+        // charの要素と比べる値はcharに収まる必要がある
+        for (Node *side = node->left; side; side = side == node->left ? node->right : NULL) {
+            if (uses(side, v->iv)) continue;
+            if (side->kind == ND_NUM ? side->val < -128 || side->val > 127 : !ischar(side->type)) v->wide_cmp = true;
+        }
+        return true;
+    }
+    switch (node->kind) {
+        case ND_DEREF: {
+            if (!iscint(node->type)) return fail(v, "element type is not int or char");
+            int size = (ischar(node->type) ? 1 : 4);
+            if (v->size && v->size != size) return fail(v, "mixed element types");
+            v->size = size;
+            Node *base;
+            int c;
+            if (!parse_addr(node->right, v, size, &base, &c)) return fail(v, "non-contiguous array access");
+            if (v->nloads == 16) return fail(v, "too many array accesses");
+            v->loads[v->nloads++] = node;
+            return true;
+        }
+        case ND_SHL:
+            // 2の冪の乗算を畳み込んだ定数シフト
+            if (node->right->kind != ND_NUM) return fail(v, "unsupported operation");
+            v->mul = true;
+            v->arith = true;
+            return vec_expr(node->left, v, depth + 1, false);
+        case ND_MUL:
+            v->mul = true;
+        case ND_ADD:
+        case ND_SUB:
+            v->arith = true;
+            return vec_expr(node->left, v, depth, false) && vec_expr(node->right, v, depth + 1, false);
+        case ND_NEG:
+            v->arith = true;
+            return vec_expr(node->right, v, depth + 1, false);
+    }
+    return fail(v, "unsupported operation");
+}
+
+// 書き込みと読み込みの依存を調べ、実行時に重なりを調べるアドレスの組を集める。
+static bool check_deps(Vec *v, Node *store, Node **checks, int *nchecks) {
+    Node *sbase;
+    int sc;
+    parse_addr(store->right, v, v->size, &sbase, &sc);
+    for (int i = 0; i < v->nloads; i++) {
+        Node *load = v->loads[i];
+        Node *lbase;
+        int lc;
+        parse_addr(load->right, v, v->size, &lbase, &lc);
+        if (same_node(sbase, lbase)) {
+            // 後の繰り返しで読む要素を先に書き込む距離が1ブロック未満なら結果が変わる
+            int d = sc - lc;
+            if (d > 0 && d < 16 / v->size) return fail(v, "loop-carried dependence");
+            continue;
+        }
+        if (named(sbase) && named(lbase) && !same_root(sbase, lbase)) continue;
+        bool dup = false;
+        for (int j = 0; j < *nchecks; j += 2) {
+            dup |= same_node(checks[j + 1], load->right);
+        }
+        if (dup) continue;
+        if (*nchecks == MAX_CHECKS * 2) return fail(v, "too many possibly overlapping arrays");
+        checks[(*nchecks)++] = store->right;
+        checks[(*nchecks)++] = load->right;
+    }
+    return true;
+}
+
+// 式を複製する(文の連結は辿らない)。
+static Node *copy(Node *node) {
+    if (node == NULL) return NULL;
+    Node *ret = calloc(1, sizeof(Node));
+    *ret = *node;
+    ret->next = NULL;
+    ret->left = copy(node->left);
+    ret->right = copy(node->right);
+    return ret;
+}
+
+// 文が変数を1つ増やす(var = var + c)ものならその変数を返す。
+static Var *increment(Node *node, int c) {
+    if (node == NULL || node->kind != ND_ASGMT || node->left->kind != ND_LVAR) return NULL;
+    Var *var = node->left->var;
+    Node *rhs = node->right;
+    if (rhs->kind != ND_ADD || rhs->right->kind != ND_NUM || rhs->right->val != c) return NULL;
+    if (rhs->left->kind != ND_LVAR || rhs->left->var != var) return NULL;
+    return var;
+}
+
+// 返って来ない文(最後がreturnの文)かどうか
+static bool returns(Node *node) {
+    if (node->kind == ND_BLOCK) {
+        Node *last = node->right;
+        while (last && last->next) last = last->next;
+        return last && returns(last);
+    }
+    return node->kind == ND_RETURN;
+}
+
+// ループを調べ、ベクトル化できればND_VLOOPを返す。
+static Node *vectorizable(Node *loop, Vec *v) {
+    if (loop->kind != ND_FOR || loop->cond == NULL) {
+        fail(v, "not a counted for loop");
+        return NULL;
+    }
+    // i = i + 1で進み、i < n (i <= n, n > i, n >= i)で終わるループ
+    v->iv = increment(loop->step, 1);
+    Node *cond = loop->cond;
+    if (v->iv == NULL || v->iv->escaped || v->iv->type->ty != INT) {
+        fail(v, "not a counted for loop");
+        return NULL;
+    }
+    Node *iv = NULL, *bound = NULL;
+    if (cond->kind == ND_LT || cond->kind == ND_LE) {
+        iv = cond->left;
+        bound = cond->right;
+    } else if (cond->kind == ND_GT || cond->kind == ND_GE) {
+        iv = cond->right;
+        bound = cond->left;
+    }
+    if (iv == NULL || iv->kind != ND_LVAR || iv->var != v->iv) {
+        fail(v, "not a counted for loop");
+        return NULL;
+    }
+    if (bound->kind == ND_LVAR && !bound->var->escaped && bound->var != v->iv && is_scalar(bound->type)) {
+        v->bound = bound->var;
+    } else if (bound->kind != ND_NUM) {
+        fail(v, "loop bound is not a constant or local variable");
+        return NULL;
+    }
+
+    Node *stmt = loop->body;
+    if (stmt->kind == ND_BLOCK && stmt->right && stmt->right->next == NULL) stmt = stmt->right;
+    Node *pattern = NULL;
+    Node *checks[MAX_CHECKS * 2];
+    int nchecks = 0;
+    if (stmt->kind == ND_EXPR_STMT && stmt->right->kind == ND_ASGMT) {
+        Node *asgmt = stmt->right;
+        Node *lhs = asgmt->left;
+        if (lhs->kind == ND_DEREF) {
+            // X[i] = E
+            v->kind = VEC_MAP;
+            if (!iscint(lhs->type)) {
+                fail(v, "element type is not int or char");
+                return NULL;
+            }
+            v->size = (ischar(lhs->type) ? 1 : 4);
+            Node *base;
+            int c;
+            if (!parse_addr(lhs->right, v, v->size, &base, &c)) {
+                fail(v, "non-contiguous array access");
+                return NULL;
+            }
+            v->named_store = named(base);
+            if (!vec_expr(asgmt->right, v, 0, true) || !check_deps(v, lhs, checks, &nchecks)) return NULL;
+            pattern = asgmt;
+        } else if (lhs->kind == ND_LVAR) {
+            // s = s + E
+            v->kind = VEC_REDUCE;
+            v->acc = lhs->var;
+            Node *rhs = asgmt->right;
+            if (rhs->kind != ND_ADD) {
+                fail(v, "unsupported loop body");
+                return NULL;
+            }
+            Node *e = NULL;
+            if (rhs->left->kind == ND_LVAR && rhs->left->var == v->acc) e = rhs->right;
+            else if (rhs->right->kind == ND_LVAR && rhs->right->var == v->acc) e = rhs->left;
+            if (e == NULL) {
+                fail(v, "unsupported loop body");
+                return NULL;
+            }
+            pattern = e;
+        }
+    } else if (stmt->kind == ND_IF && stmt->els == NULL) {
+        Node *body = stmt->body;
+        if (body->kind == ND_BLOCK && body->right && body->right->next == NULL) body = body->right;
+        Var *acc = body->kind == ND_EXPR_STMT ? increment(body->right, 1) : NULL;
+        if (acc) {
+            // if (C) s = s + 1
+            v->kind = VEC_REDUCE;
+            v->acc = acc;
+            pattern = stmt->cond;
+        } else if (returns(stmt->body)) {
+            // if (C) return ...
+            v->kind = VEC_SCAN;
+            pattern = stmt->cond;
+        }
+    }
+    if (pattern == NULL) {
+        fail(v, "unsupported loop body");
+        return NULL;
+    }
+    if (v->kind == VEC_REDUCE) {
+        if (v->acc->escaped || v->acc->type->ty != INT || v->acc == v->iv || v->acc == v->bound) {
+            fail(v, "unsupported reduction variable");
+            return NULL;
+        }
+        if (!vec_expr(pattern, v, 0, true)) return NULL;
+    } else if (v->kind == VEC_SCAN && !vec_expr(pattern, v, 0, true)) {
+        return NULL;
+    }
+    if (v->size == 0) {
+        fail(v, "no array access");
+        return NULL;
+    }
+    if (v->size == 1) {
+        // 1バイトの要素の計算は、charの配列への書き込み以外ではintの計算と結果が変わる
+        if (v->mul) {
+            fail(v, "char arithmetic is not supported");
+            return NULL;
+        }
+        // charへの書き込みは下位8ビットしか残らないので、比較の結果以外は1バイトで計算してよい
+        if (v->arith && (v->kind != VEC_MAP || is_cmp(pattern->right))) {
+            fail(v, "char arithmetic is not supported");
+            return NULL;
+        }
+        if (v->wide_cmp) {
+            fail(v, "char compared with an int value");
+            return NULL;
+        }
+        if (v->kind == VEC_REDUCE && !is_cmp(pattern) && pattern->kind != ND_DEREF) {
+            fail(v, "unsupported reduction");
+            return NULL;
+        }
+    }
+
+    Node *vl = calloc(1, sizeof(Node));
+    vl->kind = ND_VLOOP;
+    vl->ireg = v->kind;
+    vl->val = v->size;
+    vl->left = new_node_var(v->iv);
+    vl->cond = copy(cond);
+    vl->body = copy(pattern);
+    if (v->acc) vl->right = new_node_var(v->acc);
+    if (nchecks) {
+        vl->nparams = nchecks;
+        vl->params = calloc(nchecks, sizeof(Node *));
+        for (int i = 0; i < nchecks; i++) {
+            vl->params[i] = copy(checks[i]);
+        }
+    }
+    return vl;
+}
+
+static char *kind_names[] = {
+    [VEC_MAP] = "element-wise",
+    [VEC_REDUCE] = "reduction",
+    [VEC_SCAN] = "search",
+};
+
+// ベクトル化したループを元のループ(forの初期化式の後)の前に置く。
+static void vectorize_loop(Function *fn, Node **link, int *nloops) {
+    Node *loop = *link;
+    Vec v = {0};
+    ++*nloops;
+    Node *vl = vectorizable(loop, &v);
+    if (vl == NULL) {
+        opt_report(P_VECTORIZE, "%s: loop %d: not vectorized: %s", fn->name, *nloops, v.reason);
+        return;
+    }
+    opt_report(P_VECTORIZE, "%s: loop %d: vectorized (%s, %d lanes%s)", fn->name, *nloops,
+               kind_names[v.kind], 16 / v.size, vl->nparams ? ", runtime overlap check" : "");
+    vl->next = loop;
+    // 重なりの検査で飛ばさない限り、元のループは1ブロック分より少なくしか回らない
+    if (vl->nparams == 0) loop->val = 16 / v.size;
+    if (loop->initialization) {
+        Node *init = loop->initialization;
+        loop->initialization = NULL;
+        init->next = vl;
+        *link = init;
+    } else {
+        *link = vl;
+    }
+}
+
+// 単純な数え上げループをSSE2命令で処理するループに置き換える。
+void vectorize(Function *fn) {
+    for_each_loop(fn, vectorize_loop);
+}